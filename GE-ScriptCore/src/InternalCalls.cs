@@ -115,6 +115,20 @@ namespace GE
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static bool Input_IsMouseDown(MouseCode mouseCode);
 
+        // SCENE
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong[] Scene_QueryAABB(ref Vector2 min, ref Vector2 max);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong[] Scene_QueryPoint(ref Vector2 point);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong[] Scene_QueryNearest(ref Vector2 point, uint count);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong Scene_Raycast(ref Vector2 origin, ref Vector2 direction, float maxDistance, out float distance);
+
 
     }
 }
@@ -0,0 +1,43 @@
+﻿using System;
+
+namespace GE
+{
+    public class Scene
+    {
+        public static Entity[] QueryAABB(Vector2 min, Vector2 max)
+        {
+            return ToEntities(InternalCalls.Scene_QueryAABB(ref min, ref max));
+        }
+
+        public static Entity[] QueryPoint(Vector2 point)
+        {
+            return ToEntities(InternalCalls.Scene_QueryPoint(ref point));
+        }
+
+        // Returns up to count Entities, nearest first
+        public static Entity[] QueryNearest(Vector2 point, uint count)
+        {
+            return ToEntities(InternalCalls.Scene_QueryNearest(ref point, count));
+        }
+
+        // Returns closest Entity hit by ray, otherwise null
+        public static Entity Raycast(Vector2 origin, Vector2 direction, float maxDistance, out float distance)
+        {
+            ulong uuid = InternalCalls.Scene_Raycast(ref origin, ref direction, maxDistance, out distance);
+            if (uuid == 0)
+                return null;
+            return new Entity(uuid);
+        }
+
+        private static Entity[] ToEntities(ulong[] uuids)
+        {
+            if (uuids == null)
+                return new Entity[0];
+
+            Entity[] entities = new Entity[uuids.Length];
+            for (int i = 0; i < uuids.Length; i++)
+                entities[i] = new Entity(uuids[i]);
+            return entities;
+        }
+    }
+}
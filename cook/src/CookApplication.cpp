@@ -0,0 +1,107 @@
+#include "CookApplication.h"
+
+#include "AssetManager/EditorAssetManager.h"
+#include "Application/Layer/EditorLayerStack.h"
+
+#include <GE/Core/EntryPoint.h>
+
+#include <GE/Asset/RuntimeAssetManager.h>
+#include <GE/Project/Project.h>
+
+#include <chrono>
+
+namespace GE
+{
+	static float GetMilliseconds(const std::chrono::steady_clock::time_point& startTime)
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	static float GetThroughput(uint64_t bytes, float milliseconds)
+	{
+		return milliseconds > 0.0f ? (bytes / (1024.0f * 1024.0f)) / (milliseconds / 1000.0f) : 0.0f;
+	}
+
+	CookApplication::CookApplication(const Config& config) : Application(config)
+	{
+		// Scenes register their Layers while importing, nothing is attached
+		p_LayerStack = CreateRef<EditorLayerStack>();
+
+		for (int i = 2; i < config.Args.Count; i++)
+		{
+			if (std::string(config.Args[i]) == "--no-compress")
+				m_Compress = false;
+			else if (std::string(config.Args[i]) == "--no-columns")
+				m_ColumnarScenes = false;
+			else
+				GE_WARN("Unknown argument : {0}", config.Args[i]);
+		}
+	}
+
+	void CookApplication::Run()
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!p_Running)
+		{
+			p_ExitCode = 1;
+			return;
+		}
+
+		const auto cookStartTime = std::chrono::steady_clock::now();
+		bool success = true;
+
+		// Import
+		AssetMap assetMap = AssetMap();
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			Ref<EditorAssetManager> eam = Project::NewAssetManager<EditorAssetManager>();
+			success = eam->DeserializeAssetsParallel();
+			const float duration = GetMilliseconds(startTime);
+
+			uint64_t bytes = 0;
+			for (const auto& [type, stats] : eam->GetImportStats())
+			{
+				bytes += stats.Bytes;
+				GE_INFO("Cook Import - {0}\n\tCount : {1}\n\tSource : {2} bytes\n\tThread Time : {3}ms\n\tThroughput : {4}MB/s per thread",
+					AssetUtils::AssetTypeToString(type).c_str(), stats.Count, stats.Bytes, stats.Milliseconds, GetThroughput(stats.Bytes, stats.Milliseconds));
+			}
+			GE_INFO("Cook Import {0}.\n\tWorkers : {1}\n\tSource : {2} bytes\n\tDuration : {3}ms\n\tThroughput : {4}MB/s",
+				success ? "Complete" : "Failed", p_WorkerThreads->GetCount(), bytes, duration, GetThroughput(bytes, duration));
+
+			assetMap = eam->GetLoadedAssets();
+		}
+
+		// Pack, see RuntimeAssetManager::SerializeAssets() for cache & compression stats
+		if (success)
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			Ref<RuntimeAssetManager> ram = Project::NewAssetManager<RuntimeAssetManager>(assetMap);
+			ram->SetCompression(m_Compress ? Compression::Codec::LZ : Compression::Codec::None);
+			ram->SetColumnarScenes(m_ColumnarScenes);
+			success = ram->SerializeAssets();
+			const float duration = GetMilliseconds(startTime);
+
+			const std::filesystem::path path = Project::GetPathToAsset(ram->GetPack()->GetFilePath());
+			std::error_code error;
+			const uintmax_t size = std::filesystem::file_size(path, error);
+			GE_INFO("Cook Pack {0}.\n\tFilePath : {1}\n\tSize : {2} bytes\n\tDuration : {3}ms\n\tThroughput : {4}MB/s",
+				success ? "Complete" : "Failed", path.string().c_str(), error ? 0 : size, duration, GetThroughput(error ? 0 : size, duration));
+		}
+
+		GE_INFO("Cook {0}.\n\tAssets : {1}\n\tDuration : {2}ms", success ? "Complete" : "Failed", assetMap.size(), GetMilliseconds(cookStartTime));
+		p_ExitCode = success ? 0 : 1;
+		Close();
+	}
+
+	// Declared in GE::EntryPoint.h
+	Application* CreateApplication(Application::CommandLineArgs args)
+	{
+		Application::Config appConfig;
+		appConfig.Name = "Game Asset Cook";
+		appConfig.Args = args;
+		appConfig.Headless = true;
+
+		return new CookApplication(appConfig);
+	}
+}
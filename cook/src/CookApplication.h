@@ -0,0 +1,29 @@
+#pragma once
+
+#include <GE/Core/Application/Application.h>
+
+namespace GE
+{
+	/*
+	* Headless Application building a .gap(Game Asset Pack) from a Project's Asset Registry.
+	* No Window, GL context or Audio device is created.
+	*
+	* Usage : ge-cook <project.gproj> [--no-compress] [--no-columns]
+	*/
+	class CookApplication : public Application
+	{
+	public:
+		CookApplication(const Config& config);
+
+		/*
+		* Imports all Registry Assets on worker threads, writes the Asset Pack & prints per stage timing.
+		* Closes when done, exit code is non-zero if any stage failed
+		*/
+		void Run() override;
+
+	private:
+		bool m_Compress = true;
+		// See RuntimeAssetManager::SetColumnarScenes()
+		bool m_ColumnarScenes = true;
+	};
+}
@@ -7,11 +7,13 @@ layout(location = 0) in vec3 a_Position;
 layout(location = 1) in vec4 a_TextColor;
 layout(location = 2) in vec4 a_BGColor;
 layout(location = 3) in vec2 a_TextureCoord;
-layout(location = 4) in int a_EntityID;
+layout(location = 4) in int a_AtlasIndex;
+layout(location = 5) in int a_EntityID;
 
 out vec4 v_TextColor;
 out vec4 v_BGColor;
 out vec2 v_TextureCoord;
+flat out int v_AtlasIndex;
 flat out int v_EntityID;
 
 uniform mat4 u_ViewProjection;
@@ -21,6 +23,7 @@ void main()
 	v_TextColor = a_TextColor;
 	v_BGColor = a_BGColor;
 	v_TextureCoord = a_TextureCoord;
+	v_AtlasIndex = a_AtlasIndex;
 	v_EntityID = a_EntityID;
 	gl_Position = u_ViewProjection * vec4(a_Position, 1.0f);
 }
@@ -34,14 +37,15 @@ layout(location = 1) out int entityID;
 in vec4 v_TextColor;
 in vec4 v_BGColor;
 in vec2 v_TextureCoord;
+flat in int v_AtlasIndex;
 flat in int v_EntityID;
 
-uniform sampler2D u_TextAtlas;
+uniform sampler2D u_TextAtlases[8];
 
 float screenPxRange() 
 {
 	const float pxRange = 2.0; // set to distance field's pixel range
-    vec2 unitRange = vec2(pxRange)/vec2(textureSize(u_TextAtlas, 0));
+    vec2 unitRange = vec2(pxRange)/vec2(textureSize(u_TextAtlases[v_AtlasIndex], 0));
     vec2 screenTexSize = vec2(1.0)/fwidth(v_TextureCoord);
     return max(0.5*dot(unitRange, screenTexSize), 1.0);
 }
@@ -53,7 +57,7 @@ float median(float r, float g, float b)
 
 void main()
 {
-	vec3 msd = texture(u_TextAtlas, v_TextureCoord).rgb;
+	vec3 msd = texture(u_TextAtlases[v_AtlasIndex], v_TextureCoord).rgb;
 	float sd = median(msd.r, msd.g, msd.b);
 	float screenPxDistance = screenPxRange() * (sd - 0.5);
 	float opacity = clamp(screenPxDistance + 0.5, 0.0, 1.0);
@@ -14,7 +14,8 @@ namespace GE
 	EditorApplication::EditorApplication(const Config& config) : Application(config)
 	{
 		p_LayerStack = CreateRef<EditorLayerStack>();
-		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssets();
+		// Window appears before Textures, Fonts & Audio are imported, see EditorLayer::ImGUI_SceneToolbar()
+		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssetsAsync();
 		// Attach Layers added through deserialization
 		AttachAllLayers();
 	}
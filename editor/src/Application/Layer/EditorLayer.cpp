@@ -3,9 +3,11 @@
 #include "../../AssetManager/EditorAssetManager.h"
 
 #include <GE/Asset/RuntimeAssetManager.h>
+#include <GE/Asset/Assets/Font/Font.h>
 #include <GE/Asset/Assets/Scene/Components/Components.h>
 
 #include <GE/Core/Application/Application.h>
+#include <GE/Core/Memory/ProcessMemory.h>
 
 #include <GE/Project/Project.h>
 #include <GE/Rendering/Renderer/Renderer.h>
@@ -14,22 +16,42 @@
 #include <GE/Core/Debug/ImGUI/ImGuiBuild.cpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <chrono>
+#include <fstream>
+
 namespace GE
 {
 	/*
-	* Copies EditorAssetManager.LoadedAssets & Adds them to New RuntimeAssetManager
+	* Copies every Asset in EditorAssetManager's registry & Adds them to New RuntimeAssetManager
 	* Reinitializes & deserializes EditorAssetManager after complete
 	*/
-	static void SerializeRuntimeAssetManager()
+	static void SerializeRuntimeAssetManager(bool compress, bool columnarScenes)
 	{
-		const AssetMap assetMap = Project::GetAssetManager<EditorAssetManager>()->GetLoadedAssets();
+		Ref<EditorAssetManager> eam = Project::GetAssetManager<EditorAssetManager>();
+		// Every Asset is packed, not only those imported so far
+		eam->FinishImport();
+		AssetMap assetMap = eam->GetLoadedAssets();
+		// Or those evicted by AssetResidency since, reimported
+		for (const auto& [handle, metadata] : eam->GetAssetRegistry()->GetRegistry())
+		{
+			if (assetMap.find(handle) != assetMap.end())
+				continue;
+
+			if (Ref<Asset> asset = eam->GetAsset(handle))
+				assetMap.emplace(handle, asset);
+			else
+				GE_WARN("SerializeRuntimeAssetManager - Asset {0} couldn't be reimported, it won't be packed.", (uint64_t)handle);
+		}
 		Ref<RuntimeAssetManager> ram = Project::NewAssetManager<RuntimeAssetManager>(assetMap);
+		ram->SetCompression(compress ? Compression::Codec::LZ : Compression::Codec::None);
+		ram->SetColumnarScenes(columnarScenes);
+		ram->SetSourceKeys(eam->GetSourceKeys());
 
 		if (ram->SerializeAssets())
 			GE_INFO("SerializeRuntimeAssetManager Successful");
 
-		// Revert to EditorAssetManager using full DeserializeAssets process
-		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssets();
+		// Revert to EditorAssetManager using full DeserializeAssets process, decoded on workers
+		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssetsParallel();
 	}
 
 	/*
@@ -45,8 +67,65 @@ namespace GE
 				GE_TRACE("Asset : {0}, {1}", (uint64_t)uuid, AssetUtils::AssetTypeToString(asset->GetType()).c_str());
 		}
 
-		// Revert to EditorAssetManager using full DeserializeAssets process
-		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssets();
+		// Revert to EditorAssetManager using full DeserializeAssets process, decoded on workers
+		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssetsParallel();
+	}
+
+	/*
+	* Returns Entity under mouse, read back from Framebuffer entity ID attachment.
+	* Scene spatial index is checked first, skipping readback when nothing rendered is under mouse.
+	* Only for orthographic cameras, where mouse is one world point at every depth.
+	* Text can extend past its bounds, Scenes with Text always read back.
+	*
+	* @param mousePosition : position relative to window
+	*/
+	static Entity PickEntity(Ref<Scene> scene, const Camera* camera, const glm::vec2& mousePosition)
+	{
+		Ref<Framebuffer> framebuffer = Application::GetFramebuffer();
+		if (!scene || !camera || !framebuffer)
+			return {};
+
+		const glm::vec2 viewportSize = framebuffer->GetMaxBounds() - framebuffer->GetMinBounds();
+		if (viewportSize.x <= 0.0f || viewportSize.y <= 0.0f)
+			return {};
+
+		if (camera->GetProjectionType() == Camera::ProjectionType::Orthographic && scene->GetAllEntitiesWith<TextRendererComponent>().empty())
+		{
+			const glm::vec2 relativeMouse = Application::GetFramebufferCursor(mousePosition);
+			const glm::vec2 ndc = (relativeMouse / viewportSize) * 2.0f - 1.0f;
+
+			const glm::mat4 inverseViewProjection = glm::inverse(camera->GetViewProjection());
+			const glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+			const glm::vec2 worldPoint = glm::vec2(nearPoint) / nearPoint.w;
+
+			std::vector<Entity> entities = std::vector<Entity>();
+			scene->GetSpatialIndex().QueryPoint(worldPoint, entities);
+
+			bool rendered = false;
+			for (Entity entity : entities)
+			{
+				if (!scene->EntityExists(entity))
+					continue;
+
+				auto& ac = scene->GetComponent<ActiveComponent>(entity);
+				if (!ac.Active || ac.Hidden)
+					continue;
+
+				if (scene->HasComponent<SpriteRendererComponent>(entity) || scene->HasComponent<CircleRendererComponent>(entity)
+					|| scene->HasComponent<GUIComponent>(entity))
+				{
+					rendered = true;
+					break;
+				}
+			}
+
+			entities.clear();
+			entities = std::vector<Entity>();
+			if (!rendered)
+				return {};
+		}
+
+		return Application::GetHoveredEntity(mousePosition);
 	}
 
 	EditorLayer::EditorLayer(uint64_t id) : Layer(id),
@@ -178,22 +257,16 @@ namespace GE
 
 		if (Ref<EditorAssetManager> eam = Project::GetAssetManager<EditorAssetManager>())
 		{
-			if (Ref<Asset> editorIcon = eam->GetAsset("textures/EditorIcon.png"))
-			{
-				m_EditorIconHandle = editorIcon->GetHandle();
+			// Handles only, Assets may still be importing on workers
+			Ref<AssetRegistry> registry = eam->GetAssetRegistry();
+			if (m_EditorIconHandle = registry->GetHandle("textures/EditorIcon.png"))
 				Application::SetIcon(m_EditorIconHandle);
-			}
-			if (Ref<Asset> playButton = eam->GetAsset("textures/Play_Button.png"))
-				m_PlayButtonHandle = playButton->GetHandle();
-			if (Ref<Asset> pauseButton = eam->GetAsset("textures/Pause_Button.png"))
-				m_PauseButtonHandle = pauseButton->GetHandle();
-			if (Ref<Asset> stepButton = eam->GetAsset("textures/Step_Button.png"))
-				m_StepButtonHandle = stepButton->GetHandle();
-			if (Ref<Asset> stopButton = eam->GetAsset("textures/Stop_Button.png"))
-				m_StopButtonHandle = stopButton->GetHandle();
-
-			if(Ref<Asset> font = eam->GetAsset("fonts/arial.ttf"))
-				m_FontHandle = font->GetHandle();
+			m_PlayButtonHandle = registry->GetHandle("textures/Play_Button.png");
+			m_PauseButtonHandle = registry->GetHandle("textures/Pause_Button.png");
+			m_StepButtonHandle = registry->GetHandle("textures/Step_Button.png");
+			m_StopButtonHandle = registry->GetHandle("textures/Stop_Button.png");
+
+			m_FontHandle = registry->GetHandle("fonts/arial.ttf");
 		}
 
 		LoadScene();
@@ -222,6 +295,8 @@ namespace GE
 				scene->OnResizeViewport(fb->GetWidth(), fb->GetHeight());
 				if (scene->IsRunning())
 					m_ShowMouse = !m_ImGUIViewportHovered;
+				if (m_PrefabBenchmarkEveryFrame)
+					SpawnPrefabBenchmark(scene, 10000);
 
 				if (m_EditorCamera)
 				{
@@ -379,7 +454,7 @@ namespace GE
 			}
 
 			// Outline Hovered Entity
-			m_HoveredEntity = Application::GetHoveredEntity(m_ImGUIMousePosition);
+			m_HoveredEntity = PickEntity(scene, camera, m_ImGUIMousePosition);
 			if (m_HoveredEntity && scene->HasComponent<TransformComponent>(m_HoveredEntity))
 			{
 				auto& hoveredTRSC = scene->GetComponent<TransformComponent>(m_HoveredEntity);
@@ -460,6 +535,277 @@ namespace GE
 		}
 	}
 
+	void EditorLayer::CreateTileBenchmark(Ref<Scene> scene, uint32_t width, uint32_t height)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (Entity previous = scene->GetEntityByUUID(m_TileBenchmarkID))
+			scene->DestroyEntity(previous);
+
+		Entity root = scene->CreateEntity("Tile Benchmark", 0);
+		auto& rootIDC = scene->GetComponent<IDComponent>(root);
+		scene->GetComponent<RenderComponent>(root).AddID(p_Config.ID);
+		m_TileBenchmarkID = rootIDC.ID;
+
+		for (uint32_t y = 0; y < height; y++)
+		{
+			for (uint32_t x = 0; x < width; x++)
+			{
+				Entity tile = scene->CreateEntity("Tile", 0);
+				auto& tileIDC = scene->GetComponent<IDComponent>(tile);
+				scene->GetComponent<RenderComponent>(tile).AddID(p_Config.ID);
+				scene->GetComponent<TransformComponent>(tile).Translation = glm::vec3((float)x, (float)y, -1.0f);
+
+				// Checkerboard, so individual tiles are visible
+				const float shade = ((x + y) % 2) ? 0.35f : 0.65f;
+				auto& src = scene->AddComponent<SpriteRendererComponent>(tile, glm::vec4(shade, shade, shade, 1.0f));
+				src.Static = m_TileBenchmarkStatic;
+
+				scene->GetComponent<RelationshipComponent>(root).AddChild(tileIDC.ID);
+				scene->SetEntityParent(tile, rootIDC.ID);
+			}
+		}
+		scene->MarkStaticDirty();
+		GE_INFO("EditorLayer - Created {0} {1} benchmark tiles.", width * height, m_TileBenchmarkStatic ? "static" : "dynamic");
+	}
+
+	void EditorLayer::SetTileBenchmarkStatic(Ref<Scene> scene, bool isStatic)
+	{
+		Entity root = scene->GetEntityByUUID(m_TileBenchmarkID);
+		if (!root)
+			return;
+
+		for (const UUID& childID : scene->GetComponent<RelationshipComponent>(root).GetChildren())
+		{
+			if (Entity tile = scene->GetEntityByUUID(childID))
+				scene->GetComponent<SpriteRendererComponent>(tile).Static = isStatic;
+		}
+		scene->MarkStaticDirty();
+	}
+
+	void EditorLayer::SpawnPrefabBenchmark(Ref<Scene> scene, uint32_t count)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!m_PrefabBenchmark)
+		{
+			m_PrefabBenchmark = CreateRef<Prefab>();
+			Ref<Scene> prefabTemplate = m_PrefabBenchmark->GetTemplate();
+
+			Entity root = prefabTemplate->CreateEntity("Prefab Benchmark", 0);
+			const UUID rootID = prefabTemplate->GetComponent<IDComponent>(root).ID;
+			prefabTemplate->GetComponent<RenderComponent>(root).AddID(p_Config.ID);
+			prefabTemplate->AddComponent<SpriteRendererComponent>(root, glm::vec4(0.8f, 0.35f, 0.2f, 1.0f));
+
+			Entity child = prefabTemplate->CreateEntity("Prefab Benchmark Child", 0);
+			const UUID childID = prefabTemplate->GetComponent<IDComponent>(child).ID;
+			prefabTemplate->GetComponent<RenderComponent>(child).AddID(p_Config.ID);
+			prefabTemplate->GetComponent<TransformComponent>(child).Scale = glm::vec3(0.5f);
+			prefabTemplate->AddComponent<CircleRendererComponent>(child, 1.0f, 0.0f, glm::vec4(0.2f, 0.35f, 0.8f, 1.0f));
+
+			prefabTemplate->GetComponent<RelationshipComponent>(root).AddChild(childID);
+			prefabTemplate->SetEntityParent(child, rootID);
+			if (!m_PrefabBenchmark->Resolve())
+			{
+				m_PrefabBenchmark = nullptr;
+				return;
+			}
+		}
+
+		// Square grid, above previous spawns
+		const uint32_t side = (uint32_t)glm::ceil(glm::sqrt((float)count));
+		const float offset = (float)(m_PrefabBenchmarkSpawns * side);
+		std::vector<TransformComponent> transforms = std::vector<TransformComponent>(count);
+		for (uint32_t i = 0; i < count; i++)
+			transforms[i].Translation = glm::vec3((float)(i % side), (float)(i / side) + offset, -2.0f);
+
+		const auto start = std::chrono::steady_clock::now();
+		m_PrefabBenchmark->Instantiate(scene, count, transforms);
+		m_PrefabBenchmarkTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		m_PrefabBenchmarkSpawns++;
+		m_PrefabBenchmarkInstances += count;
+		GE_TRACE("EditorLayer - Spawned {0} Prefab instances in {1}ms.", count, m_PrefabBenchmarkTime);
+	}
+
+	void EditorLayer::CreateEntityBenchmark(uint32_t count)
+	{
+		GE_PROFILE_FUNCTION();
+
+		{
+			Ref<Scene> scene = CreateRef<Scene>();
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i++)
+				scene->CreateEntity("Benchmark Entity", 0);
+			m_CreateEntityTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		{
+			Ref<Scene> scene = CreateRef<Scene>();
+			const auto start = std::chrono::steady_clock::now();
+			scene->CreateEntities(count, "Benchmark Entity", 0);
+			m_CreateEntitiesTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		m_CreateBenchmarkCount = count;
+		GE_INFO("EditorLayer - Created {0} Entities.\n\tCreateEntity : {1}ms\n\tCreateEntities : {2}ms", count, m_CreateEntityTime, m_CreateEntitiesTime);
+	}
+
+	void EditorLayer::RegistryBenchmark(uint32_t count)
+	{
+		GE_PROFILE_FUNCTION();
+
+		AssetRegistry registry = AssetRegistry();
+		std::vector<std::filesystem::path> paths = std::vector<std::filesystem::path>();
+		paths.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+			paths.push_back(std::filesystem::path("Benchmark") / std::to_string(i % 100) / (std::to_string(i) + ".png"));
+
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (const std::filesystem::path& path : paths)
+				registry.AddAsset(AssetMetadata(UUID(), path));
+			m_RegistryAddTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// Spread across the registry, every path is registered
+		const uint32_t stride = std::max(count / 1000u, 1u);
+		uint32_t found = 0;
+		{
+			uint32_t lookups = 0;
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i += stride, lookups++)
+				found += registry.GetHandle(paths[i]) != 0;
+			m_RegistryIndexedLookupTime = lookups ? std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count() / lookups : 0.0f;
+		}
+
+		// Previous EditorAssetManager::GetAsset(path), compares every entry
+		{
+			uint32_t lookups = 0;
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count && lookups < 100; i += stride * 10, lookups++)
+			{
+				UUID assetHandle = 0;
+				for (const auto& [handle, metadata] : registry.GetRegistry())
+				{
+					if (metadata.FilePath == paths[i])
+						assetHandle = handle;
+				}
+				found += assetHandle != 0;
+			}
+			m_RegistryLinearLookupTime = lookups ? std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count() / lookups : 0.0f;
+		}
+
+		m_RegistryBenchmarkCount = count;
+		GE_INFO("EditorLayer - Registry of {0} Assets.\n\tAdd : {1}ms\n\tIndexed Lookup : {2}us\n\tLinear Lookup : {3}us\n\tFound : {4}", count, m_RegistryAddTime, m_RegistryIndexedLookupTime, m_RegistryLinearLookupTime, found);
+	}
+
+	void EditorLayer::SpatialIndexBenchmark(uint32_t count)
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Unit bounds on a square grid, like tiles
+		const uint32_t side = (uint32_t)glm::ceil(glm::sqrt((float)count));
+		std::vector<SceneSpatialIndex::Bounds> bounds = std::vector<SceneSpatialIndex::Bounds>(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const glm::vec2 min = glm::vec2((float)(i % side), (float)(i / side));
+			bounds[i] = SceneSpatialIndex::Bounds(min, min + glm::vec2(1.0f));
+		}
+
+		SceneSpatialIndex index = SceneSpatialIndex();
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i++)
+				index.Insert(UUID(i + 1), Entity(i), bounds[i]);
+			m_SpatialIndexInsertTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// Moved past SceneSpatialIndex::Margin, worst case where every leaf is reinserted
+		uint32_t restructured = 0;
+		{
+			const glm::vec2 move = glm::vec2(SceneSpatialIndex::Margin * 2.5f, 0.0f);
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i++)
+			{
+				bounds[i].first += move;
+				bounds[i].second += move;
+				restructured += index.Update(UUID(i + 1), bounds[i]);
+			}
+			m_SpatialIndexUpdateTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// 32x18 unit views spread across the grid
+		uint64_t found = 0;
+		{
+			const uint32_t queries = 1000;
+			std::vector<Entity> entities = std::vector<Entity>();
+			const auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < queries; i++)
+			{
+				const glm::vec2 min = glm::vec2((float)((i * 37) % side), (float)((i * 53) % side));
+				entities.clear();
+				index.QueryAABB(SceneSpatialIndex::Bounds(min, min + glm::vec2(32.0f, 18.0f)), entities);
+				found += entities.size();
+			}
+			m_SpatialIndexQueryTime = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count() / queries;
+		}
+
+		m_SpatialIndexBenchmarkCount = count;
+		GE_INFO("EditorLayer - Spatial Index of {0} Entities.\n\tInsert : {1}ms\n\tUpdate : {2}ms, {3} Restructured\n\tQuery : {4}us\n\tFound : {5}",
+			count, m_SpatialIndexInsertTime, m_SpatialIndexUpdateTime, restructured, m_SpatialIndexQueryTime, found);
+	}
+
+	void EditorLayer::PackLoadBenchmark()
+	{
+		GE_PROFILE_FUNCTION();
+
+		Ref<RuntimeAssetManager> ram = Project::NewAssetManager<RuntimeAssetManager>();
+		const std::filesystem::path path = Project::GetPathToAsset(ram->GetPack()->GetFilePath());
+		m_PackBenchmarkRun = ram->DeserializeAssets();
+		m_PackLoadStats = ram->GetLoadStats();
+		// Decoded on first use otherwise. Fonts are compared against generating them on import, see FontStats
+		m_PackDecoded = 0;
+		if (m_PackBenchmarkRun)
+		{
+			const uint64_t inflatedBytes = CompressionStats::RawBytes;
+			const uint64_t inflateTime = CompressionStats::Microseconds;
+			const auto start = std::chrono::steady_clock::now();
+			for (const auto& [handle, entry] : ram->GetPack()->GetEntries())
+			{
+				if ((Asset::Type)entry.Type != Asset::Type::Scene && ram->GetAsset(handle))
+					m_PackDecoded++;
+			}
+			m_PackDecodeTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+			m_PackInflatedBytes = CompressionStats::RawBytes - inflatedBytes;
+			m_PackInflateTime = (CompressionStats::Microseconds - inflateTime) / 1000.0f;
+		}
+		// Unmapped once reverted, only one copy of the pack is resident while reading
+		ram = nullptr;
+		Project::NewAssetManager<EditorAssetManager>()->DeserializeAssetsParallel();
+
+		if (m_PackBenchmarkRun)
+		{
+			const uint64_t residentSize = ProcessMemory::GetResidentSize();
+			const auto start = std::chrono::steady_clock::now();
+			ScopedBuffer data = ScopedBuffer();
+			std::ifstream stream(path, std::ios::binary | std::ios::ate);
+			if (stream.is_open())
+			{
+				data.Allocate((size_t)stream.tellg());
+				stream.seekg(0, std::ios::beg);
+				stream.read(data.As<char>(), data.GetSize());
+			}
+			m_PackReadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+			m_PackReadResidentGrowth = (int64_t)ProcessMemory::GetResidentSize() - (int64_t)residentSize;
+		}
+
+		GE_INFO("EditorLayer - Asset Pack Load {0}.\n\tMapped : {1}ms, Resident Growth {2} bytes\n\tRead : {3}ms, Resident Growth {4} bytes\n\tPeak Resident : {5} bytes\n\tAssets Raw : {6} bytes, Stored : {7} bytes\n\tDecoded : {8} Assets, {9}ms\n\tInflated : {10} bytes, {11}ms",
+			m_PackBenchmarkRun ? "Complete" : "Failed", m_PackLoadStats.Duration, m_PackLoadStats.ResidentGrowth,
+			m_PackReadTime, m_PackReadResidentGrowth, m_PackLoadStats.PeakResident, m_PackLoadStats.AssetsRaw, m_PackLoadStats.AssetsStored,
+			m_PackDecoded, m_PackDecodeTime, m_PackInflatedBytes, m_PackInflateTime);
+	}
+
 	void EditorLayer::OnEvent(Event& e)
 	{
 		if (!m_ImGUIViewportHovered)
@@ -504,7 +850,7 @@ namespace GE
 				if (control)
 				{
 					if (shift)
-						SerializeRuntimeAssetManager();
+						SerializeRuntimeAssetManager(m_CompressAssetPack, m_ColumnarScenes);
 				}
 			}
 				break;
@@ -637,7 +983,11 @@ namespace GE
 		if (m_ScenePanel)
 			m_ScenePanel->m_SelectedEntityID;
 
-		Project::StartScene(state);
+		Project::StartScene(state, [this](uint32_t loadedCount, uint32_t totalCount)
+			{
+				m_PrefetchLoaded = loadedCount;
+				m_PrefetchTotal = totalCount;
+			});
 
 		if (m_ScenePanel)
 			m_ScenePanel->SetSelected(selectedID);
@@ -877,7 +1227,7 @@ namespace GE
 								});
 						}
 						if (ImGui::MenuItem("Load", "Ctrl+Shift+O")) Application::LoadAppProjectFileDialog();
-						if (ImGui::MenuItem("Export", "Ctrl+Shift+E")) SerializeRuntimeAssetManager();
+						if (ImGui::MenuItem("Export", "Ctrl+Shift+E")) SerializeRuntimeAssetManager(m_CompressAssetPack, m_ColumnarScenes);
 						if (ImGui::MenuItem("Import", "Ctrl+Shift+I")) DeserializeRuntimeAssetManager();
 
 						ImGui::EndMenu();
@@ -968,18 +1318,174 @@ namespace GE
 						const Renderer::Statistics& stats = Renderer::GetStatistics();
 						ImGui::Text("\tDraw Calls - %d", stats.DrawCalls);
 						ImGui::Text("\tSpawn Count - %d", stats.SpawnCount);
+						ImGui::Text("\tDrawn Entities - %d", stats.DrawnCount);
+						ImGui::Text("\tCulled Entities - %d", stats.CulledCount);
 						ImGui::Text("\tVertices - %d", stats.GetTotalVertexCount());
 						ImGui::Text("\tIndices - %d", stats.GetTotalIndexCount());
+						ImGui::Text("\tBatch Capacity - Quad %d, Circle %d, Line %d, Text %d",
+							stats.QuadCapacity, stats.CircleCapacity, stats.LineCapacity, stats.TextCapacity);
+						ImGui::Text("\tCapacity Flushes - %d", stats.CapacityFlushes);
+						ImGui::Text("\tStatic Spawns - %d", stats.StaticSpawnCount);
+						ImGui::Text("\tStatic Bakes - %d", stats.StaticBakes);
+						ImGui::Text("\tOpaque Quads - %d, Translucent Quads - %d", stats.OpaqueCount, stats.TranslucentCount);
+						ImGui::Text("\tOverdraw - %.2fx", stats.Overdraw);
+						ImGui::Text("\tGlyph Cache Hits - %d, Misses - %d, Evictions - %d", stats.GlyphCacheHits, stats.GlyphCacheMisses, stats.GlyphCacheEvictions);
+						ImGui::Text("\tFrame Time - %.3fms", Application::GetTimestep().GetMilliSeconds());
+
+						if (ImGui::Button("Tile Benchmark"))
+							CreateTileBenchmark(scene, 200, 200);
+						ImGui::SameLine();
+						if (ImGui::Checkbox("Static Tiles", &m_TileBenchmarkStatic))
+							SetTileBenchmarkStatic(scene, m_TileBenchmarkStatic);
+
+						if (ImGui::Button("Prefab Benchmark"))
+							SpawnPrefabBenchmark(scene, 10000);
+						ImGui::SameLine();
+						ImGui::Checkbox("Every Frame", &m_PrefabBenchmarkEveryFrame);
+						if (m_PrefabBenchmarkSpawns)
+						{
+							ImGui::Text("\tPrefab Instances - %d, Last Spawn - %.3fms", (uint32_t)m_PrefabBenchmarkInstances, m_PrefabBenchmarkTime);
+						}
+
+						if (ImGui::Button("Creation Benchmark"))
+							CreateEntityBenchmark(100000);
+						if (m_CreateBenchmarkCount)
+						{
+							ImGui::Text("\t%d Entities - CreateEntity %.3fms, CreateEntities %.3fms", m_CreateBenchmarkCount, m_CreateEntityTime, m_CreateEntitiesTime);
+						}
+
+						if (ImGui::Button("Registry Benchmark"))
+							RegistryBenchmark(100000);
+						if (m_RegistryBenchmarkCount)
+						{
+							ImGui::Text("\t%d Assets - Add %.3fms, Indexed Lookup %.3fus, Linear Lookup %.3fus", m_RegistryBenchmarkCount,
+								m_RegistryAddTime, m_RegistryIndexedLookupTime, m_RegistryLinearLookupTime);
+						}
+
+						if (ImGui::Button("Spatial Index Benchmark"))
+							SpatialIndexBenchmark(100000);
+						if (m_SpatialIndexBenchmarkCount)
+						{
+							ImGui::Text("\t%d Entities - Insert %.3fms, Update %.3fms, Query %.3fus", m_SpatialIndexBenchmarkCount,
+								m_SpatialIndexInsertTime, m_SpatialIndexUpdateTime, m_SpatialIndexQueryTime);
+						}
+
+						// Project open, see EditorAssetManager::DeserializeAssetsAsync()
+						if (Ref<EditorAssetManager> assetManager = Project::GetAssetManager<EditorAssetManager>())
+						{
+							const EditorAssetManager::ImportProgress& importProgress = assetManager->GetImportProgress();
+							ImGui::Text("\tImport - %d/%d Decoded Assets, Time to Interactive %.2fms, Import %.2fms", importProgress.Imported, importProgress.Total,
+								importProgress.TimeToInteractive, importProgress.ImportTime);
+
+							if (ImGui::Button("Import Benchmark") && assetManager->ImportBenchmark(2000, m_ImportSerialTime, m_ImportParallelTime))
+								m_ImportBenchmarkCount = 2000;
+							if (m_ImportBenchmarkCount)
+							{
+								ImGui::Text("\t%d Assets - Serial %.3fms, Workers %.3fms", m_ImportBenchmarkCount, m_ImportSerialTime, m_ImportParallelTime);
+							}
+						}
 
 						ImGui::TreePop();
 					}
 
 					ImGui::Separator();
 
+					const std::string mStr = std::string("Memory");
+					if (ImGui::TreeNodeEx((void*)(uint64_t)m_MID, treeNodeFlags, mStr.c_str()))
+					{
+						ImGui::Checkbox("Compress Asset Pack", &m_CompressAssetPack);
+						ImGui::Checkbox("Columnar Scenes", &m_ColumnarScenes);
+						if (ImGui::Button("Pack Load Benchmark"))
+							PackLoadBenchmark();
+						if (m_PackBenchmarkRun)
+						{
+							const float mb = 1024.0f * 1024.0f;
+							ImGui::Text("\tMapped %.2fMB - %.3fms, Copied %.2fMB, Resident +%.2fMB, Peak %.2fMB", m_PackLoadStats.Mapped / mb, m_PackLoadStats.Duration,
+								m_PackLoadStats.Copied / mb, m_PackLoadStats.ResidentGrowth / mb, m_PackLoadStats.PeakResident / mb);
+							ImGui::Text("\tRead Whole - %.3fms, Resident +%.2fMB", m_PackReadTime, m_PackReadResidentGrowth / mb);
+							ImGui::Text("\tAssets Raw %.2fMB, Stored %.2fMB - Decoded %d in %.3fms, Inflated %.2fMB in %.3fms", m_PackLoadStats.AssetsRaw / mb,
+								m_PackLoadStats.AssetsStored / mb, m_PackDecoded, m_PackDecodeTime, m_PackInflatedBytes / mb, m_PackInflateTime);
+						}
+						const uint32_t generatedFonts = FontStats::Generated;
+						const uint32_t bakedFonts = FontStats::Baked;
+						ImGui::Text("\tFonts Generated - %d, %.3fms avg. Baked - %d, %.3fms avg", generatedFonts,
+							generatedFonts ? FontStats::GeneratedMicroseconds / (1000.0f * generatedFonts) : 0.0f,
+							bakedFonts, bakedFonts ? FontStats::BakedMicroseconds / (1000.0f * bakedFonts) : 0.0f);
+						if (Ref<AssetManager> assetManager = Project::GetAssetManager())
+						{
+							const AssetResidency& residency = assetManager->GetResidency();
+							const float mb = 1024.0f * 1024.0f;
+							for (const auto& [type, budget] : residency.GetBudgets())
+							{
+								Asset::MemoryUsage total = Asset::MemoryUsage();
+								auto totalIt = residency.GetTotals().find(type);
+								if (totalIt != residency.GetTotals().end())
+									total = totalIt->second;
+								ImGui::Text("\t%s - CPU %.2f/%.0fMB, GPU %.2f/%.0fMB", AssetUtils::AssetTypeToString(type).c_str(),
+									total.CPU / mb, budget.CPU / mb, total.GPU / mb, budget.GPU / mb);
+							}
+							ImGui::Text("\tEvictions - %llu, Trims - %llu", residency.GetStats().Evictions, residency.GetStats().Trims);
+							ImGui::Text("\tBuffer Copies - %llu, %.2fMB", (uint64_t)BufferStats::Copies, BufferStats::CopiedBytes / mb);
+							ImGui::Text("\tResident - %.2fMB, Peak %.2fMB", ProcessMemory::GetResidentSize() / mb, ProcessMemory::GetPeakResidentSize() / mb);
+
+							for (const auto& [handle, entry] : residency.GetEntries())
+							{
+								ImGui::Text("\t%llu %s - CPU %.2fMB, GPU %.2fMB, %s%s%s, Idle %llu updates", (uint64_t)handle, AssetUtils::AssetTypeToString(entry.Type).c_str(),
+									entry.Usage.CPU / mb, entry.Usage.GPU / mb, entry.Referenced ? "Referenced" : "Unreferenced", entry.Shared ? ", Shared" : "", entry.Trimmed ? ", Trimmed" : "",
+									residency.GetFrame() - entry.LastUsed);
+							}
+						}
+						ImGui::TreePop();
+					}
+
+					ImGui::Separator();
+
 					const std::string sStr = std::string("Scene");
 					if (ImGui::TreeNodeEx((void*)(uint64_t)m_SID, treeNodeFlags, sStr.c_str()))
 					{
 						ImGui::DragInt("Step Rate", &m_StepFrameMultiplier);
+						// 0 loads Scenes in one frame, see Project::SetSceneLoadBudget()
+						float loadBudget = Project::GetSceneLoadBudget();
+						if (ImGui::DragFloat("Load Budget (ms)", &loadBudget, 0.1f, 0.0f, 100.0f))
+							Project::SetSceneLoadBudget(loadBudget);
+
+						// 0 Cell Size keeps every Entity loaded, see ScenePartition
+						ScenePartition::Config partitionConfig = Project::GetWorldPartition();
+						bool partitionChanged = ImGui::DragFloat("Partition Cell Size", &partitionConfig.CellSize, 1.0f, 0.0f, 10000.0f);
+						int loadRadius = (int)partitionConfig.LoadRadius;
+						int unloadRadius = (int)partitionConfig.UnloadRadius;
+						partitionChanged |= ImGui::DragInt("Load Radius", &loadRadius, 1.0f, 0, 64);
+						partitionChanged |= ImGui::DragInt("Unload Radius", &unloadRadius, 1.0f, 1, 65);
+						if (partitionChanged)
+						{
+							partitionConfig.LoadRadius = (uint32_t)std::max(loadRadius, 0);
+							partitionConfig.UnloadRadius = (uint32_t)std::max(unloadRadius, loadRadius + 1);
+							Project::SetWorldPartition(partitionConfig);
+						}
+
+						if (const ScenePartition* partition = scene ? scene->GetPartition() : nullptr)
+						{
+							const ScenePartition::Statistics& stats = partition->GetStats();
+							ImGui::Text("\tCells - Loaded %d, Loading %d, Unloaded %d", stats.LoadedCells, stats.LoadingCells, stats.UnloadedCells);
+							ImGui::Text("\tResident Entities - %d, Sections %.2fKB", stats.ResidentEntities, stats.SectionSize / 1024.0f);
+							ImGui::Text("\tLoads - %d, Unloads - %d, Failed - %d", stats.Loads, stats.Unloads, stats.FailedLoads);
+							for (const auto& [key, cell] : partition->GetCells())
+							{
+								ImGui::Text("\t(%d, %d) %d Entities - Resident %.2fKB, Section %.2fKB, Load %.2fms (%.2fms main), Unload %.2fms",
+									cell.Coord.x, cell.Coord.y, cell.EntityCount, cell.ResidentSize / 1024.0f, cell.SectionSize / 1024.0f,
+									cell.LoadTime, cell.InstantiateTime, cell.UnloadTime);
+							}
+						}
+
+						// Binary cache & YAML paths, see EditorAssetManager::DeserializeScene()
+						if (Ref<EditorAssetManager> assetManager = Project::GetAssetManager<EditorAssetManager>())
+						{
+							const EditorAssetManager::SceneFileStats fileStats = assetManager->GetSceneFileStats();
+							ImGui::Text("\tCache Loads - %d, Last %.2fms", fileStats.CacheLoads, fileStats.CacheLoadTime);
+							ImGui::Text("\tYAML Loads - %d, Last %.2fms", fileStats.YAMLLoads, fileStats.YAMLLoadTime);
+							ImGui::Text("\tSaves - %d, Pending %d, Last Cache %.2fms, YAML %.2fms, Blocking %.2fms", fileStats.Saves, fileStats.PendingSaves,
+								fileStats.CacheSaveTime, fileStats.YAMLSaveTime, fileStats.SaveBlockingTime);
+						}
 						ImGui::Separator();
 						{
 							const std::string str = std::string("Pivot");
@@ -1101,6 +1607,39 @@ namespace GE
 
 		if (ImGui::Begin("Scene Toolbar", nullptr, toolbarFlags) && scene)
 		{
+			// Textures, Fonts & Audio are created over several frames after the project opens
+			Ref<EditorAssetManager> assetManager = Project::GetAssetManager<EditorAssetManager>();
+			if (assetManager && assetManager->IsImporting())
+			{
+				const EditorAssetManager::ImportProgress& importProgress = assetManager->GetImportProgress();
+				const float fraction = importProgress.Total ? (float)importProgress.Imported / (float)importProgress.Total : 1.0f;
+				const std::string overlay = std::string("Importing Assets ") + std::to_string(importProgress.Imported) + "/" + std::to_string(importProgress.Total);
+				ImGui::ProgressBar(fraction, ImVec2(200.0f, 20.0f), overlay.c_str());
+				ImGui::End();
+				return;
+			}
+
+			// Scene fills over several frames, see Project::SetSceneLoadBudget()
+			if (Project::IsSceneLoading())
+			{
+				const auto [loadedCount, totalCount] = Project::GetSceneLoadProgress();
+				const float fraction = totalCount ? (float)loadedCount / (float)totalCount : 1.0f;
+				const std::string overlay = std::string("Loading Scene ") + std::to_string(loadedCount) + "/" + std::to_string(totalCount);
+				ImGui::ProgressBar(fraction, ImVec2(200.0f, 20.0f), overlay.c_str());
+				ImGui::End();
+				return;
+			}
+
+			// Scene starts once its Assets are loaded, see Project::StartScene()
+			if (Project::IsScenePrefetching())
+			{
+				const float fraction = m_PrefetchTotal ? (float)m_PrefetchLoaded / (float)m_PrefetchTotal : 1.0f;
+				const std::string overlay = std::string("Loading Assets ") + std::to_string(m_PrefetchLoaded) + "/" + std::to_string(m_PrefetchTotal);
+				ImGui::ProgressBar(fraction, ImVec2(200.0f, 20.0f), overlay.c_str());
+				ImGui::End();
+				return;
+			}
+
 			// Stop <-> Run
 			if (!scene->IsPaused())
 			{
@@ -1108,7 +1647,7 @@ namespace GE
 
 				// Scene Runtime Start & Stop
 				Scene::State handledState = Scene::State::Run;
-				Ref<Texture2D> playStopButtonTexture = Project::GetAsset<Texture2D>(currentState == handledState ? m_StopButtonHandle : m_PlayButtonHandle);
+				Ref<Texture2D> playStopButtonTexture = Project::GetAssetAsync<Texture2D>(currentState == handledState ? m_StopButtonHandle : m_PlayButtonHandle);
 
 				ImGui::SameLine();
 				if (playStopButtonTexture && ImGui::ImageButton((ImTextureID)(uint64_t)playStopButtonTexture->GetID(), ImVec2(20.0f, 20.0f)))
@@ -1125,7 +1664,7 @@ namespace GE
 				// Run
 				Scene::State handledState = Scene::State::Run;
 
-				Ref<Texture2D> playPauseButtonTexture = Project::GetAsset<Texture2D>(currentState == handledState ? m_PauseButtonHandle : m_PlayButtonHandle);
+				Ref<Texture2D> playPauseButtonTexture = Project::GetAssetAsync<Texture2D>(currentState == handledState ? m_PauseButtonHandle : m_PlayButtonHandle);
 
 				ImGui::SameLine();
 				if (playPauseButtonTexture && ImGui::ImageButton((ImTextureID)(uint64_t)playPauseButtonTexture->GetID(), ImVec2(20.0f, 20.0f)))
@@ -1136,7 +1675,7 @@ namespace GE
 				// Step Pause
 				if (scene->IsPaused())
 				{
-					Ref<Texture2D> stepButtonTexture = Project::GetAsset<Texture2D>(m_StepButtonHandle);
+					Ref<Texture2D> stepButtonTexture = Project::GetAssetAsync<Texture2D>(m_StepButtonHandle);
 					ImGui::SameLine();
 					if (stepButtonTexture && ImGui::ImageButton((ImTextureID)(uint64_t)stepButtonTexture->GetID(), ImVec2(20.0f, 20.0f)))
 						Project::StepScene(m_StepFrameMultiplier); // Adds step frames to queue. Handled in Scene::OnPauseUpdate.
@@ -4,6 +4,8 @@
 #include "../../ImGUIPanels/SceneHierarchyPanel.h"
 #include "../../ImGUIPanels/AssetPanel.h"
 
+#include <GE/Asset/RuntimeAssetManager.h>
+#include <GE/Asset/Assets/Prefab/Prefab.h>
 #include <GE/Core/Application/Layer/Layer.h>
 
 namespace GE
@@ -47,6 +49,52 @@ namespace GE
 		*/
 		void LoadScene(UUID handle = 0);
 
+		/*
+		* Creates a parent Entity with width * height unit sprite tiles as children.
+		* Compares per-frame cost of static & dynamic sprites, see SpriteRendererComponent::Static.
+		* Replaces previous tiles.
+		*
+		* @param scene : scene to create tiles in
+		* @param width : tiles along x
+		* @param height : tiles along y
+		*/
+		void CreateTileBenchmark(Ref<Scene> scene, uint32_t width, uint32_t height);
+		void SetTileBenchmarkStatic(Ref<Scene> scene, bool isStatic);
+		/*
+		* Instantiates count copies of a sprite Prefab with one child on a grid, timing Prefab::Instantiate().
+		* Each spawn is placed above the previous one.
+		*
+		* @param scene : scene to spawn instances in
+		* @param count : instances per spawn
+		*/
+		void SpawnPrefabBenchmark(Ref<Scene> scene, uint32_t count);
+		/*
+		* Times creating count Entities one at a time & with Scene::CreateEntities(), each in an empty Scene
+		*
+		* @param count : Entities per path
+		*/
+		void CreateEntityBenchmark(uint32_t count);
+		/*
+		* Times filling an AssetRegistry with count entries, then path lookups through its index & by scanning every entry
+		*
+		* @param count : registry entries
+		*/
+		void RegistryBenchmark(uint32_t count);
+		/*
+		* Times inserting count unit bounds on a grid into a SceneSpatialIndex, moving every one outside of its fattened bounds, then camera sized QueryAABB()s
+		*
+		* @param count : indexed entities
+		*/
+		void SpatialIndexBenchmark(uint32_t count);
+		/*
+		* Loads the exported .gap with a RuntimeAssetManager, see RuntimeAssetManager::LoadStatistics.
+		* Decodes its Assets, see FontStats & CompressionStats.
+		* Then times reading the whole file into memory, how packs were read before being mapped.
+		* Reverts to EditorAssetManager after complete
+		* The OS file cache is warm after an export, clear it beforehand to time loading from disk
+		*/
+		void PackLoadBenchmark();
+
 		// ImGUI 
 		uint32_t ImGUI_WidgetID() const;
 
@@ -77,6 +125,52 @@ namespace GE
 		float m_CircleColliderFade = 0.95f;
 		
 		int m_StepFrameMultiplier = 1;
+		// See Project::StartScene()
+		uint32_t m_PrefetchLoaded = 0;
+		uint32_t m_PrefetchTotal = 0;
+
+		UUID m_TileBenchmarkID = 0;
+		bool m_TileBenchmarkStatic = true;
+		// Built on first spawn, see SpawnPrefabBenchmark()
+		Ref<Prefab> m_PrefabBenchmark = nullptr;
+		// Spawns every frame while set
+		bool m_PrefabBenchmarkEveryFrame = false;
+		uint32_t m_PrefabBenchmarkSpawns = 0;
+		uint64_t m_PrefabBenchmarkInstances = 0;
+		// Milliseconds of last spawn
+		float m_PrefabBenchmarkTime = 0.0f;
+		// See CreateEntityBenchmark(), milliseconds per path
+		uint32_t m_CreateBenchmarkCount = 0;
+		float m_CreateEntityTime = 0.0f;
+		float m_CreateEntitiesTime = 0.0f;
+		// See RegistryBenchmark(), milliseconds to add & microseconds per lookup
+		uint32_t m_RegistryBenchmarkCount = 0;
+		float m_RegistryAddTime = 0.0f;
+		float m_RegistryIndexedLookupTime = 0.0f;
+		float m_RegistryLinearLookupTime = 0.0f;
+		// See SpatialIndexBenchmark(), milliseconds to insert & update all, microseconds per query
+		uint32_t m_SpatialIndexBenchmarkCount = 0;
+		float m_SpatialIndexInsertTime = 0.0f;
+		float m_SpatialIndexUpdateTime = 0.0f;
+		float m_SpatialIndexQueryTime = 0.0f;
+		// See EditorAssetManager::ImportBenchmark(), milliseconds per path
+		uint32_t m_ImportBenchmarkCount = 0;
+		float m_ImportSerialTime = 0.0f;
+		float m_ImportParallelTime = 0.0f;
+		// See PackLoadBenchmark(), milliseconds & resident bytes gained reading the whole pack
+		bool m_PackBenchmarkRun = false;
+		RuntimeAssetManager::LoadStatistics m_PackLoadStats = RuntimeAssetManager::LoadStatistics();
+		float m_PackReadTime = 0.0f;
+		int64_t m_PackReadResidentGrowth = 0;
+		// Milliseconds to decode every Asset, part of which inflating compressed payloads
+		uint32_t m_PackDecoded = 0;
+		float m_PackDecodeTime = 0.0f;
+		uint64_t m_PackInflatedBytes = 0;
+		float m_PackInflateTime = 0.0f;
+		// See RuntimeAssetManager::SetCompression()
+		bool m_CompressAssetPack = true;
+		// See RuntimeAssetManager::SetColumnarScenes()
+		bool m_ColumnarScenes = true;
 
 		Ref<SceneHierarchyPanel> m_ScenePanel = nullptr;
 		Ref<AssetPanel> m_AssetPanel = nullptr;
@@ -103,6 +197,7 @@ namespace GE
 		UUID m_AID = UUID();
 		UUID m_ECID = UUID();
 		UUID m_RSID = UUID();
+		UUID m_MID = UUID();
 		UUID m_SID = UUID();
 		UUID m_PID = UUID();
 		UUID m_CID = UUID();
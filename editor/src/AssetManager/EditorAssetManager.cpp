@@ -4,11 +4,16 @@
 #include "../Application/Layer/EditorLayerStack.h"
 
 #include <GE/GE.h>
+#include <GE/Core/FileSystem/MappedFile.h>
 
 #include <al.h>
 #include <stb_image/stb_image.h>
 #include <yaml-cpp/yaml.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 namespace YAML {
 
 	template<>
@@ -127,7 +132,113 @@ namespace GE
 {
 #pragma region Entity
 	
-	static void SerializeEntity(YAML::Emitter& out, Ref<Scene> scene, const Entity& entity)
+	/*
+	* Returns sequence of Name, Type & Data per instance field of component's Script. Null Node if it has none
+	*
+	* @param entityID : UUID of Entity owning component, fields are looked up on Scripting
+	*/
+	static YAML::Node SerializeScriptFields(const ScriptComponent& component, UUID entityID)
+	{
+		YAML::Node fields = YAML::Node();
+		if (!Scripting::ScriptExists(component.AssetHandle))
+			return fields;
+
+		Ref<Script> script = Scripting::GetScript(component.AssetHandle);
+		ScriptFieldMap& instanceFields = Scripting::GetEntityFields(entityID);
+		for (const auto& [name, instanceField] : instanceFields)
+		{
+			if (!script->FieldExists(name))
+				continue;
+
+			ScriptField::Type type = instanceField.GetType();
+			YAML::Node field = YAML::Node(); // InstanceScriptFields
+			field["Name"] = name;
+			field["Type"] = Scripting::ScriptFieldTypeToString(type);
+
+			switch (type)
+			{
+			case ScriptField::Type::Char:
+				field["Data"] = instanceField.GetValue<char>();
+				break;
+			case ScriptField::Type::Int:
+				field["Data"] = instanceField.GetValue<int>();
+				break;
+			case ScriptField::Type::UInt:
+				field["Data"] = instanceField.GetValue<uint32_t>();
+				break;
+			case ScriptField::Type::Float:
+				field["Data"] = instanceField.GetValue<float>();
+				break;
+			case ScriptField::Type::Byte:
+				field["Data"] = instanceField.GetValue<int8_t>();
+				break;
+			case ScriptField::Type::Bool:
+				field["Data"] = instanceField.GetValue<bool>();
+				break;
+			case ScriptField::Type::Vector2:
+				field["Data"] = instanceField.GetValue<glm::vec2>();
+				break;
+			case ScriptField::Type::Vector3:
+				field["Data"] = instanceField.GetValue<glm::vec3>();
+				break;
+			case ScriptField::Type::Vector4:
+				field["Data"] = instanceField.GetValue<glm::vec4>();
+				break;
+			case ScriptField::Type::Entity:
+				field["Data"] = instanceField.GetValue<UUID>();
+				break;
+			}
+
+			fields.push_back(field);
+		}
+		return fields;
+	}
+
+	/*
+	* Main thread state read by SerializeEntity(), captured so Scenes can be emitted on a worker thread
+	*/
+	struct SerializeEntityContext
+	{
+		// <Entity UUID, SerializeScriptFields()>
+		std::unordered_map<uint64_t, YAML::Node> ScriptFields = std::unordered_map<uint64_t, YAML::Node>();
+		// <Tag ID, Tag>, see Project::GetTags()
+		std::map<uint32_t, std::string> Tags = std::map<uint32_t, std::string>();
+		// <Layer::ID, Layer Name> of existing Layers, see EditorLayerStack
+		std::map<uint64_t, std::string> LayerNames = std::map<uint64_t, std::string>();
+	};
+
+	/*
+	* Captures Scripting, Project Tags & EditorLayerStack state used by SerializeEntity(). Main thread only
+	*
+	* @param scene : Scene whose Script fields are captured
+	*/
+	static Ref<SerializeEntityContext> CaptureSerializeEntityContext(Ref<Scene> scene)
+	{
+		Ref<SerializeEntityContext> context = CreateRef<SerializeEntityContext>();
+		for (Entity entity : scene->GetAllEntitiesWith<ScriptComponent>())
+		{
+			const UUID entityID = scene->GetComponent<IDComponent>(entity).ID;
+			YAML::Node fields = SerializeScriptFields(scene->GetComponent<ScriptComponent>(entity), entityID);
+			if (fields.size())
+				context->ScriptFields.emplace(entityID, fields);
+		}
+
+		context->Tags = Project::GetTags();
+
+		Ref<EditorLayerStack> els = Application::GetLayerStack<EditorLayerStack>();
+		for (const auto& [id, layer] : Application::GetLayers())
+		{
+			if (layer)
+				context->LayerNames.emplace(id, els->GetLayerName(id));
+		}
+		return context;
+	}
+
+	/*
+	* @param context : Set when serializing off the main thread, see CaptureSerializeEntityContext().
+	*	Script fields, Tags & Layers are looked up on Scripting, Project & EditorLayerStack otherwise
+	*/
+	static void SerializeEntity(YAML::Emitter& out, Ref<Scene> scene, const Entity& entity, const SerializeEntityContext* context = nullptr)
 	{
 		GE_CORE_ASSERT(scene->HasComponent<IDComponent>(entity), "Cannot serialize Entity without ID.");
 
@@ -141,7 +252,14 @@ namespace GE
 			auto& tc = scene->GetComponent<TagComponent>(entity);
 
 			// TODO : Move TagStrs to EditorProject file. Base Project & Entity only needs the ID
-			out << YAML::Key << "Tag" << YAML::Value << Project::GetStrByTag(tc.TagID).c_str();
+			if (context)
+			{
+				// Same fallback as Project::GetStrByTag(), without registering it
+				auto tagIt = context->Tags.find(tc.TagID);
+				out << YAML::Key << "Tag" << YAML::Value << (tagIt != context->Tags.end() ? tagIt->second : std::string("Default"));
+			}
+			else
+				out << YAML::Key << "Tag" << YAML::Value << Project::GetStrByTag(tc.TagID).c_str();
 			out << YAML::Key << "ID" << YAML::Value << tc.TagID;
 
 			out << YAML::EndMap; // TagComponent
@@ -239,17 +357,28 @@ namespace GE
 
 			out << YAML::Key << "Layers" << YAML::Value;
 			out << YAML::BeginSeq;
-			Ref<EditorLayerStack> els = Application::GetLayerStack<EditorLayerStack>();
+			// Layers are keyed by Layer::ID, see LayerStack
+			Ref<EditorLayerStack> els = context ? nullptr : Application::GetLayerStack<EditorLayerStack>();
 			for (uint64_t id : rc.LayerIDs)
 			{
-				if (Ref<Layer> layer = els->GetLayer(id))
+				std::string name = std::string();
+				if (context)
 				{
-					out << YAML::BeginMap; // LayerID
-					// TODO : Move name to EditorProject file. Entity only needs ID
-					out << YAML::Key << "Name" << YAML::Value << els->GetLayerName(id).c_str();
-					out << YAML::Key << "ID" << YAML::Value << layer->GetID();
-					out << YAML::EndMap; // LayerID
+					auto layerIt = context->LayerNames.find(id);
+					if (layerIt == context->LayerNames.end())
+						continue;
+					name = layerIt->second;
 				}
+				else if (els->GetLayer(id))
+					name = els->GetLayerName(id);
+				else
+					continue;
+
+				out << YAML::BeginMap; // LayerID
+				// TODO : Move name to EditorProject file. Entity only needs ID
+				out << YAML::Key << "Name" << YAML::Value << name;
+				out << YAML::Key << "ID" << YAML::Value << id;
+				out << YAML::EndMap; // LayerID
 			}
 			out << YAML::EndSeq;
 
@@ -293,6 +422,11 @@ namespace GE
 			{
 				out << YAML::Key << "TilingFactor" << YAML::Value << component.TilingFactor;
 			}
+
+			if (component.Static)
+			{
+				out << YAML::Key << "Static" << YAML::Value << component.Static;
+			}
 			out << YAML::EndMap; // SpriteRendererComponent
 		}
 
@@ -512,66 +646,14 @@ namespace GE
 			out << YAML::Key << "AssetHandle" << YAML::Value << component.AssetHandle;
 
 			// Fields
-			if (Scripting::ScriptExists(component.AssetHandle))
-			{
-				Ref<Script> script = Scripting::GetScript(component.AssetHandle);
-				ScriptFieldMap& instanceFields = Scripting::GetEntityFields(scene->GetComponent<IDComponent>(entity).ID);
-				if (!instanceFields.empty())
-				{
-					out << YAML::Key << "ScriptFields" << YAML::Value;
-					out << YAML::BeginSeq;
-
-					for (const auto& [name, instanceField] : instanceFields)
-					{
-						if (!script->FieldExists(name))
-							continue;
-
-						ScriptField::Type type = instanceField.GetType();
-						out << YAML::BeginMap; // InstanceScriptFields
-
-						out << YAML::Key << "Name" << YAML::Value << name;
-						out << YAML::Key << "Type" << YAML::Value << Scripting::ScriptFieldTypeToString(type);
-						out << YAML::Key << "Data" << YAML::Value;
-
-						switch (type)
-						{
-						case ScriptField::Type::Char:
-							out << instanceField.GetValue<char>();
-							break;
-						case ScriptField::Type::Int:
-							out << instanceField.GetValue<int>();
-							break;
-						case ScriptField::Type::UInt:
-							out << instanceField.GetValue<uint32_t>();
-							break;
-						case ScriptField::Type::Float:
-							out << instanceField.GetValue<float>();
-							break;
-						case ScriptField::Type::Byte:
-							out << instanceField.GetValue<int8_t>();
-							break;
-						case ScriptField::Type::Bool:
-							out << instanceField.GetValue<bool>();
-							break;
-						case ScriptField::Type::Vector2:
-							out << instanceField.GetValue<glm::vec2>();
-							break;
-						case ScriptField::Type::Vector3:
-							out << instanceField.GetValue<glm::vec3>();
-							break;
-						case ScriptField::Type::Vector4:
-							out << instanceField.GetValue<glm::vec4>();
-							break;
-						case ScriptField::Type::Entity:
-							out << instanceField.GetValue<UUID>();
-							break;
-						}
-
-						out << YAML::EndMap; // InstanceScriptFields
-					}
-					out << YAML::EndSeq;
-				}
-			}
+			const uint64_t entityID = scene->GetComponent<IDComponent>(entity).ID;
+			YAML::Node fields = YAML::Node();
+			if (!context)
+				fields = SerializeScriptFields(component, entityID);
+			else if (context->ScriptFields.find(entityID) != context->ScriptFields.end())
+				fields = context->ScriptFields.at(entityID);
+			if (fields.size())
+				out << YAML::Key << "ScriptFields" << YAML::Value << fields;
 			out << YAML::EndMap; // ScriptComponent
 		}
 #pragma endregion
@@ -784,6 +866,9 @@ namespace GE
 
 			if (auto& tilingFactor = spriteRendererComponent["TilingFactor"])
 				src.TilingFactor = tilingFactor.as<float>();
+
+			if (auto& isStatic = spriteRendererComponent["Static"])
+				src.Static = isStatic.as<bool>();
 		}
 
 		// CircleRendererComponent
@@ -1216,18 +1301,65 @@ namespace GE
 		return true;
 	}
 
+	/*
+	* Creates & deserializes each Entity of entities in scene
+	*/
+	static void DeserializeEntities(Ref<Scene> scene, const YAML::Node& entities)
+	{
+		for (auto& entityDetails : entities)
+		{
+			// ID Component 
+			UUID uuid = 0;
+			if(auto& entityUUID = entityDetails["Entity"])
+				uuid = entityUUID.as<UUID>();
+
+			// TagComponent
+			std::string tagStr = std::string();
+			uint32_t tcID = 0;
+			if(auto& tc = entityDetails["TagComponent"])
+			{
+				if(auto& tag = tc["Tag"])
+					tagStr = tag.as<std::string>();
+				if(auto& tagID = tc["ID"])
+					tcID = tagID.as<uint32_t>();
+				if (!tagStr.empty())
+					Project::AddTag(tagStr, tcID);
+			}
+
+			// NameComponent
+			if (auto& nc = entityDetails["NameComponent"])
+			{
+				std::string name = std::string("New Entity");
+				if(auto& entityName = nc["Name"])
+					name = entityName.as<std::string>();
+
+				Entity deserializedEntity = scene->CreateEntityWithUUID(uuid, name, tcID);
+				if (DeserializeEntity(scene, entityDetails, deserializedEntity))
+					GE_TRACE("UUID : {0},\n\tTag : {1}\n\tName : {2}", (uint64_t)uuid, Project::GetStrByTag(scene->GetComponent<TagComponent>(deserializedEntity).TagID).c_str(), name.c_str());
+				else
+					GE_ERROR("Failed to Deserialize Entity.");
+			}
+		}
+	}
+
 #pragma endregion
 
 #pragma region Font
 
+	/*
+	* Worker thread safe, atlas Texture is created from atlasData by the caller
+	*
+	* @param textureConfig : of atlas Texture
+	* @param atlasData : replaced with atlas pixels
+	*/
 	template<typename T, typename S, int N, msdf_atlas::GeneratorFunction<S, N> func>
-	static void LoadFontAtlas(const std::filesystem::path& filePath, Font::AtlasConfig& atlasConfig, Ref<Font::MSDFData> msdfData)
+	static bool LoadFontAtlas(const std::filesystem::path& filePath, Font::AtlasConfig& atlasConfig, Ref<Font::MSDFData> msdfData, Texture::Config& textureConfig, ScopedBuffer& atlasData)
 	{
 		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
 		if (!ft)
 		{
 			GE_ERROR("Failed to load Font Freetype Handle");
-			return;
+			return false;
 		}
 
 		std::filesystem::path path = Project::GetPathToAsset(filePath);
@@ -1235,7 +1367,8 @@ namespace GE
 		if (!font)
 		{
 			GE_ERROR("Failed to load Font Atlas.");
-			return;
+			deinitializeFreetype(ft);
+			return false;
 		}
 
 		struct CharsetRange
@@ -1309,16 +1442,14 @@ namespace GE
 		}
 
 		msdfgen::BitmapConstRef<T, N> bitmap = atlasGenerator.atlasStorage();
-		Texture::Config config = Texture::Config(bitmap.width, bitmap.height, 0, false);
-		config.InternalFormat = Texture::ImageFormat::RGB8;
-		config.Format = Texture::DataFormat::RGB;
-
-		Buffer dataBuffer((void*)bitmap.pixels,
-			bitmap.height * bitmap.width * (config.InternalFormat == Texture::ImageFormat::RGB8 ? 3 : 4));
-		Ref<Texture2D> texture = Texture2D::Create(0, config, dataBuffer);
-		dataBuffer.Release();
-
-		atlasConfig.Texture = texture;
+		textureConfig = Texture::Config(bitmap.width, bitmap.height, 0, false);
+		textureConfig.InternalFormat = Texture::ImageFormat::RGB8;
+		textureConfig.Format = Texture::DataFormat::RGB;
+
+		// Generator storage is freed on return
+		atlasData = ScopedBuffer::Copy(bitmap.pixels,
+			bitmap.height * bitmap.width * (textureConfig.InternalFormat == Texture::ImageFormat::RGB8 ? 3 : 4));
+		return (bool)atlasData;
 	}
 
 #pragma endregion
@@ -1328,21 +1459,21 @@ namespace GE
 	/*
 	* Expects full filePath
 	*/
-	static GE::Buffer LoadTextureDataFromFile(const std::string& filePath, int& width, int& height, int& channels)
+	static GE::ScopedBuffer LoadTextureDataFromFile(const std::string& filePath, int& width, int& height, int& channels)
 	{
 		GE_PROFILE_SCOPE("stbi_load - LoadTextureDataFromFile()");
 		stbi_set_flip_vertically_on_load(1);
 		// Size assumed 1 byte per channel
 		uint8_t* data = stbi_load(filePath.c_str(), &width, &height, &channels, 0);
 		GE_CORE_ASSERT(data, "Failed to load stb_image!");
-		GE::Buffer dataBuffer = GE::Buffer(data, width * height * channels);
-		delete[] data;
-		return dataBuffer;
+		// stbi allocates with malloc, taken as is
+		return GE::ScopedBuffer::Adopt(data, (size_t)width * height * channels);
 	}
 
 #pragma endregion
 
 	AssetMetadata EditorAssetManager::s_NullMetadata = AssetMetadata();
+	const float EditorAssetManager::s_ImportBudget = 8.0f;
 
 	std::map<Pivot, std::string> EditorAssetManager::s_PivotStrs = 
 	{
@@ -1390,10 +1521,16 @@ namespace GE
 	EditorAssetManager::EditorAssetManager(const AssetMap& assetMap /*= AssetMap()*/) : m_LoadedAssets(assetMap)
 	{
 		m_AssetRegistry = CreateRef<AssetRegistry>();
+		m_SceneSaveState = CreateRef<SceneSaveState>();
+		m_ImportState = CreateRef<ImportState>();
+		m_ImportState->Manager = this;
 	}
 
 	EditorAssetManager::~EditorAssetManager()
 	{
+		CancelImport();
+		m_ImportState->Manager = nullptr;
+		WaitForSceneSaves();
 		InvalidateAssets();
 		m_LoadedAssets.clear();
 	}
@@ -1406,6 +1543,31 @@ namespace GE
 		}
 	}
 
+	std::unordered_map<UUID, uint64_t> EditorAssetManager::GetSourceKeys()
+	{
+		std::unordered_map<UUID, uint64_t> sourceKeys = std::unordered_map<UUID, uint64_t>();
+		for (const auto& [handle, metadata] : m_AssetRegistry->GetRegistry())
+		{
+			if (metadata.Type != Asset::Type::Texture2D && metadata.Type != Asset::Type::Font && metadata.Type != Asset::Type::Audio)
+				continue;
+
+			const std::filesystem::path path = Project::GetPathToAsset(metadata.FilePath);
+			std::error_code error;
+			const uint64_t size = std::filesystem::file_size(path, error);
+			if (error)
+				continue;
+			const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, error);
+			if (error)
+				continue;
+
+			const std::string pathString = path.generic_string();
+			const uint64_t key[3] = { CookCache::GetContentHash((const uint8_t*)pathString.data(), pathString.size()),
+				size, (uint64_t)writeTime.time_since_epoch().count() };
+			sourceKeys.emplace(handle, CookCache::GetContentHash((const uint8_t*)key, sizeof(key)));
+		}
+		return sourceKeys;
+	}
+
 	const AssetMetadata& EditorAssetManager::GetMetadata(UUID handle)
 	{
 		if (!HandleExists(handle))
@@ -1421,30 +1583,49 @@ namespace GE
 		Ref<Asset> asset = nullptr;
 		if (HandleExists(handle))
 		{
+			m_Residency.Touch(handle);
 			if (AssetLoaded(handle))
 				asset = m_LoadedAssets.at(handle);
 			else
+			{
+				// Reimported, example after eviction. See UpdateResidency()
 				asset = DeserializeAsset(m_AssetRegistry->GetAssetMetadata(handle));
+				if (asset)
+					m_LoadedAssets[handle] = asset;
+			}
 		}
 		return asset;
 	}
 
-	const AssetMap& EditorAssetManager::GetLoadedAssets()
+	Ref<Asset> EditorAssetManager::GetAssetAsync(UUID handle)
 	{
-		return m_LoadedAssets;
+		if (!AssetLoaded(handle))
+		{
+			auto placeholderIt = m_ImportPlaceholders.find(handle);
+			if (placeholderIt != m_ImportPlaceholders.end())
+				return placeholderIt->second;
+		}
+		return GetAsset(handle);
 	}
 
-	Ref<Asset> EditorAssetManager::GetAsset(const std::filesystem::path& filePath)
+	void EditorAssetManager::UpdateResidency(const std::unordered_set<UUID>& referencedHandles)
 	{
-		UUID assetHandle = 0;
-		const auto& registry = m_AssetRegistry->GetRegistry();
-		for (const auto& [handle, metadata] : registry)
+		AssetResidency::Result result = m_Residency.Update(m_LoadedAssets, referencedHandles, true, false);
+		for (const UUID& handle : result.Evict)
 		{
-			if (metadata.FilePath == filePath)
-				assetHandle = handle;
+			m_LoadedAssets.erase(handle);
+			GE_TRACE("EditorAssetManager::UpdateResidency() Evicted Asset : {0}", (uint64_t)handle);
 		}
+	}
+
+	const AssetMap& EditorAssetManager::GetLoadedAssets()
+	{
+		return m_LoadedAssets;
+	}
 
-		return GetAsset(assetHandle);
+	Ref<Asset> EditorAssetManager::GetAsset(const std::filesystem::path& filePath)
+	{
+		return GetAsset(m_AssetRegistry->GetHandle(filePath));
 	}
 
 	bool EditorAssetManager::HandleExists(UUID handle)
@@ -1507,6 +1688,9 @@ namespace GE
 		case Asset::Type::Scene:
 			return SerializeScene(asset, metadata);
 			break;
+		case Asset::Type::Prefab:
+			return SerializePrefab(asset, metadata);
+			break;
 		default:
 			GE_ERROR("Serialize metadata function not found for Type: " + AssetUtils::AssetTypeToString(metadata.Type));
 			break;
@@ -1537,6 +1721,9 @@ namespace GE
 		case Asset::Type::Script:
 			asset = DeserializeScript(metadata);
 			break;
+		case Asset::Type::Prefab:
+			asset = DeserializePrefab(metadata);
+			break;
 		default:
 			GE_ERROR("Deserialize metadata function not found for Type: {0}", AssetUtils::AssetTypeToString(metadata.Type));
 			return nullptr;
@@ -1568,6 +1755,10 @@ namespace GE
 			Ref<Asset> asset = ((AssetLoaded(handle) && m_LoadedAssets.at(handle)->GetType() != Asset::Type::Scene) 
 				? m_LoadedAssets.at(handle) : Project::GetRuntimeScene());
 
+			// Evicted Assets keep their source file, never overwrite it with the Scene
+			if (asset && asset->GetType() != metadata.Type)
+				continue;
+
 			SerializeAsset(asset, metadata);
 		}
 
@@ -1609,8 +1800,9 @@ namespace GE
 		return false;
 	}
 
-	bool EditorAssetManager::DeserializeAssets()
+	bool EditorAssetManager::DeserializeRegistry()
 	{
+		CancelImport();
 		m_LoadedAssets.clear();
 		m_LoadedAssets = AssetMap();
 		m_AssetRegistry->Clear();
@@ -1647,19 +1839,492 @@ namespace GE
 			if (!m_AssetRegistry->AddAsset(assetMetadata))
 				GE_WARN("Failed to add Asset::{0} : {1}\n\tFilePath : {2}", AssetUtils::AssetTypeToString(assetMetadata.Type).c_str(), (uint64_t)assetMetadata.Handle, assetMetadata.FilePath.string().c_str());
 		}
+		m_ImportStats.clear();
+		return true;
+	}
+
+	EditorAssetManager::SceneFileStats EditorAssetManager::GetSceneFileStats() const
+	{
+		std::lock_guard<std::mutex> lock(m_SceneSaveState->Mutex);
+		return m_SceneSaveState->Stats;
+	}
+
+	void EditorAssetManager::WaitForSceneSaves()
+	{
+		std::unique_lock<std::mutex> lock(m_SceneSaveState->Mutex);
+		m_SceneSaveState->Condition.wait(lock, [this]() { return m_SceneSaveState->Stats.PendingSaves == 0; });
+	}
+
+	void EditorAssetManager::AddImportStats(const AssetMetadata& metadata, float milliseconds)
+	{
+		ImportStats& stats = m_ImportStats[metadata.Type];
+		stats.Count++;
+		stats.Milliseconds += milliseconds;
+
+		// Scripts are compiled into the assembly, they may have no file
+		std::error_code error;
+		const uintmax_t size = std::filesystem::file_size(Project::GetPathToAsset(metadata.FilePath), error);
+		if (!error)
+			stats.Bytes += size;
+	}
+
+	bool EditorAssetManager::DeserializeAssets()
+	{
+		if (!DeserializeRegistry())
+			return false;
 
 		for (const auto& [handle, metadata] : m_AssetRegistry->GetRegistry())
 		{
+			const auto startTime = std::chrono::steady_clock::now();
 			DeserializeAsset(metadata);
+			AddImportStats(metadata, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count());
 		}
 		GE_INFO("Asset Registry Deserialization Complete.");
 		return true;
 	}
 
+	bool EditorAssetManager::DeserializeAssetsParallel()
+	{
+		if (!BeginImport(false))
+			return false;
+
+		FinishImport();
+		return true;
+	}
+
+	bool EditorAssetManager::DeserializeAssetsAsync()
+	{
+		if (!BeginImport(true))
+			return false;
+
+		// First frame records TimeToInteractive, even if nothing is decoded yet
+		SubmitImportUpdate(m_ImportState);
+		return true;
+	}
+
+	void EditorAssetManager::FinishImport()
+	{
+		GE_PROFILE_FUNCTION();
+
+		Ref<ImportState> state = m_ImportState;
+		{
+			std::lock_guard<std::mutex> lock(state->Mutex);
+			state->Async = false;
+		}
+
+		while (m_Importing)
+		{
+			{
+				std::unique_lock<std::mutex> lock(state->Mutex);
+				state->Condition.wait(lock, [&state]() { return !state->Ready.empty(); });
+			}
+			UpdateImport(0.0f);
+		}
+	}
+
+	bool EditorAssetManager::BeginImport(bool async)
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Cancels pending import
+		if (!DeserializeRegistry())
+			return false;
+
+		m_ImportStart = std::chrono::steady_clock::now();
+		m_ImportProgress = ImportProgress();
+
+		Ref<ImportState> state = m_ImportState;
+		const uint64_t generation = state->Generation;
+		{
+			std::lock_guard<std::mutex> lock(state->Mutex);
+			state->Async = async;
+		}
+
+		// Source decodes only, Scripts, Scenes & Prefabs need the calling thread
+		std::vector<const AssetMetadata*> deferred = std::vector<const AssetMetadata*>();
+		for (const auto& [handle, metadata] : m_AssetRegistry->GetRegistry())
+		{
+			switch (metadata.Type)
+			{
+			case Asset::Type::Texture2D:
+			case Asset::Type::Font:
+			case Asset::Type::Audio:
+				m_ImportPlaceholders[handle] = CreateRef<Asset>(handle, metadata.Type, Asset::Status::Loading);
+				m_ImportProgress.Total++;
+				// Copied, Registry may change before it's decoded
+				Application::SubmitToWorkerThread([state, generation, source = metadata]()
+					{
+						const auto startTime = std::chrono::steady_clock::now();
+						ImportState::Decoded decoded = ImportState::Decoded();
+						decoded.Metadata = source;
+						decoded.Generation = generation;
+						switch (source.Type)
+						{
+						case Asset::Type::Texture2D:
+							decoded.Create = DecodeTexture2D(source);
+							break;
+						case Asset::Type::Font:
+							decoded.Create = DecodeFont(source);
+							break;
+						case Asset::Type::Audio:
+							decoded.Create = DecodeAudio(source);
+							break;
+						default:
+							break;
+						}
+						decoded.Milliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+						{
+							std::lock_guard<std::mutex> lock(state->Mutex);
+							state->Ready.push_back(std::move(decoded));
+						}
+						state->Condition.notify_all();
+						SubmitImportUpdate(state);
+					});
+				break;
+			default:
+				deferred.push_back(&metadata);
+				break;
+			}
+		}
+		m_Importing = m_ImportProgress.Total > 0;
+
+		for (const AssetMetadata* metadata : deferred)
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			DeserializeAsset(*metadata);
+			AddImportStats(*metadata, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+		}
+
+		if (!m_Importing)
+		{
+			{
+				std::lock_guard<std::mutex> lock(state->Mutex);
+				state->Async = false;
+			}
+			m_ImportProgress.ImportTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_ImportStart).count();
+			m_ImportProgress.TimeToInteractive = m_ImportProgress.ImportTime;
+		}
+		GE_INFO("Asset Registry Deserialization Started.\n\tDecoding on workers : {0}\n\tImported on calling thread : {1}", m_ImportProgress.Total, deferred.size());
+		return true;
+	}
+
+	void EditorAssetManager::UpdateImport(float budgetMilliseconds)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!m_Importing)
+			return;
+
+		Ref<ImportState> state = m_ImportState;
+		const auto startTime = std::chrono::steady_clock::now();
+		if (state->Async && m_ImportProgress.TimeToInteractive == 0.0f)
+			m_ImportProgress.TimeToInteractive = std::chrono::duration<float, std::milli>(startTime - m_ImportStart).count();
+
+		bool remaining = false;
+		while (true)
+		{
+			ImportState::Decoded decoded = ImportState::Decoded();
+			{
+				std::lock_guard<std::mutex> lock(state->Mutex);
+				if (state->Ready.empty())
+					break;
+				if (budgetMilliseconds > 0.0f 
+					&& std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count() >= budgetMilliseconds)
+				{
+					remaining = true;
+					break;
+				}
+				decoded = std::move(state->Ready.front());
+				state->Ready.pop_front();
+			}
+
+			// Decoded for a cancelled import
+			if (decoded.Generation != state->Generation)
+				continue;
+
+			m_ImportProgress.Imported++;
+			const UUID handle = decoded.Metadata.Handle;
+			Ref<Asset> placeholder = nullptr;
+			auto placeholderIt = m_ImportPlaceholders.find(handle);
+			if (placeholderIt != m_ImportPlaceholders.end())
+			{
+				placeholder = placeholderIt->second;
+				m_ImportPlaceholders.erase(placeholderIt);
+			}
+
+			// GetAsset() may have imported it synchronously meanwhile, or it was removed
+			if (AssetLoaded(handle) || !HandleExists(handle))
+				continue;
+
+			const auto createTime = std::chrono::steady_clock::now();
+			Ref<Asset> asset = decoded.Create ? decoded.Create() : nullptr;
+			if (!asset)
+			{
+				GE_ERROR("Failed to import Asset::{0} : {1}\n\tFilePath : {2}", AssetUtils::AssetTypeToString(decoded.Metadata.Type).c_str(), (uint64_t)handle, decoded.Metadata.FilePath.string().c_str());
+				if (placeholder)
+					placeholder->Invalidate();
+				continue;
+			}
+			AddAsset(asset);
+			AddImportStats(decoded.Metadata, decoded.Milliseconds + std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - createTime).count());
+		}
+
+		if (m_ImportProgress.Imported == m_ImportProgress.Total)
+		{
+			m_Importing = false;
+			m_ImportPlaceholders.clear();
+			{
+				std::lock_guard<std::mutex> lock(state->Mutex);
+				state->Async = false;
+			}
+
+			m_ImportProgress.ImportTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_ImportStart).count();
+			if (m_ImportProgress.TimeToInteractive == 0.0f)
+				m_ImportProgress.TimeToInteractive = m_ImportProgress.ImportTime;
+			GE_INFO("Asset Registry Deserialization Complete.\n\tAssets : {0}\n\tTime to interactive : {1}ms\n\tImport time : {2}ms", 
+				m_AssetRegistry->GetRegistry().size(), m_ImportProgress.TimeToInteractive, m_ImportProgress.ImportTime);
+		}
+		else if (remaining)
+			SubmitImportUpdate(state);
+	}
+
+	void EditorAssetManager::CancelImport()
+	{
+		Ref<ImportState> state = m_ImportState;
+		state->Generation++;
+		{
+			std::lock_guard<std::mutex> lock(state->Mutex);
+			state->Ready.clear();
+			state->Async = false;
+		}
+
+		for (auto& [handle, placeholder] : m_ImportPlaceholders)
+			placeholder->Invalidate();
+		m_ImportPlaceholders.clear();
+		m_Importing = false;
+	}
+
+	void EditorAssetManager::SubmitImportUpdate(Ref<ImportState> state)
+	{
+		{
+			std::lock_guard<std::mutex> lock(state->Mutex);
+			if (!state->Async || state->Scheduled)
+				return;
+			state->Scheduled = true;
+		}
+
+		Application::SubmitToMainAppThread([state]()
+			{
+				{
+					std::lock_guard<std::mutex> lock(state->Mutex);
+					state->Scheduled = false;
+				}
+
+				if (EditorAssetManager* manager = state->Manager)
+					manager->UpdateImport(s_ImportBudget);
+			});
+	}
+
+	bool EditorAssetManager::ImportBenchmark(uint32_t count, float& outSerialTime, float& outParallelTime)
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Pending import would share worker threads
+		FinishImport();
+
+		std::vector<AssetMetadata> sources = std::vector<AssetMetadata>();
+		for (const auto& [handle, metadata] : m_AssetRegistry->GetRegistry())
+		{
+			if (metadata.Type == Asset::Type::Texture2D || metadata.Type == Asset::Type::Font || metadata.Type == Asset::Type::Audio)
+				sources.push_back(metadata);
+		}
+		if (sources.empty() || count == 0)
+		{
+			GE_WARN("EditorAssetManager::ImportBenchmark() Failed - No Textures, Fonts or Audio in Registry.");
+			return false;
+		}
+
+		auto decode = [](const AssetMetadata& metadata) -> std::function<Ref<Asset>()>
+			{
+				switch (metadata.Type)
+				{
+				case Asset::Type::Texture2D:
+					return DecodeTexture2D(metadata);
+				case Asset::Type::Font:
+					return DecodeFont(metadata);
+				case Asset::Type::Audio:
+					return DecodeAudio(metadata);
+				default:
+					break;
+				}
+				return nullptr;
+			};
+
+		// Same as importing before DeserializeAssetsParallel()
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i++)
+			{
+				if (std::function<Ref<Asset>()> create = decode(sources[i % sources.size()]))
+					create();
+			}
+			outSerialTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		}
+
+		// Same as BeginImport(), decoded on workers & created here as they finish
+		{
+			struct Shared
+			{
+				std::mutex Mutex;
+				std::condition_variable Condition;
+				// One per decode, nullptr if decoding failed
+				std::deque<std::function<Ref<Asset>()>> Ready = std::deque<std::function<Ref<Asset>()>>();
+			};
+			Ref<Shared> shared = CreateRef<Shared>();
+
+			const auto startTime = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < count; i++)
+			{
+				Application::SubmitToWorkerThread([shared, decode, source = sources[i % sources.size()]]()
+					{
+						std::function<Ref<Asset>()> create = decode(source);
+						{
+							std::lock_guard<std::mutex> lock(shared->Mutex);
+							shared->Ready.push_back(std::move(create));
+						}
+						shared->Condition.notify_all();
+					});
+			}
+
+			for (uint32_t created = 0; created < count; created++)
+			{
+				std::function<Ref<Asset>()> create = nullptr;
+				{
+					std::unique_lock<std::mutex> lock(shared->Mutex);
+					shared->Condition.wait(lock, [&shared]() { return !shared->Ready.empty(); });
+					create = std::move(shared->Ready.front());
+					shared->Ready.pop_front();
+				}
+				if (create)
+					create();
+			}
+			outParallelTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		}
+
+		GE_INFO("EditorAssetManager - Import Benchmark of {0} Assets from {1} sources.\n\tSerial : {2}ms\n\tWorkers : {3}ms",
+			count, sources.size(), outSerialTime, outParallelTime);
+		return true;
+	}
+
 #pragma region Asset Metadata Serialization
 
+	// SceneCacheFormat, Version 1
+	//	[8] Signature & Version
+	//	[8] YAML Hash		: CookCache::GetContentHash() of .scene file
+	//	[8] YAML Write Time	: std::filesystem::last_write_time() of .scene file, in file clock ticks
+	//	[8] Pack Version	: AssetPack Version the Entities are encoded with
+	//	[8] Tag Count		// Project Tags, the YAML registers them per Entity
+	//	[?] Tags
+	//		[8] ID
+	//		[8 + ?] Tag
+	//	[?] Payload			: See RuntimeAssetManager::EncodeScene()
+	static const char s_SceneCacheSignature[3] = { 'G', 'S', 'C' };
+	static const uint32_t s_SceneCacheVersion = 1;
+
+	static uint64_t GetSceneWriteTime(const std::filesystem::path& scenePath)
+	{
+		std::error_code error;
+		const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(scenePath, error);
+		return error ? 0 : (uint64_t)writeTime.time_since_epoch().count();
+	}
+
+	/*
+	* Registers Tags of a Scene cache with Project, as loading its YAML would
+	* Returns false if Tags exceed end
+	*/
+	static bool ReadSceneCacheTags(const uint8_t*& source, const uint8_t* end)
+	{
+		uint64_t tagCount = 0;
+		if (!ReadAligned(source, end, tagCount))
+			return false;
+
+		for (uint64_t i = 0; i < tagCount; i++)
+		{
+			uint64_t id = 0, size = 0;
+			if (!ReadAligned(source, end, id) || !ReadAligned(source, end, size) || size > (uint64_t)(end - source))
+				return false;
+
+			std::string tag = std::string((const char*)source, size);
+			source += GetAligned(size);
+			if (!tag.empty() && !Project::TagIDExists((uint32_t)id) && !Project::TagExists(tag))
+				Project::AddTag(tag, (uint32_t)id);
+		}
+		return true;
+	}
+
+	std::filesystem::path EditorAssetManager::GetSceneCachePath(const std::filesystem::path& scenePath)
+	{
+		std::filesystem::path cachePath = scenePath;
+		cachePath += "cache";
+		return cachePath;
+	}
+
+	bool EditorAssetManager::WriteSceneCache(const std::filesystem::path& scenePath, const std::string& yaml, const std::map<uint32_t, std::string>& tags, const ScopedBuffer& data)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const uint64_t writeTime = GetSceneWriteTime(scenePath);
+		if (!writeTime || !data)
+			return false;
+
+		uint64_t headerSize = GetAligned(sizeof(s_SceneCacheSignature) + sizeof(s_SceneCacheVersion)) + GetAligned(sizeof(uint64_t)) * 4;
+		for (const auto& [id, tag] : tags)
+			headerSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfArray<char>(tag.size());
+		// Zeroed, pads header
+		Buffer header = Buffer(headerSize);
+		{
+			uint8_t* destination = header.As<uint8_t>();
+			memcpy(destination, s_SceneCacheSignature, sizeof(s_SceneCacheSignature));
+			memcpy(destination + sizeof(s_SceneCacheSignature), &s_SceneCacheVersion, sizeof(s_SceneCacheVersion));
+			destination += GetAligned(sizeof(s_SceneCacheSignature) + sizeof(s_SceneCacheVersion));
+
+			WriteAligned<uint64_t>(destination, CookCache::GetContentHash((const uint8_t*)yaml.data(), yaml.size()));
+			WriteAligned<uint64_t>(destination, writeTime);
+			WriteAligned<uint64_t>(destination, AssetPack::File::Header().Version);
+
+			WriteAligned<uint64_t>(destination, tags.size());
+			for (const auto& [id, tag] : tags)
+			{
+				WriteAligned<uint64_t>(destination, id);
+				const char* tagData = tag.data();
+				WriteAlignedArray<char>(destination, tagData, tag.size());
+			}
+		}
+
+		const std::filesystem::path cachePath = GetSceneCachePath(scenePath);
+		std::ofstream stream(cachePath, std::ios::trunc | std::ios::binary);
+		if (stream)
+		{
+			stream.write(header.As<char>(), header.GetSize());
+			stream.write(data.As<char>(), data.GetSize());
+		}
+		header.Release();
+
+		if (!stream.good())
+		{
+			GE_WARN("Could not write Scene cache.\n\tFilePath : {0}", cachePath.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
 	Ref<Asset> EditorAssetManager::DeserializeScene(const AssetMetadata& metadata)
 	{
+		// Background save may still be writing this file
+		WaitForSceneSaves();
+
+		const auto startTime = std::chrono::steady_clock::now();
 		std::filesystem::path path = Project::GetPathToAsset(metadata.FilePath);
 
 		std::ifstream stream(path);
@@ -1668,10 +2333,49 @@ namespace GE
 		{
 			strStream << stream.rdbuf();
 		}
+		const std::string yaml = strStream.str();
+
+		// Cache is valid only for the exact .scene file it was written after
+		{
+			MappedFile cache = MappedFile();
+			if (!yaml.empty() && cache.Open(GetSceneCachePath(path)))
+			{
+				const uint8_t* source = cache.GetData();
+				const uint8_t* end = source + cache.GetSize();
+				const uint64_t signatureSize = GetAligned(sizeof(s_SceneCacheSignature) + sizeof(s_SceneCacheVersion));
+
+				uint32_t version = 0;
+				uint64_t hash = 0, writeTime = 0, packVersion = 0;
+				if (cache.GetSize() >= signatureSize && memcmp(source, s_SceneCacheSignature, sizeof(s_SceneCacheSignature)) == 0)
+				{
+					memcpy(&version, source + sizeof(s_SceneCacheSignature), sizeof(version));
+					source += signatureSize;
+				}
+
+				if (version == s_SceneCacheVersion && ReadAligned(source, end, hash) && ReadAligned(source, end, writeTime) && ReadAligned(source, end, packVersion)
+					&& packVersion == AssetPack::File::Header().Version && writeTime == GetSceneWriteTime(path)
+					&& hash == CookCache::GetContentHash((const uint8_t*)yaml.data(), yaml.size()) && ReadSceneCacheTags(source, end))
+				{
+					RuntimeAssetManager decoder = RuntimeAssetManager();
+					if (Ref<Scene> scene = decoder.DecodeScene(metadata.Handle, source, end - source))
+					{
+						const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+						{
+							std::lock_guard<std::mutex> lock(m_SceneSaveState->Mutex);
+							m_SceneSaveState->Stats.CacheLoads++;
+							m_SceneSaveState->Stats.CacheLoadTime = duration;
+						}
+						GE_TRACE("Deserialized Scene from cache\n\tUUID : {0}\n\tPath : {1}\n\tDuration : {2}ms", (uint64_t)metadata.Handle, path.string().c_str(), duration);
+						return scene;
+					}
+				}
+			}
+		}
+
 		YAML::Node data;
 		try
 		{
-			data = YAML::Load(strStream.str());
+			data = YAML::Load(yaml);
 		}
 		catch (YAML::ParserException e)
 		{
@@ -1689,69 +2393,96 @@ namespace GE
 			{
 				GE_TRACE("Deserializing Entities");
 
-				for (auto& entityDetails : entities)
-				{
-					// ID Component 
-					UUID uuid = 0;
-					if(auto& entityUUID = entityDetails["Entity"])
-						uuid = entityUUID.as<UUID>();
-
-					// TagComponent
-					std::string tagStr = std::string();
-					uint32_t tcID = 0;
-					if(auto& tc = entityDetails["TagComponent"])
-					{
-						if(auto& tag = tc["Tag"])
-							tagStr = tag.as<std::string>();
-						if(auto& tagID = tc["ID"])
-							tcID = tagID.as<uint32_t>();
-						if (!tagStr.empty())
-							Project::AddTag(tagStr, tcID);
-					}
-
-					// NameComponent
-					if (auto& nc = entityDetails["NameComponent"])
-					{
-						std::string name = std::string("New Entity");
-						if(auto& entityName = nc["Name"])
-							name = entityName.as<std::string>();
+				DeserializeEntities(scene, entities);
+			}
 
-						Entity deserializedEntity = scene->CreateEntityWithUUID(uuid, name, tcID);
-						if (DeserializeEntity(scene, entityDetails, deserializedEntity))
-							GE_TRACE("UUID : {0},\n\tTag : {1}\n\tName : {2}", (uint64_t)uuid, Project::GetStrByTag(scene->GetComponent<TagComponent>(deserializedEntity).TagID).c_str(), name.c_str());
-						else
-							GE_ERROR("Failed to Deserialize Entity.");
-					}
-				}
+			const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+			{
+				std::lock_guard<std::mutex> lock(m_SceneSaveState->Mutex);
+				m_SceneSaveState->Stats.YAMLLoads++;
+				m_SceneSaveState->Stats.YAMLLoadTime = duration;
 			}
 
+			// Missing or stale, next load uses it
+			RuntimeAssetManager encoder = RuntimeAssetManager();
+			ScopedBuffer cacheData = ScopedBuffer();
+			if (encoder.EncodeScene(scene, cacheData))
+				WriteSceneCache(path, yaml, Project::GetTags(), cacheData);
 		}
 		return scene;
 	}
 
 	Ref<Asset> EditorAssetManager::DeserializeTexture2D(const AssetMetadata& metadata)
 	{
-		int width = 0, height = 0, channels = 4;
-		stbi_set_flip_vertically_on_load(1);
-		Buffer data = LoadTextureDataFromFile(Project::GetPathToAsset(metadata.FilePath).string(), width, height, channels);
+		std::function<Ref<Asset>()> create = DecodeTexture2D(metadata);
+		return create ? create() : nullptr;
+	}
 
-		Texture::Config config = Texture::Config(width, height, channels, true);
-		Ref<Texture2D> texture = Texture2D::Create(metadata.Handle, config, data);
-		data.Release();
+	std::function<Ref<Asset>()> EditorAssetManager::DecodeTexture2D(const AssetMetadata& metadata)
+	{
+		int width = 0, height = 0, channels = 4;
+		// Decoding thread loads, creating thread uploads it & Texture keeps it
+		Ref<ScopedBuffer> data = CreateRef<ScopedBuffer>(LoadTextureDataFromFile(Project::GetPathToAsset(metadata.FilePath).string(), width, height, channels));
+		if (!*data)
+			return nullptr;
 
-		return texture;
+		const UUID handle = metadata.Handle;
+		const Texture::Config config = Texture::Config(width, height, channels, true);
+		return [handle, config, data]() -> Ref<Asset>
+			{
+				return Texture2D::Create(handle, config, std::move(*data));
+			};
 	}
 
 	Ref<Asset> EditorAssetManager::DeserializeFont(const AssetMetadata& metadata)
 	{
+		std::function<Ref<Asset>()> create = DecodeFont(metadata);
+		return create ? create() : nullptr;
+	}
+
+	std::function<Ref<Asset>()> EditorAssetManager::DecodeFont(const AssetMetadata& metadata)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
 		Font::AtlasConfig config = Font::AtlasConfig();
 		Ref<Font::MSDFData> data = CreateRef<Font::MSDFData>();
-		LoadFontAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(metadata.FilePath, config, data);
-		Ref<Font> asset = CreateRef<Font>(metadata.Handle, config, data);
-		return asset;
+		Texture::Config textureConfig = Texture::Config();
+		Ref<ScopedBuffer> atlas = CreateRef<ScopedBuffer>();
+		if (!LoadFontAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(metadata.FilePath, config, data, textureConfig, *atlas))
+			return nullptr;
+
+		// Font file data, for glyphs outside of baked charset. See GlyphCache
+		Ref<ScopedBuffer> source = CreateRef<ScopedBuffer>();
+		{
+			const std::filesystem::path filePath = Project::GetPathToAsset(metadata.FilePath);
+			std::ifstream stream(filePath, std::ios::binary | std::ios::ate);
+			if (stream.is_open())
+			{
+				source->Allocate((size_t)stream.tellg());
+				stream.seekg(0, std::ios::beg);
+				stream.read(source->As<char>(), source->GetSize());
+			}
+		}
+		FontStats::AddGenerated((uint64_t)std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+
+		const UUID handle = metadata.Handle;
+		return [handle, config, data, textureConfig, atlas, source]() -> Ref<Asset>
+			{
+				Font::AtlasConfig atlasConfig = config;
+				atlasConfig.Texture = Texture2D::Create(0, textureConfig, std::move(*atlas));
+				Ref<Font> font = CreateRef<Font>(handle, atlasConfig, data);
+				if (*source)
+					font->SetSource(source->GetView());
+				return font;
+			};
 	}
 
 	Ref<Asset> EditorAssetManager::DeserializeAudio(const AssetMetadata& metadata)
+	{
+		std::function<Ref<Asset>()> create = DecodeAudio(metadata);
+		return create ? create() : nullptr;
+	}
+
+	std::function<Ref<Asset>()> EditorAssetManager::DecodeAudio(const AssetMetadata& metadata)
 	{
 		// Read data from filePath
 		{
@@ -1770,59 +2501,59 @@ namespace GE
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read RIFF while loading Wav file.");
-					return false;
+					return nullptr;
 				}
 				if (std::strncmp(data, "RIFF", 4) != 0)
 				{
 					GE_ERROR("File is not a valid WAVE file (header doesn't begin with RIFF)");
-					return false;
+					return nullptr;
 				}
 
 				// the size of the file
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read size of Wav file.");
-					return false;
+					return nullptr;
 				}
 
 				// the WAVE
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read WAVE");
-					return false;
+					return nullptr;
 				}
 				if (std::strncmp(data, "WAVE", 4) != 0)
 				{
 					GE_ERROR("File is not a valid WAVE file (header doesn't contain WAVE)");
-					return false;
+					return nullptr;
 				}
 
 				// "fmt/0"
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read fmt of Wav file.");
-					return false;
+					return nullptr;
 				}
 
 				// this is always 16, the size of the fmt data chunk
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read the size of the fmt data chunk. Should be 16.");
-					return false;
+					return nullptr;
 				}
 
 				// PCM should be 1?
 				if (!stream.read(data, 2))
 				{
 					GE_ERROR("Could not read PCM. Should be 1.");
-					return false;
+					return nullptr;
 				}
 
 				// the number of Channels
 				if (!stream.read(data, 2))
 				{
 					GE_ERROR("Could not read number of Channels.");
-					return false;
+					return nullptr;
 				}
 				uint32_t channels = convert<uint32_t>(data, 2);
 
@@ -1830,7 +2561,7 @@ namespace GE
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read sample rate.");
-					return false;
+					return nullptr;
 				}
 				uint32_t sampleRate = convert<uint32_t>(data, 4);
 
@@ -1838,21 +2569,21 @@ namespace GE
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read (SampleRate * BPS * Channels) / 8");
-					return false;
+					return nullptr;
 				}
 
 				// ?? dafaq
 				if (!stream.read(data, 2))
 				{
 					GE_ERROR("Could not read dafaq?");
-					return false;
+					return nullptr;
 				}
 
 				// BPS
 				if (!stream.read(data, 2))
 				{
 					GE_ERROR("Could not read bits per sample.");
-					return false;
+					return nullptr;
 				}
 				uint32_t bps = convert<uint32_t>(data, 2);
 
@@ -1860,19 +2591,19 @@ namespace GE
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read data chunk header.");
-					return false;
+					return nullptr;
 				}
 				if (std::strncmp(data, "data", 4) != 0)
 				{
 					GE_ERROR("File is not a valid WAVE file (doesn't have 'data' tag).");
-					return false;
+					return nullptr;
 				}
 
 				// size of data
 				if (!stream.read(data, 4))
 				{
 					GE_ERROR("Could not read data size.");
-					return false;
+					return nullptr;
 				}
 				size_t size = convert<uint32_t>(data, 4);
 
@@ -1880,29 +2611,34 @@ namespace GE
 				if (stream.eof())
 				{
 					GE_ERROR("Reached EOF.");
-					return false;
+					return nullptr;
 				}
 
 				uint64_t bufferCount = size > AudioManager::BUFFER_SIZE ? (size / AudioManager::BUFFER_SIZE) + 1 : 1;
-				Buffer buffer = Buffer(AudioManager::BUFFER_SIZE * bufferCount);
+				ScopedBuffer buffer = ScopedBuffer(AudioManager::BUFFER_SIZE * bufferCount);
+				// Only the last buffer's tail is left to clear
+				memset(buffer.As<uint8_t>() + size, 0, buffer.GetSize() - size);
 				// Read Data
 				if (!stream.read(buffer.As<char>(), size))
 				{
 					GE_ERROR("Could not read data.");
-					return false;
+					return nullptr;
 				}
 
 				if (stream.fail())
 				{
 					GE_ERROR("File stream Failed.");
-					return false;
+					return nullptr;
 				}
 				stream.close();
 
-				Ref<Audio> audio = Audio::Create(metadata.Handle, Audio::Config(channels, sampleRate, bps, buffer), (uint32_t)bufferCount);
-				buffer.Release();
-
-				return audio;
+				// Decoding thread reads, creating thread fills AL buffers & Audio keeps it
+				const UUID handle = metadata.Handle;
+				Ref<ScopedBuffer> samples = CreateRef<ScopedBuffer>(std::move(buffer));
+				return [handle, channels, sampleRate, bps, samples, bufferCount]() -> Ref<Asset>
+					{
+						return Audio::Create(handle, Audio::Config(channels, sampleRate, bps, std::move(*samples)), (uint32_t)bufferCount);
+					};
 			}
 
 		}
@@ -1923,26 +2659,173 @@ namespace GE
 		return nullptr;
 	}
 
+	Ref<Asset> EditorAssetManager::DeserializePrefab(const AssetMetadata& metadata)
+	{
+		std::filesystem::path path = Project::GetPathToAsset(metadata.FilePath);
+
+		std::ifstream stream(path);
+		std::stringstream strStream;
+		if (stream.good())
+		{
+			strStream << stream.rdbuf();
+		}
+		YAML::Node data;
+		try
+		{
+			data = YAML::Load(strStream.str());
+		}
+		catch (YAML::ParserException e)
+		{
+			GE_ERROR("Failed to load Prefab Asset file. {0}\n\t{1}", path.string(), e.what());
+		}
+
+		Ref<Prefab> prefab = nullptr;
+		if (auto& prefabName = data["Prefab"])
+		{
+			std::string name = prefabName.as<std::string>();
+			prefab = CreateRef<Prefab>(metadata.Handle);
+			GE_TRACE("Deserializing Prefab\n\tUUID : {0}\n\tName : {1}\n\tPath : {2}", (uint64_t)metadata.Handle, name.c_str(), path.string().c_str());
+
+			// Template Entities, root first
+			if (auto& entities = data["Entities"])
+				DeserializeEntities(prefab->GetTemplate(), entities);
+
+			if (!prefab->Resolve())
+			{
+				GE_ERROR("Failed to resolve Prefab hierarchy.\n\tPath : {0}", path.string().c_str());
+				return nullptr;
+			}
+		}
+		return prefab;
+	}
+
 	bool EditorAssetManager::SerializeScene(Ref<Asset> asset, const AssetMetadata& metadata)
 	{
+		const auto startTime = std::chrono::steady_clock::now();
 		std::filesystem::path path = Project::GetPathToAsset(metadata.FilePath);
 		std::string sceneName = metadata.FilePath.filename().string();
 		Ref<Scene> scene = Project::GetAssetAs<Scene>(asset);
+		if (!scene)
+			return false;
 		GE_TRACE("Serializing Scene\n\tUUID : {0}\n\tName : {1}\n\tPath : {2}", (uint64_t)metadata.Handle, sceneName.c_str(), path.string());
 
+		// Cache reads Script fields from Scripting, encoded here. Written after the YAML it's validated by
+		Ref<ScopedBuffer> cacheData = CreateRef<ScopedBuffer>();
+		{
+			RuntimeAssetManager encoder = RuntimeAssetManager();
+			if (!encoder.EncodeScene(scene, *cacheData))
+				GE_WARN("Could not encode Scene cache.\n\tPath : {0}", path.string());
+		}
+		const float encodeTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+		// Editing continues while the worker emits YAML from a copy.
+		// Script fields, Tags & Layer names are captured, Scripting, Project & EditorLayerStack are main thread only
+		Ref<Scene> snapshot = Project::GetAssetAs<Scene>(scene->GetCopy());
+		Ref<SerializeEntityContext> context = CaptureSerializeEntityContext(scene);
+
+		Ref<SceneSaveState> state = m_SceneSaveState;
+		uint64_t generation = 0;
+		{
+			std::lock_guard<std::mutex> lock(state->Mutex);
+			generation = ++state->Generation;
+			state->Generations[metadata.Handle] = generation;
+			state->Stats.PendingSaves++;
+			state->Stats.SaveBlockingTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		}
+
+		Application::SubmitToWorkerThread([state, generation, handle = metadata.Handle, path, sceneName, snapshot, context, cacheData, encodeTime]()
+			{
+				const auto yamlStartTime = std::chrono::steady_clock::now();
+				YAML::Emitter out;
+				{
+					out << YAML::BeginMap;
+					out << YAML::Key << "Scene" << YAML::Value << sceneName;
+					out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+
+					std::vector<Entity> entities = snapshot->GetAllEntitiesWith<IDComponent>();
+					for (Entity entity : entities)
+					{
+						SerializeEntity(out, snapshot, entity, context.get());
+					}
+
+					out << YAML::EndSeq;
+					out << YAML::EndMap;
+				}
+				const std::string yaml = std::string(out.c_str(), out.size());
+
+				// Saves of the same Scene are written in order, a newer save replaces this one.
+				// Files are written under WriteMutex only, the main thread never waits on the disk through Mutex
+				bool written = false;
+				float yamlSaveTime = 0.0f, cacheSaveTime = 0.0f;
+				{
+					std::lock_guard<std::mutex> writeLock(state->WriteMutex);
+					bool latest = false;
+					{
+						std::lock_guard<std::mutex> lock(state->Mutex);
+						latest = state->Generations[handle] == generation;
+					}
+
+					if (latest)
+					{
+						std::ofstream fout(path);
+						if (fout.is_open() && fout.good())
+						{
+							fout << yaml;
+							fout.close();
+
+							const auto cacheStartTime = std::chrono::steady_clock::now();
+							if (*cacheData)
+								WriteSceneCache(path, yaml, context->Tags, *cacheData);
+							const auto endTime = std::chrono::steady_clock::now();
+
+							written = true;
+							cacheSaveTime = encodeTime + std::chrono::duration<float, std::milli>(endTime - cacheStartTime).count();
+							yamlSaveTime = std::chrono::duration<float, std::milli>(cacheStartTime - yamlStartTime).count();
+							GE_TRACE("Scene Serialization Complete.\n\tPath : {0}\n\tYAML : {1}ms\n\tCache : {2}ms", path.string(), yamlSaveTime, cacheSaveTime);
+						}
+						else
+						{
+							GE_WARN("Scene Serialization Failed.\n\tPath : {0}", path.string());
+						}
+					}
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(state->Mutex);
+					if (written)
+					{
+						SceneFileStats& stats = state->Stats;
+						stats.Saves++;
+						stats.CacheSaveTime = cacheSaveTime;
+						stats.YAMLSaveTime = yamlSaveTime;
+					}
+					state->Stats.PendingSaves--;
+				}
+				state->Condition.notify_all();
+			});
+		return true;
+	}
+
+	bool EditorAssetManager::SerializePrefab(Ref<Asset> asset, const AssetMetadata& metadata)
+	{
+		std::filesystem::path path = Project::GetPathToAsset(metadata.FilePath);
+		std::string prefabName = metadata.FilePath.filename().string();
+		Ref<Prefab> prefab = Project::GetAssetAs<Prefab>(asset);
+		if (!prefab)
+			return false;
+		GE_TRACE("Serializing Prefab\n\tUUID : {0}\n\tName : {1}\n\tPath : {2}", (uint64_t)metadata.Handle, prefabName.c_str(), path.string());
+
 		YAML::Emitter out;
 		{
 			out << YAML::BeginMap;
-			out << YAML::Key << "Scene" << YAML::Value << sceneName;
+			out << YAML::Key << "Prefab" << YAML::Value << prefabName;
 			out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
 
-			std::vector<Entity> entities = scene->GetAllEntitiesWith<IDComponent>();
-			for (Entity entity : entities)
+			// Root first, parents before children
+			for (Entity entity : prefab->GetEntities())
 			{
-				SerializeEntity(out, scene, entity);
+				SerializeEntity(out, prefab->GetTemplate(), entity);
 			}
-			entities.clear();
-			entities = std::vector<Entity>();
 
 			out << YAML::EndSeq;
 			out << YAML::EndMap;
@@ -1952,11 +2835,11 @@ namespace GE
 		{
 			fout << out.c_str();
 			fout.close();
-			GE_TRACE("Scene Serialization Complete.");
+			GE_TRACE("Prefab Serialization Complete.");
 			return true;
 		}
 
-		GE_WARN("Scene Serialization Failed.");
+		GE_WARN("Prefab Serialization Failed.");
 		return false;
 	}
 
@@ -5,11 +5,64 @@
 #include "GE/Asset/Registry/AssetRegistry.h"
 #include "GE/Core/Application/Layer/Layer.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
 namespace GE
 {
 	class EditorAssetManager : public AssetManager
 	{
 	public:
+		/*
+		* Import timing of last DeserializeAssets(), per Asset::Type
+		*/
+		struct ImportStats
+		{
+			uint32_t Count = 0;
+			// Source file bytes
+			uint64_t Bytes = 0;
+			// Summed across threads
+			float Milliseconds = 0.0f;
+		};
+
+		/*
+		* Scene load & save timing per path, see DeserializeScene() & SerializeScene()
+		*/
+		struct SceneFileStats
+		{
+			uint32_t CacheLoads = 0;
+			uint32_t YAMLLoads = 0;
+			// Milliseconds of last load from each path
+			float CacheLoadTime = 0.0f;
+			float YAMLLoadTime = 0.0f;
+
+			uint32_t Saves = 0;
+			// Milliseconds of last save. Cache is encoded on the calling thread & written after the YAML
+			float CacheSaveTime = 0.0f;
+			// Emitted & written on a worker thread
+			float YAMLSaveTime = 0.0f;
+			// Calling thread part of last save, includes encoding the cache
+			float SaveBlockingTime = 0.0f;
+			uint32_t PendingSaves = 0;
+		};
+
+		/*
+		* Textures, Fonts & Audio of last import, see DeserializeAssetsAsync()
+		*/
+		struct ImportProgress
+		{
+			uint32_t Total = 0;
+			// Created, failed or already loaded by GetAsset()
+			uint32_t Imported = 0;
+			// Milliseconds from import start to the first frame, equal to ImportTime if blocking
+			float TimeToInteractive = 0.0f;
+			// Milliseconds from import start until every Asset is created
+			float ImportTime = 0.0f;
+		};
+
 		EditorAssetManager(const AssetMap& assetMap = AssetMap());
 		~EditorAssetManager() override;
 
@@ -20,6 +73,11 @@ namespace GE
 		* or if asset can not be loaded
 		*/
 		Ref<Asset> GetAsset(UUID handle) override;
+		/*
+		* Returns placeholder with Asset::Status::Loading while its import is pending,
+		* otherwise imports from source files synchronously, same as GetAsset(handle)
+		*/
+		Ref<Asset> GetAssetAsync(UUID handle) override;
 		const AssetMap& GetLoadedAssets() override;
 
 		bool HandleExists(UUID handle) override;
@@ -30,8 +88,54 @@ namespace GE
 
 		bool SerializeAssets() override;
 		bool DeserializeAssets() override;
+		/*
+		* Same as DeserializeAssets(), but Textures, Fonts & Audio are decoded on worker threads.
+		* GL & AL objects are created on the calling thread, which blocks until all are imported
+		*/
+		bool DeserializeAssetsParallel();
+		/*
+		* Same as DeserializeAssetsParallel(), but returns once Scripts, Scenes & Prefabs are imported.
+		* Decoded Assets are created on the main thread over the following frames, see UpdateImport()
+		* Main thread only
+		*/
+		bool DeserializeAssetsAsync();
+		/*
+		* Blocks until every Asset of the pending import is created
+		*/
+		void FinishImport();
+		bool IsImporting() const { return m_Importing; }
+		const ImportProgress& GetImportProgress() const { return m_ImportProgress; }
+		const std::map<Asset::Type, ImportStats>& GetImportStats() const { return m_ImportStats; }
+		/*
+		* Times importing count Textures, Fonts & Audio, cycling through those in the Registry.
+		* Decoded serially on the calling thread, then on worker threads like DeserializeAssetsParallel().
+		* Both create GL & AL objects on the calling thread. Imported Assets are discarded, loaded Assets are unchanged.
+		* Returns false if Registry has no Textures, Fonts or Audio
+		*
+		* @param count : imports per path, example 2000 for a large project
+		* @param outSerialTime : milliseconds
+		* @param outParallelTime : milliseconds
+		*/
+		bool ImportBenchmark(uint32_t count, float& outSerialTime, float& outParallelTime);
+
+		SceneFileStats GetSceneFileStats() const;
+		/*
+		* Blocks until every Scene saved in the background is written
+		*/
+		void WaitForSceneSaves();
+
+		/*
+		* Evicts only, CPU copies are kept for building packs. Evicted assets are reimported from source files.
+		*/
+		void UpdateResidency(const std::unordered_set<UUID>& referencedHandles) override;
+		const AssetResidency& GetResidency() override { return m_Residency; }
 
 		inline Ref<AssetRegistry> GetAssetRegistry() { return m_AssetRegistry; }
+		/*
+		* Returns key of each Texture2D, Font & Audio source file, from its path, size & last write time.
+		* Scenes & Prefabs are edited in memory, they have none. See RuntimeAssetManager::SetSourceKeys()
+		*/
+		std::unordered_map<UUID, uint64_t> GetSourceKeys();
 		Ref<Asset> GetAsset(const std::filesystem::path& filePath);
 		bool AddAsset(const AssetMetadata& metadata);
 
@@ -129,20 +233,126 @@ namespace GE
 			return s_SliderDirectionStrs.begin()->first;
 		}
 	private:
+		/*
+		* Clears loaded Assets & fills Registry from .gar(Game Asset Registry) file
+		*/
+		bool DeserializeRegistry();
+		/*
+		* Adds import of metadata to stats
+		*/
+		void AddImportStats(const AssetMetadata& metadata, float milliseconds);
+		/*
+		* Fills Registry, submits Texture, Font & Audio decodes to worker threads,
+		* then imports remaining Assets on the calling thread. Scenes reference the others by handle.
+		*
+		* @param async : decoded Assets are created by UpdateImport() on the main thread each frame
+		*/
+		bool BeginImport(bool async);
+		/*
+		* Creates decoded Assets until budget is spent, reschedules itself while any remain
+		*
+		* @param budgetMilliseconds : 0 creates every decoded Asset
+		*/
+		void UpdateImport(float budgetMilliseconds);
+		/*
+		* Drops pending import, queued decodes are skipped
+		*/
+		void CancelImport();
+
 		bool SerializeAsset(Ref<Asset> asset, const AssetMetadata& metadata);
 		Ref<Asset> DeserializeAsset(const AssetMetadata& metadata);
 
+		/*
+		* Returns path of binary Scene cache, next to the .scene file
+		*/
+		static std::filesystem::path GetSceneCachePath(const std::filesystem::path& scenePath);
+		/*
+		* Writes data to Scene cache, valid while the .scene file matches yaml & isn't written again
+		*
+		* @param yaml : contents of the .scene file, already written
+		* @param tags : Project Tags, registered again when the cache is loaded
+		* @param data : See RuntimeAssetManager::EncodeScene()
+		*/
+		static bool WriteSceneCache(const std::filesystem::path& scenePath, const std::string& yaml, const std::map<uint32_t, std::string>& tags, const ScopedBuffer& data);
+
 		bool SerializeScene(Ref<Asset> asset, const AssetMetadata& metadata);
+		bool SerializePrefab(Ref<Asset> asset, const AssetMetadata& metadata);
 
 		Ref<Asset> DeserializeScene(const AssetMetadata& metadata);
 		Ref<Asset> DeserializeTexture2D(const AssetMetadata& metadata);
+		/*
+		* Worker thread safe part of DeserializeTexture2D(metadata), same for Font & Audio
+		* Returns function creating the Asset, run it on the main thread. nullptr if source can't be loaded.
+		*/
+		static std::function<Ref<Asset>()> DecodeTexture2D(const AssetMetadata& metadata);
 		Ref<Asset> DeserializeFont(const AssetMetadata& metadata);
+		static std::function<Ref<Asset>()> DecodeFont(const AssetMetadata& metadata);
 		Ref<Asset> DeserializeAudio(const AssetMetadata& metadata);
+		static std::function<Ref<Asset>()> DecodeAudio(const AssetMetadata& metadata);
 		Ref<Asset> DeserializeScript(const AssetMetadata& metadata);
+		Ref<Asset> DeserializePrefab(const AssetMetadata& metadata);
 
 	private:
 		Ref<AssetRegistry> m_AssetRegistry;
 		AssetMap m_LoadedAssets;
+		AssetResidency m_Residency = AssetResidency();
+		std::map<Asset::Type, ImportStats> m_ImportStats = std::map<Asset::Type, ImportStats>();
+
+		/*
+		* Shared with background Scene saves, which may outlive this manager
+		*/
+		struct SceneSaveState
+		{
+			// Guards Generations & Stats, never held while writing files
+			std::mutex Mutex;
+			// Held by workers while writing files, keeps saves of a Scene in order
+			std::mutex WriteMutex;
+			std::condition_variable Condition;
+			// Latest save per Scene handle, older saves still queued are skipped
+			std::unordered_map<UUID, uint64_t> Generations = std::unordered_map<UUID, uint64_t>();
+			uint64_t Generation = 0;
+			SceneFileStats Stats = SceneFileStats();
+		};
+		Ref<SceneSaveState> m_SceneSaveState = nullptr;
+
+		/*
+		* Shared with worker decodes, which may outlive this manager
+		* Manager is cleared on destruction, Generation changes when the import is cancelled
+		*/
+		struct ImportState
+		{
+			struct Decoded
+			{
+				AssetMetadata Metadata = AssetMetadata();
+				// nullptr if decoding failed
+				std::function<Ref<Asset>()> Create = nullptr;
+				float Milliseconds = 0.0f;
+				uint64_t Generation = 0;
+			};
+
+			// Main thread only
+			EditorAssetManager* Manager = nullptr;
+			uint64_t Generation = 0;
+
+			std::mutex Mutex;
+			std::condition_variable Condition;
+			std::deque<Decoded> Ready = std::deque<Decoded>();
+			// UpdateImport() is submitted to the main thread each frame while Ready isn't empty
+			bool Async = false;
+			bool Scheduled = false;
+		};
+		Ref<ImportState> m_ImportState = nullptr;
+		// Main thread only
+		bool m_Importing = false;
+		ImportProgress m_ImportProgress = ImportProgress();
+		std::chrono::steady_clock::time_point m_ImportStart;
+		std::unordered_map<UUID, Ref<Asset>> m_ImportPlaceholders = std::unordered_map<UUID, Ref<Asset>>();
+		// Milliseconds per frame spent creating decoded Assets
+		static const float s_ImportBudget;
+		/*
+		* Submits UpdateImport() to the main thread, unless already submitted or import blocks
+		*/
+		static void SubmitImportUpdate(Ref<ImportState> state);
 
 		static AssetMetadata s_NullMetadata;
 
@@ -5,6 +5,7 @@
 #include "../Project/EditorProject.h"
 
 #include "GE/Asset/Assets/Font/Font.h"
+#include "GE/Asset/Assets/Prefab/Prefab.h"
 #include "GE/Audio/AudioManager.h"
 #include "GE/Core/Application/Application.h"
 #include "GE/Core/FileSystem/FileSystem.h"
@@ -93,6 +94,59 @@ namespace GE
 
 #pragma endregion
 
+	/*
+	* State of entity that static sprites are baked from, see SpriteRendererComponent::Static.
+	* Compared before & after drawing components, to rebake only when edited.
+	*/
+	struct StaticState
+	{
+		glm::vec3 Translation = glm::vec3(0.0f);
+		glm::vec3 Rotation = glm::vec3(0.0f);
+		glm::vec3 Scale = glm::vec3(1.0f);
+		Pivot PivotEnum = Pivot::Center;
+		bool Active = true;
+		bool Hidden = false;
+		std::vector<uint64_t> LayerIDs = std::vector<uint64_t>();
+		bool HasSprite = false;
+		SpriteRendererComponent Sprite = SpriteRendererComponent();
+		// Moving bodies make static sprites of entity & children dynamic
+		bool Moving = false;
+
+		StaticState(Ref<Scene> scene, Entity entity)
+		{
+			if (scene->HasComponent<TransformComponent>(entity))
+			{
+				auto& trsc = scene->GetComponent<TransformComponent>(entity);
+				Translation = trsc.Translation;
+				Rotation = trsc.Rotation;
+				Scale = trsc.Scale;
+				PivotEnum = trsc.GetPivot();
+			}
+			if (scene->HasComponent<ActiveComponent>(entity))
+			{
+				auto& ac = scene->GetComponent<ActiveComponent>(entity);
+				Active = ac.Active;
+				Hidden = ac.Hidden;
+			}
+			if (scene->HasComponent<RenderComponent>(entity))
+				LayerIDs = scene->GetComponent<RenderComponent>(entity).LayerIDs;
+			HasSprite = scene->HasComponent<SpriteRendererComponent>(entity);
+			if (HasSprite)
+				Sprite = scene->GetComponent<SpriteRendererComponent>(entity);
+			Moving = scene->HasComponent<Rigidbody2DComponent>(entity)
+				&& scene->GetComponent<Rigidbody2DComponent>(entity).Type != Rigidbody2DComponent::BodyType::Static;
+		}
+
+		bool operator==(const StaticState& other) const
+		{
+			return Translation == other.Translation && Rotation == other.Rotation && Scale == other.Scale
+				&& PivotEnum == other.PivotEnum && Active == other.Active && Hidden == other.Hidden
+				&& LayerIDs == other.LayerIDs && HasSprite == other.HasSprite && Moving == other.Moving
+				&& Sprite.AssetHandle == other.Sprite.AssetHandle && Sprite.TilingFactor == other.Sprite.TilingFactor
+				&& Sprite.Color == other.Sprite.Color && Sprite.Static == other.Sprite.Static;
+		}
+	};
+
 	SceneHierarchyPanel::~SceneHierarchyPanel()
 	{
 	}
@@ -135,6 +189,15 @@ namespace GE
 					}
 
 				}
+				if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ASSET_PANEL_ITEM"))
+				{
+					const UUID handle = *(UUID*)payload->Data;
+					Ref<Asset> asset = Project::GetAssetManager()->GetAsset(handle);
+					if (asset && asset->GetType() == Asset::Type::Prefab)
+						Project::GetAssetAs<Prefab>(asset)->Instantiate(scene, 1);
+					else
+						GE_WARN("Asset Type is not Prefab.");
+				}
 				ImGui::EndDragDropTarget();
 			}
 
@@ -161,7 +224,12 @@ namespace GE
 		if (scene && ImGui::Begin("Entity Components"))
 		{
 			if (Entity entity = scene->GetEntityByUUID(m_SelectedEntityID))
+			{
+				const StaticState previousState = StaticState(scene, entity);
 				DrawComponents(scene, entity);
+				if (scene->EntityExists(entity) && !(StaticState(scene, entity) == previousState))
+					scene->MarkStaticDirty();
+			}
 
 			ImGui::End();
 		}
@@ -246,6 +314,17 @@ namespace GE
 		{
 			if (ImGui::MenuItem("DeleteEntity"))
 				entityDeleted = true;
+			if (ImGui::MenuItem("Create Prefab"))
+			{
+				Ref<Prefab> prefab = CreateRef<Prefab>();
+				if (prefab->SetTemplate(scene, entity))
+				{
+					// Written to its file with the Asset Registry, see EditorAssetManager::SerializeAssets()
+					Ref<EditorAssetManager> assetManager = Project::GetAssetManager<EditorAssetManager>();
+					assetManager->AddAsset(AssetMetadata(prefab->GetHandle(), std::filesystem::path(name + ".prefab")));
+					assetManager->AddAsset(prefab);
+				}
+			}
 
 			ImGui::EndPopup();
 		}
@@ -542,6 +621,7 @@ namespace GE
 			{
 				ImGui::ColorEdit4("Color", glm::value_ptr(component.Color));
 				ImGui::DragFloat("Tiling Factor", &component.TilingFactor);
+				ImGui::Checkbox("Static", &component.Static);
 				{
 					if (ImGui::Button("Texture"))
 					{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "GE/Asset/AssetResidency.h"
 #include "GE/Asset/Assets/Asset.h"
 
 #include "GE/Core/Core.h"
@@ -27,6 +28,9 @@ namespace GE
 			case Asset::Type::Script:
 				return "Script";
 				break;
+			case Asset::Type::Prefab:
+				return "Prefab";
+				break;
 			}
 
 			return "None";
@@ -55,6 +59,10 @@ namespace GE
 			{
 				return Asset::Type::Script;
 			}
+			if (typeString == "Prefab")
+			{
+				return Asset::Type::Prefab;
+			}
 
 			return Asset::Type::None;
 		}
@@ -71,6 +79,11 @@ namespace GE
 		virtual void InvalidateAssets() = 0;
 
 		virtual Ref<Asset> GetAsset(UUID handle) = 0;
+		/*
+		* Returns loaded asset, or a placeholder with Asset::Status::Loading while it loads in the background.
+		* Call again to get the asset once ready. Main thread only.
+		*/
+		virtual Ref<Asset> GetAssetAsync(UUID handle) = 0;
 		virtual const AssetMap& GetLoadedAssets() = 0;
 
 		virtual bool HandleExists(UUID handle) = 0;
@@ -83,6 +96,14 @@ namespace GE
 		virtual bool SerializeAssets() = 0;
 		virtual bool DeserializeAssets() = 0;
 
+		/*
+		* Evicts least recently used assets from types over budget, see AssetResidency.
+		* Called once per frame, main thread only.
+		* @param referencedHandles : assets in use by active Scene, never evicted
+		*/
+		virtual void UpdateResidency(const std::unordered_set<UUID>& referencedHandles) = 0;
+		virtual const AssetResidency& GetResidency() = 0;
+
 	};
 
 }
\ No newline at end of file
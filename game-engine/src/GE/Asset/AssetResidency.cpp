@@ -0,0 +1,121 @@
+#include "GE/GEpch.h"
+
+#include "AssetResidency.h"
+
+namespace GE
+{
+	static const uint64_t s_MB = 1024 * 1024;
+
+	AssetResidency::AssetResidency()
+	{
+		// Scenes & Scripts are unbounded, they aren't reloaded without loss
+		m_Budgets[Asset::Type::Texture2D] = { 128 * s_MB, 256 * s_MB };
+		m_Budgets[Asset::Type::Font] = { 32 * s_MB, 32 * s_MB };
+		m_Budgets[Asset::Type::Audio] = { 128 * s_MB, 128 * s_MB };
+	}
+
+	void AssetResidency::Touch(UUID handle)
+	{
+		m_Entries[handle].LastUsed = m_Frame;
+	}
+
+	AssetResidency::Result AssetResidency::Update(const std::map<UUID, Ref<Asset>>& loadedAssets, const std::unordered_set<UUID>& referencedHandles, bool allowEvict, bool allowTrim)
+	{
+		GE_PROFILE_FUNCTION();
+
+		m_Frame++;
+		Result result = Result();
+
+		// Resync, assets may have been added or removed without a request
+		for (auto it = m_Entries.begin(); it != m_Entries.end();)
+		{
+			if (loadedAssets.find(it->first) == loadedAssets.end())
+				it = m_Entries.erase(it);
+			else
+				it++;
+		}
+
+		m_Totals.clear();
+		for (const auto& [handle, asset] : loadedAssets)
+		{
+			if (!asset)
+				continue;
+
+			auto entryIt = m_Entries.find(handle);
+			if (entryIt == m_Entries.end())
+				entryIt = m_Entries.emplace(handle, Entry{ asset->GetType(), Asset::MemoryUsage(), m_Frame, false, false, false }).first;
+
+			Entry& entry = entryIt->second;
+			entry.Type = asset->GetType();
+			entry.Usage = asset->GetMemoryUsage();
+			entry.Referenced = referencedHandles.find(handle) != referencedHandles.end();
+			// loadedAssets holds one
+			entry.Shared = asset.use_count() > 1;
+
+			Asset::MemoryUsage& total = m_Totals[entry.Type];
+			total.CPU += entry.Usage.CPU;
+			total.GPU += entry.Usage.GPU;
+		}
+
+		for (const auto& [type, budget] : m_Budgets)
+		{
+			Asset::MemoryUsage& total = m_Totals[type];
+			auto overBudget = [&budget, &total]() -> bool
+				{
+					return (budget.CPU && total.CPU > budget.CPU) || (budget.GPU && total.GPU > budget.GPU);
+				};
+			if (!allowEvict || !overBudget())
+				continue;
+
+			// Least recently used first
+			std::vector<std::pair<uint64_t, UUID>> candidates = std::vector<std::pair<uint64_t, UUID>>();
+			for (const auto& [handle, entry] : m_Entries)
+			{
+				if (entry.Type == type && !entry.Referenced && !entry.Shared)
+					candidates.push_back({ entry.LastUsed, handle });
+			}
+			std::sort(candidates.begin(), candidates.end());
+
+			for (const auto& [lastUsed, handle] : candidates)
+			{
+				if (!overBudget())
+					break;
+
+				const Entry& entry = m_Entries.at(handle);
+				total.CPU -= entry.Usage.CPU;
+				total.GPU -= entry.Usage.GPU;
+				m_Entries.erase(handle);
+
+				result.Evict.push_back(handle);
+				m_Stats.Evictions++;
+			}
+
+			if (!allowTrim || !budget.CPU || total.CPU <= budget.CPU)
+				continue;
+
+			// Only referenced assets are left, drop CPU copies instead
+			candidates.clear();
+			for (const auto& [handle, entry] : m_Entries)
+			{
+				if (entry.Type == type && entry.Usage.CPU && !entry.Trimmed)
+					candidates.push_back({ entry.LastUsed, handle });
+			}
+			std::sort(candidates.begin(), candidates.end());
+
+			for (const auto& [lastUsed, handle] : candidates)
+			{
+				if (total.CPU <= budget.CPU)
+					break;
+
+				// Estimate, corrected on next Update()
+				Entry& entry = m_Entries.at(handle);
+				total.CPU -= entry.Usage.CPU;
+				entry.Trimmed = true;
+				result.Trim.push_back(handle);
+				m_Stats.Trims++;
+			}
+		}
+
+		return result;
+	}
+}
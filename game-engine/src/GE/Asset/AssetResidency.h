@@ -0,0 +1,88 @@
+#pragma once
+
+#include "GE/Asset/Assets/Asset.h"
+
+#include <map>
+
+namespace GE
+{
+	/*
+	* Tracks memory & last use of loaded Assets against per Asset::Type budgets.
+	* Owned by an AssetManager, which evicts what Update() returns.
+	*/
+	class AssetResidency
+	{
+	public:
+		// 0 is unbounded
+		struct Budget
+		{
+			uint64_t CPU = 0;
+			uint64_t GPU = 0;
+		};
+
+		struct Entry
+		{
+			Asset::Type Type = Asset::Type::None;
+			Asset::MemoryUsage Usage = Asset::MemoryUsage();
+			// Update() count when last requested
+			uint64_t LastUsed = 0;
+			// Referenced by active Scene, never evicted
+			bool Referenced = false;
+			// CPU copy released, remainder can't be trimmed
+			bool Trimmed = false;
+			// Also held outside of manager, ex. static batch or text atlas. Evicting wouldn't free it
+			bool Shared = false;
+		};
+
+		struct Statistics
+		{
+			uint64_t Evictions = 0;
+			// CPU copies released, see Asset::ReleaseCPUData()
+			uint64_t Trims = 0;
+		};
+
+		/*
+		* Handles to act on, least recently used first
+		*/
+		struct Result
+		{
+			// Remove from loaded assets, reloaded on next request
+			std::vector<UUID> Evict = std::vector<UUID>();
+			// Referenced assets over CPU budget, release their CPU copies
+			std::vector<UUID> Trim = std::vector<UUID>();
+		};
+
+		AssetResidency();
+
+		void SetBudget(Asset::Type type, const Budget& budget) { m_Budgets[type] = budget; }
+		const std::map<Asset::Type, Budget>& GetBudgets() const { return m_Budgets; }
+		// Totals from last Update()
+		const std::map<Asset::Type, Asset::MemoryUsage>& GetTotals() const { return m_Totals; }
+		const std::unordered_map<UUID, Entry>& GetEntries() const { return m_Entries; }
+		const Statistics& GetStats() const { return m_Stats; }
+		const uint64_t& GetFrame() const { return m_Frame; }
+
+		/*
+		* Marks handle as used. Call on every asset request.
+		*/
+		void Touch(UUID handle);
+		/*
+		* Resyncs entries & sizes with loaded assets, then picks assets to evict from types over budget.
+		* Returned handles are already removed from entries.
+		*
+		* @param loadedAssets : every asset the manager holds
+		* @param referencedHandles : assets in use by the active Scene
+		* @param allowEvict : manager can reload evicted assets
+		* @param allowTrim : assets don't need their CPU copies, example nothing serializes them
+		*/
+		Result Update(const std::map<UUID, Ref<Asset>>& loadedAssets, const std::unordered_set<UUID>& referencedHandles, bool allowEvict, bool allowTrim);
+
+	private:
+		std::map<Asset::Type, Budget> m_Budgets = std::map<Asset::Type, Budget>();
+		std::map<Asset::Type, Asset::MemoryUsage> m_Totals = std::map<Asset::Type, Asset::MemoryUsage>();
+		std::unordered_map<UUID, Entry> m_Entries = std::unordered_map<UUID, Entry>();
+
+		uint64_t m_Frame = 0;
+		Statistics m_Stats = Statistics();
+	};
+}
@@ -16,8 +16,8 @@ namespace GE
 			Texture2D,
 			Font,
 			Audio,
-			Script
-			// Prefab
+			Script,
+			Prefab
 		};
 
 		enum class Status
@@ -28,6 +28,17 @@ namespace GE
 			Loading = 3
 		};
 
+		/*
+		* Bytes held by an Asset, see GetMemoryUsage()
+		* - CPU : system memory, example Texture::Config::TextureBuffer
+		* - GPU : device memory, example GL textures & AL buffers
+		*/
+		struct MemoryUsage
+		{
+			uint64_t CPU = 0;
+			uint64_t GPU = 0;
+		};
+
 		Asset(UUID handle = 0, Type type = Type::None, Status status = Status::None)
 			: p_Handle(handle), p_Type(type), p_Status(status) {}
 		virtual ~Asset() {}
@@ -39,6 +50,16 @@ namespace GE
 		*	Implement per inherited Asset
 		*/
 		virtual inline Ref<Asset> GetCopy() { return nullptr; }
+		/*
+		*	Returns bytes held by Asset. Used for residency budgets, see AssetResidency.
+		*	By default, returns nothing held.
+		*/
+		virtual MemoryUsage GetMemoryUsage() const { return MemoryUsage(); }
+		/*
+		*	Frees CPU copies of data already uploaded to the GPU/audio device.
+		*	Asset can no longer be serialized afterwards. Returns true if anything was freed.
+		*/
+		virtual bool ReleaseCPUData() { return false; }
 		
 		inline const Type& GetType() const { return p_Type; }
 		inline const UUID& GetHandle() const { return p_Handle; }
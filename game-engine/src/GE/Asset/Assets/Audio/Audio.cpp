@@ -4,6 +4,7 @@
 
 #include "GE/Audio/AudioManager.h"
 
+#include "Platform/Headless/Assets/HeadlessAudio.h"
 #include "Platform/OpenAL/Assets/OpenALAudio.h"
 
 #include <al.h>
@@ -31,7 +32,8 @@ namespace GE
 		switch (AudioManager::GetAPI())
 		{
 		case AudioManager::API::None:
-			GE_CORE_ERROR("Audio API is None.");
+			// Headless, CPU data only
+			return CreateRef<HeadlessAudio>(handle, config);
 			break;
 		case AudioManager::API::OpenAL:
 			return CreateRef<OpenALAudio>(handle, config, bufferCount);
@@ -39,4 +41,18 @@ namespace GE
 		}
 		return nullptr;
 	}
+
+	Ref<Audio> Audio::Create(UUID handle, Config&& config, const uint32_t& bufferCount /* = 1*/)
+	{
+		switch (AudioManager::GetAPI())
+		{
+		case AudioManager::API::None:
+			return CreateRef<HeadlessAudio>(handle, std::move(config));
+			break;
+		case AudioManager::API::OpenAL:
+			return CreateRef<OpenALAudio>(handle, std::move(config), bufferCount);
+			break;
+		}
+		return nullptr;
+	}
 }
\ No newline at end of file
@@ -26,6 +26,10 @@ namespace GE
 				Format = config.Format;
 				BufferIDs = config.BufferIDs;
 			}
+			// Takes DataBuffer, leaving config empty
+			Config(Config&& config) = default;
+			Config& operator=(const Config& config) = default;
+			Config& operator=(Config&& config) = default;
 			Config(uint32_t channels, uint32_t sampleRate, uint32_t bps, const Buffer& buffer /*= Buffer()*/)
 			{
 				BufferIDs = std::vector<uint32_t>();
@@ -39,6 +43,14 @@ namespace GE
 				if (buffer)
 					SetData(buffer);
 			}
+			/*
+			* Takes data instead of copying it
+			*/
+			Config(uint32_t channels, uint32_t sampleRate, uint32_t bps, ScopedBuffer&& data)
+				: Config(channels, sampleRate, bps, Buffer())
+			{
+				DataBuffer = data.Detach();
+			}
 			~Config() = default;
 
 			void SetData(const Buffer buffer)
@@ -57,6 +69,10 @@ namespace GE
 		};
 
 		static Ref<Audio> Create(UUID handle = UUID(), const Config& config = Config(), const uint32_t& bufferCount = 1);
+		/*
+		* Audio takes config's DataBuffer instead of copying it
+		*/
+		static Ref<Audio> Create(UUID handle, Config&& config, const uint32_t& bufferCount = 1);
 
 		Audio(UUID handle, Asset::Type type) : Asset(handle, type) {}
 		virtual ~Audio() override {}
@@ -1,6 +1,7 @@
 #include "GE/GEpch.h"
 
 #include "Font.h"
+#include "GlyphCache.h"
 
 namespace GE
 {
@@ -11,11 +12,20 @@ namespace GE
 		else
 			m_MSDFData = CreateRef<MSDFData>();
 		m_AtlasConfig = config;
+
+		BakeGlyphTable();
+	}
+
+	Font::Font(UUID handle, const AtlasConfig& config, const GlyphTable& glyphTable) : Asset(handle, Asset::Type::Font), m_GlyphTable(glyphTable)
+	{
+		m_MSDFData = CreateRef<MSDFData>();
+		m_AtlasConfig = config;
 	}
 
 	Font::~Font()
 	{
 		m_MSDFData->Glyphs.clear();
+		m_GlyphCache = nullptr;
 	}
 
 	Ref<Asset> Font::GetCopy()
@@ -24,4 +34,108 @@ namespace GE
 		return nullptr;
 	}
 
+	Asset::MemoryUsage Font::GetMemoryUsage() const
+	{
+		MemoryUsage usage = MemoryUsage();
+		if (m_AtlasConfig.Texture)
+			usage = m_AtlasConfig.Texture->GetMemoryUsage();
+
+		usage.CPU += m_GlyphTable.Glyphs.size() * sizeof(Glyph) + m_GlyphTable.Kerning.size() * sizeof(KerningPair);
+		if (m_GlyphCache)
+		{
+			MemoryUsage cacheUsage = m_GlyphCache->GetMemoryUsage();
+			usage.CPU += cacheUsage.CPU;
+			usage.GPU += cacheUsage.GPU;
+		}
+		return usage;
+	}
+
+	bool Font::ReleaseCPUData()
+	{
+		// Source is kept, GlyphCache generates from it
+		return m_AtlasConfig.Texture && m_AtlasConfig.Texture->ReleaseCPUData();
+	}
+
+	void Font::SetSource(Buffer source)
+	{
+		if (source)
+			m_GlyphCache = CreateScope<GlyphCache>(source, m_AtlasConfig.Scale);
+		else
+			m_GlyphCache = nullptr;
+	}
+
+	Buffer Font::GetSource() const
+	{
+		return m_GlyphCache ? m_GlyphCache->GetSource() : Buffer();
+	}
+
+	void Font::BakeGlyphTable()
+	{
+		if (m_MSDFData->Glyphs.empty())
+			return;
+
+		const msdfgen::FontMetrics& metrics = m_MSDFData->FontGeometry.getMetrics();
+		m_GlyphTable.FontMetrics.AscenderY = (float)metrics.ascenderY;
+		m_GlyphTable.FontMetrics.DescenderY = (float)metrics.descenderY;
+		m_GlyphTable.FontMetrics.LineHeight = (float)metrics.lineHeight;
+
+		m_GlyphTable.Glyphs.clear();
+		m_GlyphTable.Glyphs.reserve(m_MSDFData->Glyphs.size());
+		// Glyph index to codepoint, for kerning
+		std::unordered_map<int, uint32_t> codepoints;
+		for (const msdf_atlas::GlyphGeometry& glyphGeometry : m_MSDFData->Glyphs)
+		{
+			Glyph glyph = Glyph();
+			glyph.Codepoint = (uint32_t)glyphGeometry.getCodepoint();
+
+			double l, b, r, t;
+			glyphGeometry.getQuadAtlasBounds(l, b, r, t);
+			glyph.AtlasBounds = glm::vec4((float)l, (float)b, (float)r, (float)t);
+			glyphGeometry.getQuadPlaneBounds(l, b, r, t);
+			glyph.PlaneBounds = glm::vec4((float)l, (float)b, (float)r, (float)t);
+			glyph.Advance = (float)glyphGeometry.getAdvance();
+
+			m_GlyphTable.Glyphs.push_back(glyph);
+			codepoints.emplace(glyphGeometry.getIndex(), glyph.Codepoint);
+		}
+		std::sort(m_GlyphTable.Glyphs.begin(), m_GlyphTable.Glyphs.end(),
+			[](const Glyph& a, const Glyph& b) { return a.Codepoint < b.Codepoint; });
+
+		m_GlyphTable.Kerning.clear();
+		for (const auto& [indices, advance] : m_MSDFData->FontGeometry.getKerning())
+		{
+			auto first = codepoints.find(indices.first);
+			auto second = codepoints.find(indices.second);
+			if (first == codepoints.end() || second == codepoints.end())
+				continue;
+
+			m_GlyphTable.Kerning.push_back({ first->second, second->second, (float)advance });
+		}
+		std::sort(m_GlyphTable.Kerning.begin(), m_GlyphTable.Kerning.end(),
+			[](const KerningPair& a, const KerningPair& b) { return a.First < b.First || (a.First == b.First && a.Second < b.Second); });
+	}
+
+	const Font::Glyph* Font::GlyphTable::GetGlyph(uint32_t codepoint) const
+	{
+		auto it = std::lower_bound(Glyphs.begin(), Glyphs.end(), codepoint,
+			[](const Glyph& glyph, uint32_t value) { return glyph.Codepoint < value; });
+		if (it != Glyphs.end() && it->Codepoint == codepoint)
+			return &(*it);
+		return nullptr;
+	}
+
+	float Font::GlyphTable::GetAdvance(const Glyph& glyph, uint32_t nextCodepoint) const
+	{
+		float advance = glyph.Advance;
+		if (Kerning.empty())
+			return advance;
+
+		auto it = std::lower_bound(Kerning.begin(), Kerning.end(), std::make_pair(glyph.Codepoint, nextCodepoint),
+			[](const KerningPair& pair, const std::pair<uint32_t, uint32_t>& value)
+			{ return pair.First < value.first || (pair.First == value.first && pair.Second < value.second); });
+		if (it != Kerning.end() && it->First == glyph.Codepoint && it->Second == nextCodepoint)
+			advance += it->Advance;
+		return advance;
+	}
+
 }
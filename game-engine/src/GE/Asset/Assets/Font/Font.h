@@ -2,6 +2,10 @@
 
 #include "GE/Asset/Assets/Textures/Texture.h"
 
+#include <glm/glm.hpp>
+
+#include <atomic>
+
 // This ignores all warnings raised inside External headers
 #pragma warning(push, 0)
 #include <msdfgen/msdfgen.h>
@@ -11,6 +15,8 @@
 
 namespace GE
 {
+	class GlyphCache;
+
 	class Font : public Asset
 	{
 	public:
@@ -33,21 +39,118 @@ namespace GE
 			std::vector<msdf_atlas::GlyphGeometry> Glyphs = std::vector<msdf_atlas::GlyphGeometry>();
 			msdf_atlas::FontGeometry FontGeometry;
 		};
+
+		/*
+		* Glyph metrics baked from MSDFData, so packed Fonts can be drawn without msdfgen.
+		* Plain floats only, stored as-is in AssetPacks.
+		*/
+		struct Glyph
+		{
+			uint32_t Codepoint = 0;
+			// Atlas bounds, in pixels : left, bottom, right, top
+			glm::vec4 AtlasBounds = glm::vec4(0.0f);
+			// Plane bounds, in ems : left, bottom, right, top
+			glm::vec4 PlaneBounds = glm::vec4(0.0f);
+			float Advance = 0.0f;
+		};
+
+		struct KerningPair
+		{
+			uint32_t First = 0;
+			uint32_t Second = 0;
+			float Advance = 0.0f;
+		};
+
+		struct Metrics
+		{
+			float AscenderY = 0.0f;
+			float DescenderY = 0.0f;
+			float LineHeight = 0.0f;
+		};
+
+		struct GlyphTable
+		{
+			Metrics FontMetrics = Metrics();
+			// Sorted by Codepoint
+			std::vector<Glyph> Glyphs = std::vector<Glyph>();
+			// Sorted by First, then Second
+			std::vector<KerningPair> Kerning = std::vector<KerningPair>();
+
+			/*
+			* Returns glyph of codepoint, otherwise nullptr
+			*/
+			const Glyph* GetGlyph(uint32_t codepoint) const;
+			/*
+			* Returns advance of glyph, adjusted by kerning against next codepoint
+			*/
+			float GetAdvance(const Glyph& glyph, uint32_t nextCodepoint) const;
+
+			bool IsEmpty() const { return Glyphs.empty(); }
+		};
 		
+		/*
+		* Bakes GlyphTable from data, if it has glyphs.
+		*/
 		Font(UUID handle = UUID(), const AtlasConfig& config = AtlasConfig(), Ref<MSDFData> data = nullptr);
+		/*
+		* Font from baked glyphs. MSDFData is left empty.
+		*/
+		Font(UUID handle, const AtlasConfig& config, const GlyphTable& glyphTable);
 		~Font() override;
 
 		Ref<Asset> GetCopy() override;
+		MemoryUsage GetMemoryUsage() const override;
+		bool ReleaseCPUData() override;
 
 		Ref<MSDFData> GetMSDFData() const { GE_CORE_ASSERT(m_MSDFData, "Font Data does not exist."); return m_MSDFData; }
+		const GlyphTable& GetGlyphTable() const { return m_GlyphTable; }
+		/*
+		* Sets font file data, enabling a GlyphCache for codepoints missing from GlyphTable.
+		* Copied, empty disables.
+		*/
+		void SetSource(Buffer source);
+		/*
+		* Returns font file data, empty if not set
+		*/
+		Buffer GetSource() const;
+		GlyphCache* GetGlyphCache() const { return m_GlyphCache.get(); }
 		const AtlasConfig& GetAtlasConfig() const { return m_AtlasConfig; }
 		Ref<Texture2D> GetAtlasTexture() const { return m_AtlasConfig.Texture; }
 		const uint32_t& GetWidth() { return m_AtlasConfig.Texture->GetWidth(); }
 		const uint32_t& GetHeight() { return m_AtlasConfig.Texture->GetHeight(); }
 
+	private:
+		void BakeGlyphTable();
 	private:
 		Ref<MSDFData> m_MSDFData = nullptr;
+		GlyphTable m_GlyphTable = GlyphTable();
+		// Null without source data
+		Scope<GlyphCache> m_GlyphCache = nullptr;
 		AtlasConfig m_AtlasConfig;
 	};
+
+	/*
+	* Font decodes since start, debug stat. Excludes creating the atlas Texture.
+	* Generated runs msdfgen on the font file, Baked reads the atlas & GlyphTable from an AssetPack.
+	*/
+	struct FontStats
+	{
+		inline static std::atomic<uint32_t> Generated = 0;
+		inline static std::atomic<uint64_t> GeneratedMicroseconds = 0;
+		inline static std::atomic<uint32_t> Baked = 0;
+		inline static std::atomic<uint64_t> BakedMicroseconds = 0;
+
+		static void AddGenerated(uint64_t microseconds)
+		{
+			GeneratedMicroseconds += microseconds;
+			Generated++;
+		}
+
+		static void AddBaked(uint64_t microseconds)
+		{
+			BakedMicroseconds += microseconds;
+			Baked++;
+		}
+	};
 }
 
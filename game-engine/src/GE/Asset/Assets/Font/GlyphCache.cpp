@@ -0,0 +1,220 @@
+#include "GE/GEpch.h"
+
+#include "GlyphCache.h"
+
+#include "GE/Core/Application/Application.h"
+
+namespace GE
+{
+	GlyphCache::GlyphCache(Buffer source, float scale)
+	{
+		m_Shared = CreateRef<Shared>();
+		m_Shared->Source = Buffer(source.As<void>(), source.GetSize());
+		m_Shared->Scale = scale;
+	}
+
+	GlyphCache::~GlyphCache()
+	{
+		// Queued generation keeps m_Shared alive & drops its result
+		m_Entries.clear();
+		m_LRU.clear();
+		m_Page = nullptr;
+	}
+
+	Asset::MemoryUsage GlyphCache::GetMemoryUsage() const
+	{
+		Asset::MemoryUsage usage = Asset::MemoryUsage();
+		usage.CPU = m_Shared->Source.GetSize() + m_Pixels.capacity() + m_Entries.size() * sizeof(Entry);
+		if (m_Page)
+		{
+			Asset::MemoryUsage pageUsage = m_Page->GetMemoryUsage();
+			usage.CPU += pageUsage.CPU;
+			usage.GPU += pageUsage.GPU;
+		}
+		return usage;
+	}
+
+	const Font::Glyph* GlyphCache::Request(uint32_t codepoint)
+	{
+		auto it = m_Entries.find(codepoint);
+		if (it != m_Entries.end())
+		{
+			m_Stats.Hits++;
+			m_LRU.splice(m_LRU.begin(), m_LRU, it->second.Usage);
+			return &it->second.GlyphData;
+		}
+
+		if (m_Failed.find(codepoint) != m_Failed.end())
+			return nullptr;
+
+		m_Stats.Misses++;
+		if (m_Pending.insert(codepoint).second)
+		{
+			Ref<Shared> shared = m_Shared;
+			Application::SubmitToWorkerThread([shared, codepoint]() { Generate(shared, codepoint); });
+		}
+		return nullptr;
+	}
+
+	bool GlyphCache::HasCompleted()
+	{
+		std::lock_guard<std::mutex> lock(m_Shared->Mutex);
+		return !m_Shared->Completed.empty();
+	}
+
+	void GlyphCache::Update()
+	{
+		GE_PROFILE_FUNCTION();
+
+		std::vector<Generated> completed = std::vector<Generated>();
+		{
+			std::lock_guard<std::mutex> lock(m_Shared->Mutex);
+			completed.swap(m_Shared->Completed);
+		}
+
+		for (const Generated& generated : completed)
+		{
+			m_Pending.erase(generated.GlyphData.Codepoint);
+			if (generated.Failed)
+			{
+				m_Failed.insert(generated.GlyphData.Codepoint);
+				m_Stats.Failures++;
+				continue;
+			}
+			Place(generated);
+		}
+
+		if (m_PageResized)
+		{
+			Texture::Config config = Texture::Config(PageWidth, m_PageHeight, 3, false);
+			m_Page = Texture2D::Create(0, config, Buffer::View(m_Pixels.data(), m_Pixels.size()));
+		}
+		else if (m_PageDirty && m_Page)
+			m_Page->SetData(Buffer::View(m_Pixels.data(), m_Pixels.size()));
+
+		m_PageResized = false;
+		m_PageDirty = false;
+	}
+
+	void GlyphCache::Generate(Ref<Shared> shared, uint32_t codepoint)
+	{
+		Generated generated = Generated();
+		generated.GlyphData.Codepoint = codepoint;
+		generated.Failed = true;
+
+		// FreeType handles aren't shared between threads
+		if (msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype())
+		{
+			if (msdfgen::FontHandle* font = msdfgen::loadFontData(ft, shared->Source.As<uint8_t>(), (int)shared->Source.GetSize()))
+			{
+				msdfgen::FontMetrics metrics;
+				msdfgen::getFontMetrics(metrics, font);
+
+				// Matches FontGeometry::loadCharset(font, 1.0, charset), plane bounds in ems
+				msdf_atlas::GlyphGeometry glyphGeometry;
+				if (metrics.emSize > 0.0 && glyphGeometry.load(font, 1.0 / metrics.emSize, codepoint))
+				{
+					glyphGeometry.edgeColoring(msdfgen::edgeColoringInkTrap, 3.0, 0);
+					glyphGeometry.wrapBox(shared->Scale, 2.0 / shared->Scale, 1.0);
+					glyphGeometry.placeBox(0, 0);
+
+					int width = 0, height = 0;
+					glyphGeometry.getBoxSize(width, height);
+					if (width <= (int)CellSize && height <= (int)CellSize)
+					{
+						generated.Failed = false;
+						generated.Pixels.resize(CellSize * CellSize * 3, 0);
+
+						if (width > 0 && height > 0)
+						{
+							msdfgen::Bitmap<float, 3> bitmap(width, height);
+							msdf_atlas::GeneratorAttributes attributes;
+							attributes.config.overlapSupport = true;
+							attributes.scanlinePass = true;
+							msdf_atlas::msdfGenerator(bitmap, glyphGeometry, attributes);
+
+							for (int y = 0; y < height; y++)
+							{
+								for (int x = 0; x < width; x++)
+								{
+									uint8_t* texel = &generated.Pixels[((size_t)y * CellSize + x) * 3];
+									for (int c = 0; c < 3; c++)
+										texel[c] = msdfgen::pixelFloatToByte(bitmap(x, y)[c]);
+								}
+							}
+						}
+
+						double l, b, r, t;
+						glyphGeometry.getQuadAtlasBounds(l, b, r, t);
+						generated.GlyphData.AtlasBounds = glm::vec4((float)l, (float)b, (float)r, (float)t);
+						glyphGeometry.getQuadPlaneBounds(l, b, r, t);
+						generated.GlyphData.PlaneBounds = glm::vec4((float)l, (float)b, (float)r, (float)t);
+						generated.GlyphData.Advance = (float)glyphGeometry.getAdvance();
+					}
+				}
+				msdfgen::destroyFont(font);
+			}
+			msdfgen::deinitializeFreetype(ft);
+		}
+
+		std::lock_guard<std::mutex> lock(shared->Mutex);
+		shared->Completed.push_back(std::move(generated));
+	}
+
+	uint32_t GlyphCache::AllocateCell()
+	{
+		if (m_FreeCells.empty())
+		{
+			if (m_PageHeight < MaxPageHeight)
+			{
+				// New rows are appended, placed cells keep their texels
+				uint32_t oldCells = GetCellCapacity();
+				m_PageHeight = m_PageHeight ? std::min(m_PageHeight * 2, MaxPageHeight) : CellSize;
+				m_Pixels.resize((size_t)PageWidth * m_PageHeight * 3, 0);
+				m_PageResized = true;
+
+				for (uint32_t cell = GetCellCapacity(); cell > oldCells; cell--)
+					m_FreeCells.push_back(cell - 1);
+			}
+			else
+			{
+				uint32_t codepoint = m_LRU.back();
+				m_LRU.pop_back();
+
+				auto it = m_Entries.find(codepoint);
+				uint32_t cell = it->second.Cell;
+				m_Entries.erase(it);
+				m_Stats.Evictions++;
+				return cell;
+			}
+		}
+
+		uint32_t cell = m_FreeCells.back();
+		m_FreeCells.pop_back();
+		return cell;
+	}
+
+	void GlyphCache::Place(const Generated& generated)
+	{
+		uint32_t cell = AllocateCell();
+		uint32_t columns = PageWidth / CellSize;
+		uint32_t cellX = (cell % columns) * CellSize;
+		uint32_t cellY = (cell / columns) * CellSize;
+
+		for (uint32_t y = 0; y < CellSize; y++)
+		{
+			const uint8_t* source = &generated.Pixels[(size_t)y * CellSize * 3];
+			uint8_t* destination = &m_Pixels[((size_t)(cellY + y) * PageWidth + cellX) * 3];
+			memcpy(destination, source, CellSize * 3);
+		}
+		m_PageDirty = true;
+
+		Entry entry = Entry();
+		entry.GlyphData = generated.GlyphData;
+		entry.GlyphData.AtlasBounds += glm::vec4((float)cellX, (float)cellY, (float)cellX, (float)cellY);
+		entry.Cell = cell;
+		m_LRU.push_front(generated.GlyphData.Codepoint);
+		entry.Usage = m_LRU.begin();
+		m_Entries[generated.GlyphData.Codepoint] = entry;
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Font.h"
+
+#include <list>
+#include <mutex>
+
+namespace GE
+{
+	/*
+	* On-demand glyphs for codepoints missing from a Font's baked atlas.
+	* Misses are generated with msdfgen on worker threads, then placed into a growable page of fixed size cells.
+	* Once the page can't grow, the least recently used glyph is evicted.
+	* Main thread only, besides queued generation.
+	*/
+	class GlyphCache
+	{
+	public:
+		struct Statistics
+		{
+			// Lookups found in page
+			uint64_t Hits = 0;
+			// Lookups not in page yet, generation queued or in flight
+			uint64_t Misses = 0;
+			// Glyphs removed to make room
+			uint64_t Evictions = 0;
+			// Codepoints the font doesn't have or that don't fit a cell
+			uint64_t Failures = 0;
+		};
+
+		// Page cell size, in pixels. Glyphs larger than a cell fail
+		static constexpr uint32_t CellSize = 64;
+		static constexpr uint32_t PageWidth = 512;
+		// Page grows by doubling height up to this, then evicts
+		static constexpr uint32_t MaxPageHeight = 512;
+
+		/*
+		* @param source : font file data, copied
+		* @param scale : atlas pixels per em, see Font::AtlasConfig::Scale
+		*/
+		GlyphCache(Buffer source, float scale);
+		~GlyphCache();
+
+		inline const Statistics& GetStats() const { return m_Stats; }
+		inline uint32_t GetResidentCount() const { return (uint32_t)m_Entries.size(); }
+		inline uint32_t GetCellCapacity() const { return (PageWidth / CellSize) * (m_PageHeight / CellSize); }
+		inline Ref<Texture2D> GetPage() const { return m_Page; }
+		/*
+		* Source, page texels & entries on CPU, page texture on GPU
+		*/
+		Asset::MemoryUsage GetMemoryUsage() const;
+
+		/*
+		* Returns glyph of codepoint if resident, otherwise queues generation & returns nullptr.
+		* Atlas bounds are in page pixels. Pointer is valid until next Update().
+		*/
+		const Font::Glyph* Request(uint32_t codepoint);
+		/*
+		* Returns true if generated glyphs are waiting for Update()
+		*/
+		bool HasCompleted();
+		/*
+		* Places generated glyphs, evicting if needed, & uploads page if changed.
+		* Evicted cells may still be referenced by unflushed vertices, see HasCompleted().
+		*/
+		void Update();
+
+		inline const Buffer& GetSource() const { return m_Shared->Source; }
+
+	private:
+		// Generated on a worker, relative to cell origin
+		struct Generated
+		{
+			Font::Glyph GlyphData = Font::Glyph();
+			// CellSize * CellSize RGB texels
+			std::vector<uint8_t> Pixels = std::vector<uint8_t>();
+			bool Failed = false;
+		};
+
+		/*
+		* Shared with queued generation, which may outlive this cache
+		*/
+		struct Shared
+		{
+			Buffer Source = Buffer();
+			float Scale = 1.0f;
+
+			std::mutex Mutex;
+			std::vector<Generated> Completed = std::vector<Generated>();
+
+			~Shared() { Source.Release(); }
+		};
+
+		struct Entry
+		{
+			Font::Glyph GlyphData = Font::Glyph();
+			uint32_t Cell = 0;
+			// Position in m_LRU, front is most recent
+			std::list<uint32_t>::iterator Usage;
+		};
+
+		static void Generate(Ref<Shared> shared, uint32_t codepoint);
+
+		/*
+		* Returns free cell, growing page or evicting if needed
+		*/
+		uint32_t AllocateCell();
+		void Place(const Generated& generated);
+	private:
+		Ref<Shared> m_Shared = nullptr;
+
+		// <Codepoint, Entry>
+		std::unordered_map<uint32_t, Entry> m_Entries = std::unordered_map<uint32_t, Entry>();
+		std::list<uint32_t> m_LRU = std::list<uint32_t>();
+		std::unordered_set<uint32_t> m_Pending = std::unordered_set<uint32_t>();
+		std::unordered_set<uint32_t> m_Failed = std::unordered_set<uint32_t>();
+		std::vector<uint32_t> m_FreeCells = std::vector<uint32_t>();
+
+		// CPU copy of page, reuploaded when dirty
+		std::vector<uint8_t> m_Pixels = std::vector<uint8_t>();
+		uint32_t m_PageHeight = 0;
+		Ref<Texture2D> m_Page = nullptr;
+		bool m_PageResized = false;
+		bool m_PageDirty = false;
+
+		Statistics m_Stats = Statistics();
+	};
+}
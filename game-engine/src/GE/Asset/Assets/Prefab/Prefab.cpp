@@ -2,7 +2,373 @@
 
 #include "Prefab.h"
 
+#include "GE/Audio/AudioManager.h"
+#include "GE/Scripting/Scripting.h"
+
 namespace GE
 {
+	template<typename T>
+	static void CopyComponent(entt::registry& to, const entt::registry& from, entt::entity toEntity, entt::entity fromEntity)
+	{
+		if (const T* component = from.try_get<T>(fromEntity))
+			to.emplace_or_replace<T>(toEntity, *component);
+	}
+
+	/*
+	* Inserts Component of fromEntity, if it exists, into every Entity of [first, last)
+	*/
+	template<typename T>
+	static void InsertComponent(entt::registry& to, const entt::registry& from, entt::entity fromEntity,
+		std::vector<entt::entity>::const_iterator first, std::vector<entt::entity>::const_iterator last)
+	{
+		if (const T* component = from.try_get<T>(fromEntity))
+			to.insert<T>(first, last, *component);
+	}
+
+	template<typename T>
+	static uint64_t GetComponentSize(const entt::registry& registry, entt::entity entity)
+	{
+		return registry.all_of<T>(entity) ? sizeof(T) : 0;
+	}
+
+	Prefab::Prefab(UUID handle /*= UUID()*/) : Asset(handle, Asset::Type::Prefab)
+	{
+		m_Template = CreateRef<Scene>();
+	}
+
+	Prefab::~Prefab()
+	{
+		m_Nodes.clear();
+		m_Template = nullptr;
+	}
+
+	Ref<Asset> Prefab::GetCopy()
+	{
+		Ref<Prefab> prefab = CreateRef<Prefab>(p_Handle);
+		if (!m_Nodes.empty())
+			prefab->SetTemplate(m_Template, m_Nodes.front().TemplateEntity);
+		return prefab;
+	}
+
+	Asset::MemoryUsage Prefab::GetMemoryUsage() const
+	{
+		MemoryUsage usage = MemoryUsage();
+		const entt::registry& registry = m_Template->m_Registry;
+		for (const Node& node : m_Nodes)
+		{
+			const entt::entity entity = node.TemplateEntity;
+			usage.CPU += sizeof(Node) + node.Children.size() * sizeof(uint32_t);
+			usage.CPU += GetComponentSize<IDComponent>(registry, entity)
+				+ GetComponentSize<TagComponent>(registry, entity)
+				+ GetComponentSize<NameComponent>(registry, entity)
+				+ GetComponentSize<ActiveComponent>(registry, entity)
+				+ GetComponentSize<RelationshipComponent>(registry, entity)
+				+ GetComponentSize<TransformComponent>(registry, entity)
+				+ GetComponentSize<AudioSourceComponent>(registry, entity)
+				+ GetComponentSize<AudioListenerComponent>(registry, entity)
+				+ GetComponentSize<RenderComponent>(registry, entity)
+				+ GetComponentSize<CameraComponent>(registry, entity)
+				+ GetComponentSize<SpriteRendererComponent>(registry, entity)
+				+ GetComponentSize<CircleRendererComponent>(registry, entity)
+				+ GetComponentSize<TextRendererComponent>(registry, entity)
+				+ GetComponentSize<GUIComponent>(registry, entity)
+				+ GetComponentSize<GUICanvasComponent>(registry, entity)
+				+ GetComponentSize<GUILayoutComponent>(registry, entity)
+				+ GetComponentSize<GUIImageComponent>(registry, entity)
+				+ GetComponentSize<GUIButtonComponent>(registry, entity)
+				+ GetComponentSize<GUIInputFieldComponent>(registry, entity)
+				+ GetComponentSize<GUISliderComponent>(registry, entity)
+				+ GetComponentSize<GUICheckboxComponent>(registry, entity)
+				+ GetComponentSize<ScriptComponent>(registry, entity)
+				+ GetComponentSize<Rigidbody2DComponent>(registry, entity)
+				+ GetComponentSize<BoxCollider2DComponent>(registry, entity)
+				+ GetComponentSize<CircleCollider2DComponent>(registry, entity);
+		}
+		return usage;
+	}
+
+	std::vector<Entity> Prefab::GetEntities() const
+	{
+		std::vector<Entity> entities = std::vector<Entity>();
+		entities.reserve(m_Nodes.size());
+		for (const Node& node : m_Nodes)
+			entities.push_back(node.TemplateEntity);
+		return entities;
+	}
+
+	bool Prefab::SetTemplate(Ref<Scene> scene, Entity root)
+	{
+		if (!scene || !scene->EntityExists(root))
+		{
+			GE_CORE_ERROR("Prefab::SetTemplate(Ref<Scene>, Entity) Failed.\n\tRoot Entity doesn't exist in Scene.");
+			return false;
+		}
+
+		GE_PROFILE_FUNCTION();
+
+		m_Template = CreateRef<Scene>();
+		m_Nodes.clear();
+
+		const entt::registry& from = scene->m_Registry;
+		entt::registry& to = m_Template->m_Registry;
+
+		// Root first, parents before children
+		std::vector<Entity> entities = std::vector<Entity>(1, root);
+		for (uint64_t i = 0; i < entities.size(); i++)
+		{
+			const Entity fromEntity = entities[i];
+			const UUID uuid = from.get<IDComponent>(fromEntity).ID;
+			const Entity toEntity = m_Template->CreateEntityWithUUID(uuid, from.get<NameComponent>(fromEntity).Name, from.get<TagComponent>(fromEntity).TagID);
+
+			// Same Components as Scene::GetCopy(), except NativeScriptComponent
+			CopyComponent<ActiveComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<RelationshipComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<TransformComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<AudioSourceComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<AudioListenerComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<RenderComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CameraComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<SpriteRendererComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CircleRendererComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<TextRendererComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<GUIComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUICanvasComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUILayoutComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIImageComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIButtonComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIInputFieldComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUISliderComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUICheckboxComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<ScriptComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<Rigidbody2DComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<BoxCollider2DComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CircleCollider2DComponent>(to, from, toEntity, fromEntity);
+
+			// Runtime handles belong to scene
+			if (Rigidbody2DComponent* rb2D = to.try_get<Rigidbody2DComponent>(toEntity))
+				rb2D->RuntimeBody = nullptr;
+			if (AudioSourceComponent* asc = to.try_get<AudioSourceComponent>(toEntity))
+				asc->ID = 0;
+
+			const RelationshipComponent& rsc = to.get<RelationshipComponent>(toEntity);
+			// Root is its own parent in template, even if it has one in scene
+			if (i == 0)
+				to.replace<RelationshipComponent>(toEntity, uuid, rsc.GetChildren());
+
+			for (const UUID& childID : rsc.GetChildren())
+			{
+				if (Entity child = scene->GetEntityByUUID(childID))
+					entities.push_back(child);
+			}
+		}
+
+		return Resolve();
+	}
+
+	bool Prefab::Resolve()
+	{
+		m_Nodes.clear();
+
+		const entt::registry& registry = m_Template->m_Registry;
+		std::unordered_map<UUID, Entity> entityMap = std::unordered_map<UUID, Entity>();
+		auto view = registry.view<IDComponent>();
+		entityMap.reserve(view.size());
+		for (entt::entity entity : view)
+			entityMap.emplace(view.get<IDComponent>(entity).ID, Entity((uint32_t)entity));
+
+		Entity root = Entity();
+		for (const auto& [uuid, entity] : entityMap)
+		{
+			const RelationshipComponent* rsc = registry.try_get<RelationshipComponent>(entity);
+			if (rsc && rsc->GetParent() != uuid && entityMap.find(rsc->GetParent()) != entityMap.end())
+				continue;
+
+			if (root)
+			{
+				GE_CORE_ERROR("Prefab::Resolve() Failed.\n\tTemplate has more than one root Entity.\n\tHandle : {0}", (uint64_t)p_Handle);
+				return false;
+			}
+			root = entity;
+		}
+
+		if (!root)
+		{
+			GE_CORE_ERROR("Prefab::Resolve() Failed.\n\tTemplate has no root Entity.\n\tHandle : {0}", (uint64_t)p_Handle);
+			return false;
+		}
+
+		Node rootNode = Node();
+		rootNode.TemplateEntity = root;
+		m_Nodes.push_back(rootNode);
+		for (uint32_t i = 0; i < m_Nodes.size(); i++)
+		{
+			const RelationshipComponent* rsc = registry.try_get<RelationshipComponent>(m_Nodes[i].TemplateEntity);
+			if (!rsc)
+				continue;
+
+			for (const UUID& childID : rsc->GetChildren())
+			{
+				auto it = entityMap.find(childID);
+				if (it == entityMap.end())
+					continue;
+
+				Node node = Node();
+				node.TemplateEntity = it->second;
+				node.Parent = (int32_t)i;
+				m_Nodes[i].Children.push_back((uint32_t)m_Nodes.size());
+				m_Nodes.push_back(node);
+			}
+		}
+
+		if (m_Nodes.size() != entityMap.size())
+			GE_CORE_WARN("Prefab::Resolve() Template Entities not reachable from root are skipped.\n\tReachable : {0}\n\tTotal : {1}", m_Nodes.size(), entityMap.size());
+
+		m_HasStaticSprites = false;
+		for (const Node& node : m_Nodes)
+		{
+			const SpriteRendererComponent* src = registry.try_get<SpriteRendererComponent>(node.TemplateEntity);
+			if (src && src->Static)
+			{
+				m_HasStaticSprites = true;
+				break;
+			}
+		}
+		return true;
+	}
+
+	std::vector<Entity> Prefab::Instantiate(Ref<Scene> scene, uint32_t count, const std::vector<TransformComponent>& transforms /*= std::vector<TransformComponent>()*/)
+	{
+		std::vector<Entity> roots = std::vector<Entity>();
+		if (!scene || !count || m_Nodes.empty())
+			return roots;
+
+		GE_PROFILE_FUNCTION();
+
+		const entt::registry& from = m_Template->m_Registry;
+		entt::registry& to = scene->m_Registry;
+		const uint64_t nodeCount = m_Nodes.size();
+
+		// Node major, instances of one template Entity are contiguous so each of its Components is inserted once
+		std::vector<entt::entity> entities = std::vector<entt::entity>(nodeCount * count);
+		to.create(entities.begin(), entities.end());
+		const std::vector<UUID> uuids = std::vector<UUID>(entities.size());
+
+		const Scene::Config& config = scene->GetConfig();
+		for (uint64_t node = 0; node < nodeCount; node++)
+		{
+			const Node& templateNode = m_Nodes[node];
+			const entt::entity fromEntity = templateNode.TemplateEntity;
+			const auto first = entities.cbegin() + node * count;
+			const auto last = first + count;
+
+			// Relationships by index, parent & children instances share i
+			for (uint32_t i = 0; i < count; i++)
+			{
+				const uint64_t index = node * count + i;
+				to.emplace<IDComponent>(entities[index], uuids[index]);
+
+				// Root is its own parent
+				const UUID& parent = templateNode.Parent < 0 ? uuids[index] : uuids[templateNode.Parent * count + i];
+				std::vector<UUID> children = std::vector<UUID>();
+				children.reserve(templateNode.Children.size());
+				for (uint32_t child : templateNode.Children)
+					children.push_back(uuids[child * count + i]);
+				to.emplace<RelationshipComponent>(entities[index], parent, children);
+			}
+
+			if (templateNode.Parent < 0 && !transforms.empty())
+			{
+				// Keeps template Pivot
+				const TransformComponent& rootTransform = from.get<TransformComponent>(fromEntity);
+				for (uint32_t i = 0; i < count; i++)
+				{
+					TransformComponent& trsc = to.emplace<TransformComponent>(entities[i], rootTransform);
+					if (i < transforms.size())
+					{
+						trsc.Translation = transforms[i].Translation;
+						trsc.Rotation = transforms[i].Rotation;
+						trsc.Scale = transforms[i].Scale;
+					}
+				}
+			}
+			else
+				InsertComponent<TransformComponent>(to, from, fromEntity, first, last);
+
+			InsertComponent<TagComponent>(to, from, fromEntity, first, last);
+			InsertComponent<NameComponent>(to, from, fromEntity, first, last);
+			InsertComponent<ActiveComponent>(to, from, fromEntity, first, last);
+
+			InsertComponent<AudioSourceComponent>(to, from, fromEntity, first, last);
+			InsertComponent<AudioListenerComponent>(to, from, fromEntity, first, last);
+
+			InsertComponent<RenderComponent>(to, from, fromEntity, first, last);
+			InsertComponent<CameraComponent>(to, from, fromEntity, first, last);
+			InsertComponent<SpriteRendererComponent>(to, from, fromEntity, first, last);
+			InsertComponent<CircleRendererComponent>(to, from, fromEntity, first, last);
+			InsertComponent<TextRendererComponent>(to, from, fromEntity, first, last);
+
+			InsertComponent<GUIComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUICanvasComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUILayoutComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUIImageComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUIButtonComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUIInputFieldComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUISliderComponent>(to, from, fromEntity, first, last);
+			InsertComponent<GUICheckboxComponent>(to, from, fromEntity, first, last);
+			InsertComponent<ScriptComponent>(to, from, fromEntity, first, last);
+
+			InsertComponent<Rigidbody2DComponent>(to, from, fromEntity, first, last);
+			InsertComponent<BoxCollider2DComponent>(to, from, fromEntity, first, last);
+			InsertComponent<CircleCollider2DComponent>(to, from, fromEntity, first, last);
+
+			// Same as Scene::OnEntityComponentAdded<CameraComponent>()
+			if (from.all_of<CameraComponent>(fromEntity))
+			{
+				for (auto it = first; it != last; it++)
+					to.get<CameraComponent>(*it).ActiveCamera.SetViewport(config.ViewportWidth, config.ViewportHeight);
+			}
+		}
+
+		// Same order as Scene::OnRuntimeStart()
+		if (!scene->IsStopped())
+		{
+			for (uint64_t node = 0; node < nodeCount; node++)
+			{
+				if (!from.all_of<Rigidbody2DComponent>(m_Nodes[node].TemplateEntity))
+					continue;
+				for (uint32_t i = 0; i < count; i++)
+					scene->CreatePhysics2DBody(Entity((uint32_t)entities[node * count + i]));
+			}
+			for (uint64_t node = 0; node < nodeCount; node++)
+			{
+				if (!from.all_of<AudioSourceComponent, TransformComponent>(m_Nodes[node].TemplateEntity))
+					continue;
+				for (uint32_t i = 0; i < count; i++)
+				{
+					const entt::entity entity = entities[node * count + i];
+					AudioManager::GenerateSource(to.get<AudioSourceComponent>(entity), to.get<TransformComponent>(entity).Translation, glm::vec3(0.0f));
+				}
+			}
+			for (uint64_t node = 0; node < nodeCount; node++)
+			{
+				if (!from.all_of<ScriptComponent>(m_Nodes[node].TemplateEntity))
+					continue;
+				for (uint32_t i = 0; i < count; i++)
+					Scripting::OnCreateScript(scene.get(), Entity((uint32_t)entities[node * count + i]));
+			}
+		}
+		// Only new static sprites need baking, dynamic instances are drawn every frame
+		if (m_HasStaticSprites)
+			scene->MarkStaticDirty();
+		scene->m_PrefabTemplates[p_Handle] = m_Template;
 
-}
\ No newline at end of file
+		roots.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+			roots.push_back(Entity((uint32_t)entities[i]));
+		return roots;
+	}
+}
@@ -2,10 +2,77 @@
 
 #include "../Asset.h"
 
+#include "GE/Asset/Assets/Scene/Scene.h"
+
+#include <vector>
+
 namespace GE
 {
+	/*
+	* Template of an Entity hierarchy, instanced into Scenes without probing Components per instance.
+	* Template Entities live in a Scene that never runs. Its hierarchy is resolved once, see Resolve()
+	*
+	* NativeScriptComponent isn't part of a template, it can't be serialized.
+	* Instances of a ScriptComponent use the Script default field values.
+	*/
 	class Prefab : public Asset
 	{
-		// TODO :
+	public:
+		Prefab(UUID handle = UUID());
+		~Prefab() override;
+
+		/*
+		*	Returns Copy of Prefab Asset by CreateRef<Prefab>()
+		*/
+		Ref<Asset> GetCopy() override;
+		MemoryUsage GetMemoryUsage() const override;
+
+		/*
+		* Entities of template, add to it directly then call Resolve()
+		*/
+		Ref<Scene> GetTemplate() const { return m_Template; }
+		// Root first, parents before children. Empty until resolved
+		std::vector<Entity> GetEntities() const;
+		uint32_t GetEntityCount() const { return (uint32_t)m_Nodes.size(); }
+
+		/*
+		* Copies root & its descendants from scene into the template, replacing it.
+		* Returns false if root doesn't exist in scene
+		*
+		* @param scene : Scene to copy from
+		* @param root : Entity of scene, becomes root of template
+		*/
+		bool SetTemplate(Ref<Scene> scene, Entity root);
+		/*
+		* Resolves parent & children of each template Entity to node indices.
+		* Returns false if template doesn't have exactly one root
+		*/
+		bool Resolve();
+
+		/*
+		* Creates count instances of template in scene with new UUIDs.
+		* Each Component of a template Entity is inserted for all instances at once,
+		* relationships are wired in the same pass. Running Scenes also create bodies, sources & scripts.
+		* Returns root Entity of each instance
+		*
+		* @param scene : Scene to add instances to
+		* @param count : number of instances
+		* @param transforms : root Translation, Rotation & Scale per instance. Template root transform if fewer than count
+		*/
+		std::vector<Entity> Instantiate(Ref<Scene> scene, uint32_t count, const std::vector<TransformComponent>& transforms = std::vector<TransformComponent>());
+
+	private:
+		struct Node
+		{
+			Entity TemplateEntity = Entity();
+			// Index into m_Nodes, -1 for root
+			int32_t Parent = -1;
+			std::vector<uint32_t> Children = std::vector<uint32_t>();
+		};
+
+		Ref<Scene> m_Template = nullptr;
+		std::vector<Node> m_Nodes = std::vector<Node>();
+		// Template has a SpriteRendererComponent::Static sprite, set by Resolve()
+		bool m_HasStaticSprites = false;
 	};
 }
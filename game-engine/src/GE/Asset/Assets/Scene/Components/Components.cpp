@@ -139,6 +139,21 @@ namespace GE
 		return ret;
 	}
 
+	const std::pair<glm::vec2, glm::vec2> TransformComponent::GetBounds(const glm::vec3& translationOffset, const glm::vec3& rotationOffset) const
+	{
+		// Pivot vertices extend up to a full unit from origin, before Scale
+		const glm::mat4 transform = GetTransform(translationOffset, rotationOffset);
+
+		std::pair<glm::vec2, glm::vec2> ret = std::pair<glm::vec2, glm::vec2>(glm::vec2(FLT_MAX), glm::vec2(-FLT_MAX));
+		for (int i = 0; i < 4; i++)
+		{
+			const glm::vec4 corner = transform * glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, 0.0f, 1.0f);
+			ret.first = glm::min(ret.first, glm::vec2(corner));
+			ret.second = glm::max(ret.second, glm::vec2(corner));
+		}
+		return ret;
+	}
+
 	const glm::vec3 TransformComponent::GetOffsetTranslation() const
 	{
 		return Translation + PivotOffset;
@@ -187,7 +202,8 @@ namespace GE
 #pragma region AudioSource
 	void AudioSourceComponent::Play(const glm::vec3& position, const glm::vec3& velocity) const
 	{
-		Ref<Audio> audio = Project::GetAsset<Audio>(AssetHandle);
+		// Skipped while audio loads
+		Ref<Audio> audio = Project::GetAssetAsync<Audio>(AssetHandle);
 		if (!audio || audio->GetType() != Asset::Type::Audio)
 			return;
 
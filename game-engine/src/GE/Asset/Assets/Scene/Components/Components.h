@@ -76,8 +76,8 @@ namespace GE
 			Children = std::vector<UUID>();
 		}
 
-		const UUID& GetParent() { return Parent; }
-		const std::vector<UUID>& GetChildren() { return Children; }
+		const UUID& GetParent() const { return Parent; }
+		const std::vector<UUID>& GetChildren() const { return Children; }
 
 		bool HasChild(const UUID& id);
 		void AddChild(const UUID& id);
@@ -147,6 +147,14 @@ namespace GE
 		* Returns min & max bounds of entity
 		*/
 		const std::pair<glm::vec2, glm::vec2> GetBounds() const;
+		/*
+		* Returns world min & max bounds of entity.
+		* Conservative, covers every Pivot.
+		*
+		* @param translationOffset : offset from entity to parent
+		* @param rotationOffset : offset from entity to parent
+		*/
+		const std::pair<glm::vec2, glm::vec2> GetBounds(const glm::vec3& translationOffset, const glm::vec3& rotationOffset) const;
 
 		void SetPivot(const Pivot& pivot);
 	};
@@ -339,6 +347,11 @@ namespace GE
 		UUID AssetHandle = 0;
 		float TilingFactor = 1.0f;
 		glm::vec4 Color = glm::vec4(1.0f);
+		/*
+		* Baked into a StaticBatch by Layer instead of drawn every frame.
+		* Changes made outside of Scene & Scripting need Scene::MarkStaticDirty()
+		*/
+		bool Static = false;
 
 		SpriteRendererComponent() = default;
 		SpriteRendererComponent(const SpriteRendererComponent&) = default;
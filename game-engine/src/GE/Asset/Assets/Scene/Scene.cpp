@@ -12,6 +12,8 @@
 
 #include "GE/Scripting/Scripting.h"
 
+#include <atomic>
+
 namespace GE
 {
 	template<typename T>
@@ -40,9 +42,14 @@ namespace GE
 
 #pragma region Scene
 
+	// Shared by all Scenes, see Scene::GetStaticRevision()
+	// Atomic, ScenePartition decodes staging Scenes on worker threads
+	static std::atomic<uint64_t> s_StaticRevision = 0;
+
 	Scene::Scene(UUID handle, const Config& config /*= Config()*/) : Asset(handle, Scene::Type::Scene)
 	{
 		m_Config = Config(config);
+		MarkStaticDirty();
 	}
 
 	Scene::~Scene()
@@ -103,6 +110,7 @@ namespace GE
 			CopyComponent<BoxCollider2DComponent>(newSceneRegistry, sceneRegistry, entityMap);
 			CopyComponent<CircleCollider2DComponent>(newSceneRegistry, sceneRegistry, entityMap);
 		}
+		newScene->m_PrefabTemplates = m_PrefabTemplates;
 
 		return newScene;
 	}
@@ -168,6 +176,8 @@ namespace GE
 		default:
 			break;
 		}
+
+		UpdateSpatialIndex();
 	}
 
 	void Scene::OnStop()
@@ -177,6 +187,17 @@ namespace GE
 		DestroyScripting();
 		DestroyAudio();
 		DestroyPhysics2D();
+
+		// Unloaded cells rejoin the stopped Scene
+		if (m_Partition)
+		{
+			// Kept while any cell couldn't be restored, so its Entities aren't lost. See OnRuntimeStart()
+			if (m_Partition->Restore())
+				m_Partition.reset();
+			else
+				GE_CORE_ERROR("Scene Partition couldn't restore every cell. Unloaded Entities are kept until next run.");
+			m_SpatialIndexRebuild = true;
+		}
 	}
 
 	void Scene::OnStep(int steps)
@@ -200,6 +221,10 @@ namespace GE
 		InitializePhysics2D();
 		InitializeAudio();
 		InitializeScripting();
+
+		// Partition kept by OnStop() still holds cells that couldn't be restored, it streams them in again
+		if (!m_Partition && m_PartitionConfig.CellSize > 0.0f)
+			m_Partition = CreateScope<ScenePartition>(this, m_PartitionConfig);
 	}
 	
 	void Scene::OnRuntimeUpdate(Timestep ts)
@@ -207,6 +232,9 @@ namespace GE
 		UpdatePhysics2D(ts);
 		UpdateScripting(ts);
 		UpdateAudio(ts);
+
+		if (m_Partition)
+			m_Partition->Update();
 	}
 
 	void Scene::OnPauseStart()
@@ -236,80 +264,94 @@ namespace GE
 		m_PhysicsWorld = new b2World({ 0.0f, -9.8f });
 		std::vector<Entity> entities = GetAllEntitiesWith<Rigidbody2DComponent>();
 		for (Entity entity : entities)
-		{
-			auto& trsc = GetComponent<TransformComponent>(entity);
-			auto& rb2D = GetComponent<Rigidbody2DComponent>(entity);
-			const glm::vec3& translation = trsc.GetOffsetTranslation();
+			CreatePhysics2DBody(entity);
+		entities.clear();
+		entities = std::vector<Entity>();
+	}
+
+	void Scene::CreatePhysics2DBody(Entity entity)
+	{
+		if (!m_PhysicsWorld)
+			return;
 
-			//	Box Collider
+		auto& trsc = GetComponent<TransformComponent>(entity);
+		auto& rb2D = GetComponent<Rigidbody2DComponent>(entity);
+		const glm::vec3& translation = trsc.GetOffsetTranslation();
+
+		//	Box Collider
+		{
+			GE_PROFILE_SCOPE("Scene - InitializePhysics2D : Box Collider");
+			if (HasComponent<BoxCollider2DComponent>(entity))
 			{
-				GE_PROFILE_SCOPE("Scene - InitializePhysics2D : Box Collider");
-				if (HasComponent<BoxCollider2DComponent>(entity))
-				{
-					auto& bc2D = GetComponent<BoxCollider2DComponent>(entity);
+				auto& bc2D = GetComponent<BoxCollider2DComponent>(entity);
 
-					b2BodyDef bodyDef;
-					bodyDef.type = Physics::Rigidbody2DTypeToBox2DBody(rb2D.Type);
-					// TODO : Offset for Middle Pivots(?)
-					bodyDef.position.Set(translation.x, translation.y);
-					bodyDef.angle = trsc.Rotation.z;
+				b2BodyDef bodyDef;
+				bodyDef.type = Physics::Rigidbody2DTypeToBox2DBody(rb2D.Type);
+				// TODO : Offset for Middle Pivots(?)
+				bodyDef.position.Set(translation.x, translation.y);
+				bodyDef.angle = trsc.Rotation.z;
 
-					b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
-					body->SetFixedRotation(rb2D.FixedRotation);
-					rb2D.RuntimeBody = body;
+				b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
+				body->SetFixedRotation(rb2D.FixedRotation);
+				rb2D.RuntimeBody = body;
 
-					float halfW = (bc2D.Size.x * trsc.Scale.x) * 0.5f;
-					float halfH = (bc2D.Size.y * trsc.Scale.y) * 0.5f;
+				float halfW = (bc2D.Size.x * trsc.Scale.x) * 0.5f;
+				float halfH = (bc2D.Size.y * trsc.Scale.y) * 0.5f;
 
-					b2PolygonShape polygonShape;
-					polygonShape.SetAsBox(halfW, halfH);
+				b2PolygonShape polygonShape;
+				polygonShape.SetAsBox(halfW, halfH);
 
-					b2FixtureDef fixtureDef;
-					fixtureDef.shape = &polygonShape;
-					fixtureDef.density = bc2D.Density;
-					fixtureDef.friction = bc2D.Friction;
-					fixtureDef.restitution = bc2D.Restitution;
-					fixtureDef.restitutionThreshold = bc2D.RestitutionThreshold;
+				b2FixtureDef fixtureDef;
+				fixtureDef.shape = &polygonShape;
+				fixtureDef.density = bc2D.Density;
+				fixtureDef.friction = bc2D.Friction;
+				fixtureDef.restitution = bc2D.Restitution;
+				fixtureDef.restitutionThreshold = bc2D.RestitutionThreshold;
 
-					body->CreateFixture(&fixtureDef);
-				}
+				body->CreateFixture(&fixtureDef);
 			}
+		}
 
-			//	Circle Collider
+		//	Circle Collider
+		{
+			GE_PROFILE_SCOPE("Scene - InitializePhysics2D : Circle Collider");
+			if (HasComponent<CircleCollider2DComponent>(entity))
 			{
-				GE_PROFILE_SCOPE("Scene - InitializePhysics2D : Circle Collider");
-				if (HasComponent<CircleCollider2DComponent>(entity))
-				{
-					auto& cc2D = GetComponent<CircleCollider2DComponent>(entity);
-
-					b2BodyDef bodyDef;
-					bodyDef.type = Physics::Rigidbody2DTypeToBox2DBody(rb2D.Type);
-					bodyDef.position.Set(translation.x, translation.y);
-					bodyDef.angle = trsc.Rotation.z;
-
-					b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
-					body->SetFixedRotation(rb2D.FixedRotation);
-
-					rb2D.RuntimeBody = body;
-
-					b2CircleShape circleShape;
-					
-					circleShape.m_p.Set(cc2D.Offset.x, cc2D.Offset.y);
-					circleShape.m_radius = cc2D.Radius * trsc.Scale.x;
-		
-					b2FixtureDef fixtureDef;
-					fixtureDef.shape = &circleShape;
-					fixtureDef.density = cc2D.Density;
-					fixtureDef.friction = cc2D.Friction;
-					fixtureDef.restitution = cc2D.Restitution;
-					fixtureDef.restitutionThreshold = cc2D.RestitutionThreshold;
-
-					body->CreateFixture(&fixtureDef);
-				}
+				auto& cc2D = GetComponent<CircleCollider2DComponent>(entity);
+
+				b2BodyDef bodyDef;
+				bodyDef.type = Physics::Rigidbody2DTypeToBox2DBody(rb2D.Type);
+				bodyDef.position.Set(translation.x, translation.y);
+				bodyDef.angle = trsc.Rotation.z;
+
+				b2Body* body = m_PhysicsWorld->CreateBody(&bodyDef);
+				body->SetFixedRotation(rb2D.FixedRotation);
+
+				rb2D.RuntimeBody = body;
+
+				b2CircleShape circleShape;
+				
+				circleShape.m_p.Set(cc2D.Offset.x, cc2D.Offset.y);
+				circleShape.m_radius = cc2D.Radius * trsc.Scale.x;
+	
+				b2FixtureDef fixtureDef;
+				fixtureDef.shape = &circleShape;
+				fixtureDef.density = cc2D.Density;
+				fixtureDef.friction = cc2D.Friction;
+				fixtureDef.restitution = cc2D.Restitution;
+				fixtureDef.restitutionThreshold = cc2D.RestitutionThreshold;
+
+				body->CreateFixture(&fixtureDef);
 			}
 		}
-		entities.clear();
-		entities = std::vector<Entity>();
+	}
+
+	void Scene::DestroyPhysics2DBody(Entity entity)
+	{
+		auto& rb2D = GetComponent<Rigidbody2DComponent>(entity);
+		if (m_PhysicsWorld && rb2D.RuntimeBody)
+			m_PhysicsWorld->DestroyBody((b2Body*)rb2D.RuntimeBody);
+		rb2D.RuntimeBody = nullptr;
 	}
 	
 	void Scene::UpdatePhysics2D(Timestep ts)
@@ -504,6 +546,22 @@ namespace GE
 		entity.OnComponentAdded<CameraComponent>();
 	}
 
+	template<>
+	void Scene::OnEntityComponentAdded<SpriteRendererComponent>(Entity entity, SpriteRendererComponent& src)
+	{
+		if (src.Static)
+			MarkStaticDirty();
+		entity.OnComponentAdded<SpriteRendererComponent>();
+	}
+
+	template<>
+	void Scene::OnEntityComponentAdded<Rigidbody2DComponent>(Entity entity, Rigidbody2DComponent& rb2dc)
+	{
+		// Static sprites of entity & its children may now move, see Scene::IsStatic()
+		MarkStaticDirty();
+		entity.OnComponentAdded<Rigidbody2DComponent>();
+	}
+
 	template<>
 	void Scene::OnEntityComponentAdded<RelationshipComponent>(Entity entity, RelationshipComponent& rsc)
 	{
@@ -612,6 +670,14 @@ namespace GE
 		Entity retEntity = {};
 		if (uuid != 0)
 		{
+			// Fast path, validated since index may be a frame behind
+			if (Entity indexedEntity = m_SpatialIndex.GetEntity(uuid))
+			{
+				if (m_Registry.valid(indexedEntity) && HasComponent<IDComponent>(indexedEntity)
+					&& GetComponent<IDComponent>(indexedEntity).ID == uuid)
+					return indexedEntity;
+			}
+
 			std::vector<Entity> entities = GetAllEntitiesWith<IDComponent>();
 			for (Entity entity : entities)
 			{
@@ -694,8 +760,99 @@ namespace GE
 		return renderEntities;
 	}
 
+	void Scene::MarkStaticDirty()
+	{
+		m_StaticRevision = ++s_StaticRevision;
+	}
+
+	bool Scene::IsStatic(Entity entity)
+	{
+		if (!HasComponent<SpriteRendererComponent>(entity) || !GetComponent<SpriteRendererComponent>(entity).Static)
+			return false;
+
+		// Children are offset from parents, a body moving any ancestor moves entity
+		while (entity)
+		{
+			if (HasComponent<Rigidbody2DComponent>(entity)
+				&& GetComponent<Rigidbody2DComponent>(entity).Type != Rigidbody2DComponent::BodyType::Static)
+				return false;
+
+			auto& idc = GetComponent<IDComponent>(entity);
+			auto& rsc = GetComponent<RelationshipComponent>(entity);
+			if (rsc.Parent == idc.ID) // Is Parent
+				break;
+			entity = GetEntityByUUID(rsc.Parent);
+		}
+		return true;
+	}
+
+	void Scene::GetAssetHandles(std::unordered_set<UUID>& outHandles)
+	{
+		auto add = [&outHandles](const UUID& handle) { if (handle) outHandles.insert(handle); };
+
+		for (auto e : m_Registry.view<AudioSourceComponent>())
+			add(m_Registry.get<AudioSourceComponent>(e).AssetHandle);
+		for (auto e : m_Registry.view<SpriteRendererComponent>())
+			add(m_Registry.get<SpriteRendererComponent>(e).AssetHandle);
+		for (auto e : m_Registry.view<CircleRendererComponent>())
+			add(m_Registry.get<CircleRendererComponent>(e).AssetHandle);
+		for (auto e : m_Registry.view<TextRendererComponent>())
+			add(m_Registry.get<TextRendererComponent>(e).AssetHandle);
+		for (auto e : m_Registry.view<GUIImageComponent>())
+			add(m_Registry.get<GUIImageComponent>(e).TextureHandle);
+		for (auto e : m_Registry.view<GUIButtonComponent>())
+		{
+			const GUIButtonComponent& button = m_Registry.get<GUIButtonComponent>(e);
+			add(button.FontAssetHandle);
+			add(button.BackgroundTextureHandle);
+			add(button.DisabledTextureHandle);
+			add(button.EnabledTextureHandle);
+			add(button.HoveredTextureHandle);
+			add(button.SelectedTextureHandle);
+			add(button.ForegroundTextureHandle);
+		}
+		for (auto e : m_Registry.view<GUIInputFieldComponent>())
+		{
+			const GUIInputFieldComponent& inputField = m_Registry.get<GUIInputFieldComponent>(e);
+			add(inputField.BackgroundTextureHandle);
+			add(inputField.FontAssetHandle);
+		}
+		for (auto e : m_Registry.view<GUISliderComponent>())
+		{
+			const GUISliderComponent& slider = m_Registry.get<GUISliderComponent>(e);
+			add(slider.BackgroundTextureHandle);
+			add(slider.DisabledTextureHandle);
+			add(slider.EnabledTextureHandle);
+			add(slider.HoveredTextureHandle);
+			add(slider.SelectedTextureHandle);
+			add(slider.ForegroundTextureHandle);
+		}
+		for (auto e : m_Registry.view<GUICheckboxComponent>())
+		{
+			const GUICheckboxComponent& checkbox = m_Registry.get<GUICheckboxComponent>(e);
+			add(checkbox.BackgroundTextureHandle);
+			add(checkbox.DisabledTextureHandle);
+			add(checkbox.EnabledTextureHandle);
+			add(checkbox.HoveredTextureHandle);
+			add(checkbox.SelectedTextureHandle);
+			add(checkbox.ForegroundTextureHandle);
+		}
+		for (auto e : m_Registry.view<ScriptComponent>())
+			add(m_Registry.get<ScriptComponent>(e).AssetHandle);
+
+		// Instantiated again from template, ex. by scripts
+		for (const auto& [handle, prefabTemplate] : m_PrefabTemplates)
+		{
+			add(handle);
+			if (prefabTemplate)
+				prefabTemplate->GetAssetHandles(outHandles);
+		}
+	}
+
 	void Scene::SetEntityParent(Entity child, const UUID& parentID)
 	{
+		MarkStaticDirty();
+
 		auto& childIDC = GetOrAddComponent<IDComponent>(child);
 		auto& childRSC = GetOrAddComponent<RelationshipComponent>(child);
 		if (childRSC.Parent != childIDC.ID) // Parent isn't self, meaning parent needs to know it no longer has this child
@@ -720,6 +877,110 @@ namespace GE
 		entities = std::vector<Entity>();
 	}
 
+	void Scene::UpdateSpatialIndex()
+	{
+		GE_PROFILE_FUNCTION();
+
+		struct Pending
+		{
+			entt::entity ID;
+			glm::vec3 TranslationOffset;
+			glm::vec3 RotationOffset;
+		};
+		std::vector<Pending> stack = std::vector<Pending>();
+
+		// Entities that may not be indexed yet, mapped once
+		// instead of a linear GetEntityByUUID per child
+		std::unordered_map<UUID, entt::entity> entityMap;
+		if (m_SpatialIndexRebuild)
+		{
+			auto idView = m_Registry.view<IDComponent>();
+			entityMap.reserve(idView.size());
+			for (auto e : idView)
+				entityMap.emplace(idView.get<IDComponent>(e).ID, e);
+
+			// Walk from roots, accumulating parent offsets
+			auto view = m_Registry.view<IDComponent, RelationshipComponent, TransformComponent>();
+			for (auto e : view)
+			{
+				if (view.get<IDComponent>(e).ID == view.get<RelationshipComponent>(e).Parent)
+					stack.push_back({ e, glm::vec3(0.0f), glm::vec3(0.0f) });
+			}
+		}
+		else
+		{
+			// Compares against what each Entity was indexed with, catching every TransformComponent writer.
+			// Entities without IndexedTransform are new, ex. created, restored by ScenePartition or instantiated
+			auto view = m_Registry.view<IDComponent, RelationshipComponent, TransformComponent>();
+			for (auto e : view)
+			{
+				const auto& trsc = view.get<TransformComponent>(e);
+				const UUID& parentID = view.get<RelationshipComponent>(e).Parent;
+				const IndexedTransform* itc = m_Registry.try_get<IndexedTransform>(e);
+				if (!itc || itc->Translation != trsc.Translation || itc->Rotation != trsc.Rotation
+					|| itc->Scale != trsc.Scale || itc->Parent != parentID)
+					entityMap.emplace(view.get<IDComponent>(e).ID, e);
+			}
+			if (entityMap.empty())
+				return;
+
+			// Walk from each dirty entity, accumulating offsets of its ancestors
+			for (const auto& [id, e] : entityMap)
+			{
+				glm::vec3 translationOffset = glm::vec3(0.0f);
+				glm::vec3 rotationOffset = glm::vec3(0.0f);
+				UUID currentID = id;
+				const RelationshipComponent* rsc = &m_Registry.get<RelationshipComponent>(e);
+				bool walked = true;
+				while (rsc->Parent != currentID) // Isn't Parent
+				{
+					// A dirty ancestor walks entity with its own subtree,
+					// entities without a valid root aren't indexed
+					Entity parent = entityMap.find(rsc->Parent) == entityMap.end() ? GetEntityByUUID(rsc->Parent) : Entity();
+					if (!parent || !m_Registry.all_of<RelationshipComponent, TransformComponent>(parent))
+					{
+						walked = false;
+						break;
+					}
+
+					const auto& parentTRSC = m_Registry.get<TransformComponent>(parent);
+					translationOffset += parentTRSC.Translation;
+					rotationOffset += parentTRSC.Rotation;
+					currentID = rsc->Parent;
+					rsc = &m_Registry.get<RelationshipComponent>(parent);
+				}
+
+				if (walked)
+					stack.push_back({ e, translationOffset, rotationOffset });
+			}
+		}
+		m_SpatialIndexRebuild = false;
+
+		while (!stack.empty())
+		{
+			const Pending pending = stack.back();
+			stack.pop_back();
+			if (!m_Registry.all_of<IDComponent, RelationshipComponent, TransformComponent>(pending.ID))
+				continue;
+
+			const auto& idc = m_Registry.get<IDComponent>(pending.ID);
+			const auto& rsc = m_Registry.get<RelationshipComponent>(pending.ID);
+			const auto& trsc = m_Registry.get<TransformComponent>(pending.ID);
+			m_SpatialIndex.Insert(idc.ID, Entity((uint32_t)pending.ID), trsc.GetBounds(pending.TranslationOffset, pending.RotationOffset));
+			m_Registry.emplace_or_replace<IndexedTransform>(pending.ID, IndexedTransform{ trsc.Translation, trsc.Rotation, trsc.Scale, rsc.Parent });
+
+			const glm::vec3 childTranslationOffset = pending.TranslationOffset + trsc.Translation;
+			const glm::vec3 childRotationOffset = pending.RotationOffset + trsc.Rotation;
+			for (const UUID& childID : rsc.GetChildren())
+			{
+				if (entityMap.find(childID) != entityMap.end())
+					stack.push_back({ entityMap.at(childID), childTranslationOffset, childRotationOffset });
+				else if (Entity child = GetEntityByUUID(childID))
+					stack.push_back({ (entt::entity)child, childTranslationOffset, childRotationOffset });
+			}
+		}
+	}
+
 	void Scene::SyncCamera(Entity entity, const glm::vec3& position, const glm::vec3& rotation)
 	{
 		if (HasComponent<CameraComponent>(entity))
@@ -751,6 +1012,47 @@ namespace GE
 		return entity;
 	}
 
+	std::vector<Entity> Scene::CreateEntities(uint32_t count, const std::string& name, uint32_t tagID, const std::vector<uint64_t>& layerIDs /*= std::vector<uint64_t>()*/)
+	{
+		std::vector<Entity> entities = std::vector<Entity>();
+		if (!count)
+			return entities;
+
+		GE_PROFILE_FUNCTION();
+
+		// Range calls reserve storage once for all Entities
+		std::vector<entt::entity> internalEntities = std::vector<entt::entity>(count);
+		m_Registry.create(internalEntities.begin(), internalEntities.end());
+
+		std::vector<IDComponent> ids = std::vector<IDComponent>();
+		std::vector<RelationshipComponent> relationships = std::vector<RelationshipComponent>();
+		ids.reserve(count);
+		relationships.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const UUID uuid = UUID();
+			ids.emplace_back(uuid);
+			// Root, its own parent. See OnEntityComponentAdded<RelationshipComponent>()
+			relationships.emplace_back(uuid);
+		}
+
+		// Same Components as CreateEntityWithUUID()
+		const auto first = internalEntities.begin();
+		const auto last = internalEntities.end();
+		m_Registry.insert<IDComponent>(first, last, ids.begin());
+		m_Registry.insert<TagComponent>(first, last, TagComponent(tagID));
+		m_Registry.insert<NameComponent>(first, last, NameComponent(name));
+		m_Registry.insert<ActiveComponent>(first, last);
+		m_Registry.insert<RelationshipComponent>(first, last, relationships.begin());
+		m_Registry.insert<TransformComponent>(first, last);
+		m_Registry.insert<RenderComponent>(first, last, RenderComponent(false, layerIDs));
+
+		entities.reserve(count);
+		for (entt::entity internalEntity : internalEntities)
+			entities.push_back(Entity((uint32_t)internalEntity));
+		return entities;
+	}
+
 	Entity Scene::DuplicateEntity(Entity entity)
 	{
 		std::string name = GetComponent<NameComponent>(entity).Name;
@@ -830,6 +1132,8 @@ namespace GE
 
 	void Scene::DestroyEntity(Entity entity)
 	{
+		MarkStaticDirty();
+
 		auto& idc = GetComponent<IDComponent>(entity);
 		auto& rsc = GetComponent<RelationshipComponent>(entity);
 
@@ -855,6 +1159,7 @@ namespace GE
 				DestroyEntity(child);
 			}
 		}
+		m_SpatialIndex.Remove(idc.ID);
 		m_Registry.destroy(entity);
 	}
 
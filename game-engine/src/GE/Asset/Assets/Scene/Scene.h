@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Entity.h"
+#include "ScenePartition.h"
+#include "SceneSpatialIndex.h"
 #include "Components/Components.h"
 
 #include "GE/Asset/Assets/Asset.h"
@@ -18,7 +20,11 @@ namespace GE
 
 	class Scene : public Asset
 	{
+		friend class Prefab;
 		friend class Project;
+		friend class SceneColumns;
+		friend class SceneInstantiation;
+		friend class ScenePartition;
 	public:
 		enum class State
 		{
@@ -126,9 +132,11 @@ namespace GE
 		{
 			GE_CORE_ASSERT(HasComponent<T>(entity), "Component doesn't exist on Entity!");
 			m_Registry.remove<T>(entity);
+			// Any removal may stop a static sprite from rendering, ex. RenderComponent
+			MarkStaticDirty();
 		}
 
-		Scene() = default;
+		Scene() { MarkStaticDirty(); }
 		Scene(UUID handle, const Config& config = Config());
 		~Scene() override;
 
@@ -138,6 +146,38 @@ namespace GE
 		Ref<Asset> GetCopy() override;
 
 		const entt::registry& GetRegistry() { return m_Registry; }
+		/*
+		* World bounds of all Entities with TransformComponent.
+		* Updated at the end of Scene::OnUpdate(Timestep)
+		*/
+		const SceneSpatialIndex& GetSpatialIndex() const { return m_SpatialIndex; }
+
+		/*
+		* Changes whenever a static sprite may need rebaking, see SpriteRendererComponent::Static.
+		* Unique across Scenes, a Layer can compare it without tracking which Scene it baked.
+		*/
+		const uint64_t& GetStaticRevision() const { return m_StaticRevision; }
+		// Forces Layers to rebake static sprites before next render
+		void MarkStaticDirty();
+		/*
+		* Returns true if entity's sprite should be baked instead of drawn every frame.
+		* Sprites moved by physics, or with an ancestor moved by physics, are never static.
+		*/
+		bool IsStatic(Entity entity);
+		/*
+		* Adds handles of all Assets referenced by Components, & Prefabs instantiated in Scene with their templates, to outHandles. Not cleared.
+		* Used to keep them resident, see AssetResidency.
+		*/
+		void GetAssetHandles(std::unordered_set<UUID>& outHandles);
+
+		/*
+		* Streams cells of root Entities in & out around primary Cameras while running.
+		* Applies on next Run from Stop, see ScenePartition
+		*/
+		void SetPartitionConfig(const ScenePartition::Config& config) { m_PartitionConfig = config; }
+		const ScenePartition::Config& GetPartitionConfig() const { return m_PartitionConfig; }
+		// nullptr unless running with a partition
+		const ScenePartition* GetPartition() const { return m_Partition.get(); }
 
 		const Config& GetConfig() const { return m_Config; }
 		const State& GetState() const { return m_Config.CurrentState; }
@@ -165,6 +205,17 @@ namespace GE
 
 		Entity CreateEntity(const std::string& name, uint32_t tagID);
 		Entity CreateEntityWithUUID(UUID uuid, const std::string& name, uint32_t tagID);
+		/*
+		* Creates count root Entities with new UUIDs & the same Components as CreateEntityWithUUID().
+		* Each Component is inserted for all Entities at once instead of per Entity.
+		* Returns created Entities
+		*
+		* @param count : number of Entities
+		* @param name : NameComponent of every Entity
+		* @param tagID : TagComponent of every Entity
+		* @param layerIDs : RenderComponent::LayerIDs of every Entity
+		*/
+		std::vector<Entity> CreateEntities(uint32_t count, const std::string& name, uint32_t tagID, const std::vector<uint64_t>& layerIDs = std::vector<uint64_t>());
 
 		/*
 		* returns duplicated Entity.
@@ -223,6 +274,13 @@ private:
 		* Meant to be called prior to Layer::OnUpdate()
 		*/
 		void ResetEntityRenderComponents();
+		/*
+		* Inserts or updates world bounds of Entities whose TransformComponent or parent changed since they were indexed, & their children.
+		* Changes are found by comparing every Entity against its IndexedTransform, so any writer is caught.
+		* Walks all Entities instead after m_SpatialIndexRebuild is set.
+		* Only Entities that moved outside of their fattened bounds restructure the index.
+		*/
+		void UpdateSpatialIndex();
 
 		void OnStart(State state, uint32_t viewportWidth = 0, uint32_t viewportHeight = 0);
 		void OnUpdate(Timestep ts);
@@ -244,6 +302,11 @@ private:
 		void OnPauseUpdate(Timestep ts);
 
 		void InitializePhysics2D();
+		/*
+		* Creates Box2D body of entity with Rigidbody2DComponent, if it has a collider
+		*/
+		void CreatePhysics2DBody(Entity entity);
+		void DestroyPhysics2DBody(Entity entity);
 		void UpdatePhysics2D(Timestep ts);
 		void DestroyPhysics2D();
 
@@ -255,12 +318,34 @@ private:
 		void UpdateAudio(Timestep ts);
 		void DestroyAudio();
 	private:
+		/*
+		* Local transform & parent an Entity was last indexed with, stored in m_Registry.
+		* Not a serialized Component, only read by UpdateSpatialIndex().
+		*/
+		struct IndexedTransform
+		{
+			glm::vec3 Translation = glm::vec3(0.0f);
+			glm::vec3 Rotation = glm::vec3(0.0f);
+			glm::vec3 Scale = glm::vec3(1.0f);
+			UUID Parent = 0;
+		};
+
 		Config m_Config;
 		entt::registry m_Registry;
+		SceneSpatialIndex m_SpatialIndex;
+		// Reindexes all Entities next UpdateSpatialIndex(), ex. after cells are restored
+		bool m_SpatialIndexRebuild = true;
+		uint64_t m_StaticRevision = 0;
 
 		// TODO: Physics wrapper
 		b2World* m_PhysicsWorld = nullptr;
 
+		// Templates of Prefabs instantiated in Scene by Prefab handle, see GetAssetHandles()
+		std::unordered_map<UUID, Ref<Scene>> m_PrefabTemplates = std::unordered_map<UUID, Ref<Scene>>();
+
+		ScenePartition::Config m_PartitionConfig = ScenePartition::Config();
+		Scope<ScenePartition> m_Partition = nullptr;
+
 	};
 
 	namespace SceneUtils
@@ -0,0 +1,83 @@
+#include "GE/GEpch.h"
+
+#include "SceneInstantiation.h"
+
+#include <chrono>
+
+namespace GE
+{
+	template<typename T>
+	static void CopyComponent(entt::registry& to, const entt::registry& from, entt::entity toEntity, entt::entity fromEntity)
+	{
+		if (const T* component = from.try_get<T>(fromEntity))
+			to.emplace_or_replace<T>(toEntity, *component);
+	}
+
+	SceneInstantiation::SceneInstantiation(Ref<Scene> source) : m_Source(source)
+	{
+		if (!m_Source)
+			return;
+
+		m_Scene = CreateRef<Scene>(m_Source->GetHandle(), m_Source->GetConfig());
+		m_Entities = m_Source->GetAllEntitiesWith<IDComponent>();
+	}
+
+	bool SceneInstantiation::Step(float budget)
+	{
+		if (IsComplete())
+			return true;
+
+		GE_PROFILE_FUNCTION();
+
+		entt::registry& from = m_Source->m_Registry;
+		entt::registry& to = m_Scene->m_Registry;
+
+		const auto start = std::chrono::steady_clock::now();
+		const auto end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float, std::milli>(budget));
+		do
+		{
+			const Entity fromEntity = m_Entities[m_Next++];
+			const UUID uuid = from.get<IDComponent>(fromEntity).ID;
+			const auto& name = from.get<NameComponent>(fromEntity).Name;
+			const uint32_t tagID = from.get<TagComponent>(fromEntity).TagID;
+			const Entity toEntity = m_Scene->CreateEntityWithUUID(uuid, name, tagID);
+
+			// Same Components as Scene::GetCopy()
+			CopyComponent<ActiveComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<RelationshipComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<TransformComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<AudioSourceComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<AudioListenerComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<RenderComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CameraComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<SpriteRendererComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CircleRendererComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<TextRendererComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<GUIComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUICanvasComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUILayoutComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIImageComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIButtonComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUIInputFieldComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUISliderComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<GUICheckboxComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<NativeScriptComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<ScriptComponent>(to, from, toEntity, fromEntity);
+
+			CopyComponent<Rigidbody2DComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<BoxCollider2DComponent>(to, from, toEntity, fromEntity);
+			CopyComponent<CircleCollider2DComponent>(to, from, toEntity, fromEntity);
+		} while (!IsComplete() && std::chrono::steady_clock::now() < end);
+
+		if (!IsComplete())
+			return false;
+
+		// Static sprites bake once, not every slice
+		m_Scene->MarkStaticDirty();
+		m_Source = nullptr;
+		return true;
+	}
+}
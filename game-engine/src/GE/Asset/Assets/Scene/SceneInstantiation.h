@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Scene.h"
+
+#include <vector>
+
+namespace GE
+{
+	/*
+	* Copies a Scene a slice of Entities at a time, so large Scenes instantiate across frames.
+	* An Entity has every copied Component once it exists, see Scene::GetCopy()
+	*/
+	class SceneInstantiation
+	{
+	public:
+		/*
+		* Gathers Entities of source, none are copied until Step()
+		*/
+		SceneInstantiation(Ref<Scene> source);
+
+		// Destination, partially filled until IsComplete()
+		Ref<Scene> GetScene() const { return m_Scene; }
+		uint64_t GetLoadedCount() const { return m_Next; }
+		uint64_t GetTotalCount() const { return m_Entities.size(); }
+		bool IsComplete() const { return m_Next == m_Entities.size(); }
+
+		/*
+		* Copies Entities until budget is spent or all are copied.
+		* Returns true once complete
+		*
+		* @param budget : milliseconds, at least one Entity is copied per call
+		*/
+		bool Step(float budget);
+
+	private:
+		Ref<Scene> m_Source = nullptr;
+		Ref<Scene> m_Scene = nullptr;
+		std::vector<Entity> m_Entities = std::vector<Entity>();
+		uint64_t m_Next = 0;
+	};
+}
@@ -0,0 +1,495 @@
+#include "GE/GEpch.h"
+
+#include "ScenePartition.h"
+#include "Scene.h"
+
+#include "GE/Asset/Pack/SceneColumns.h"
+#include "GE/Audio/AudioManager.h"
+#include "GE/Core/Application/Application.h"
+#include "GE/Scripting/Scripting.h"
+
+namespace GE
+{
+	template<typename T>
+	static void MoveComponent(entt::registry& to, entt::registry& from, entt::entity toEntity, entt::entity fromEntity)
+	{
+		if (T* component = from.try_get<T>(fromEntity))
+			to.emplace<T>(toEntity, std::move(*component));
+	}
+
+	template<typename T>
+	static uint64_t GetComponentSize(const entt::registry& registry, entt::entity entity)
+	{
+		return registry.all_of<T>(entity) ? sizeof(T) : 0;
+	}
+
+	/*
+	* Returns approximate bytes of streamable Components of entity, including heap owned strings & arrays
+	*/
+	static uint64_t GetResidentSize(const entt::registry& registry, entt::entity entity)
+	{
+		uint64_t size = sizeof(IDComponent)
+			+ GetComponentSize<TagComponent>(registry, entity)
+			+ GetComponentSize<ActiveComponent>(registry, entity)
+			+ GetComponentSize<TransformComponent>(registry, entity)
+			+ GetComponentSize<AudioSourceComponent>(registry, entity)
+			+ GetComponentSize<SpriteRendererComponent>(registry, entity)
+			+ GetComponentSize<CircleRendererComponent>(registry, entity)
+			+ GetComponentSize<Rigidbody2DComponent>(registry, entity)
+			+ GetComponentSize<BoxCollider2DComponent>(registry, entity)
+			+ GetComponentSize<CircleCollider2DComponent>(registry, entity)
+			+ GetComponentSize<ScriptComponent>(registry, entity);
+
+		if (const NameComponent* nc = registry.try_get<NameComponent>(entity))
+			size += sizeof(NameComponent) + nc->Name.capacity();
+		if (const RelationshipComponent* rsc = registry.try_get<RelationshipComponent>(entity))
+			size += sizeof(RelationshipComponent) + rsc->GetChildren().capacity() * sizeof(UUID);
+		if (const RenderComponent* rc = registry.try_get<RenderComponent>(entity))
+			size += sizeof(RenderComponent) + rc->LayerIDs.capacity() * sizeof(uint64_t);
+		return size;
+	}
+
+	ScenePartition::ScenePartition(Scene* scene, const Config& config) : m_Scene(scene), m_Config(config)
+	{
+		GE_PROFILE_FUNCTION();
+
+		m_AsyncState = CreateRef<AsyncState>();
+		m_AsyncState->Partition = this;
+		m_Config.UnloadRadius = std::max(m_Config.UnloadRadius, m_Config.LoadRadius + 1);
+		if (!m_Scene || m_Config.CellSize <= 0.0f)
+			return;
+
+		entt::registry& registry = m_Scene->m_Registry;
+		std::unordered_map<UUID, entt::entity> entityMap = std::unordered_map<UUID, entt::entity>();
+		auto idView = registry.view<IDComponent>();
+		entityMap.reserve(idView.size());
+		for (entt::entity entity : idView)
+			entityMap.emplace(idView.get<IDComponent>(entity).ID, entity);
+
+		uint32_t entityCount = 0;
+		auto view = registry.view<IDComponent, RelationshipComponent, TransformComponent>();
+		for (entt::entity entity : view)
+		{
+			// Children move with their root
+			const UUID& parent = view.get<RelationshipComponent>(entity).GetParent();
+			if (parent != view.get<IDComponent>(entity).ID && entityMap.find(parent) != entityMap.end())
+				continue;
+
+			std::vector<Entity> hierarchy = std::vector<Entity>();
+			if (!GatherHierarchy(Entity((uint32_t)entity), entityMap, hierarchy))
+				continue;
+
+			const glm::ivec2 coord = GetCoord(view.get<TransformComponent>(entity).Translation);
+			Cell& cell = m_Cells[GetKey(coord)];
+			cell.Coord = coord;
+			cell.Roots.push_back(Entity((uint32_t)entity));
+			cell.EntityCount += (uint32_t)hierarchy.size();
+			entityCount += (uint32_t)hierarchy.size();
+		}
+
+		GE_CORE_INFO("Scene Partition Created.\n\tCells : {0}\n\tEntities : {1}/{2}\n\tCell Size : {3}",
+			m_Cells.size(), entityCount, idView.size(), m_Config.CellSize);
+	}
+
+	ScenePartition::~ScenePartition()
+	{
+		m_AsyncState->Partition = nullptr;
+	}
+
+	glm::ivec2 ScenePartition::GetCoord(const glm::vec3& translation) const
+	{
+		return glm::ivec2((int)std::floor(translation.x / m_Config.CellSize), (int)std::floor(translation.y / m_Config.CellSize));
+	}
+
+	bool ScenePartition::GatherHierarchy(Entity root, const std::unordered_map<UUID, entt::entity>& entityMap, std::vector<Entity>& outEntities) const
+	{
+		const entt::registry& registry = m_Scene->m_Registry;
+
+		const size_t first = outEntities.size();
+		outEntities.push_back(root);
+		for (size_t i = first; i < outEntities.size(); i++)
+		{
+			const entt::entity entity = outEntities[i];
+
+			// No column to store these in, see SceneColumns::IsColumnar()
+			if (registry.any_of<CameraComponent, AudioListenerComponent, TextRendererComponent, NativeScriptComponent,
+				GUIComponent, GUICanvasComponent, GUILayoutComponent, GUIImageComponent, GUIButtonComponent,
+				GUIInputFieldComponent, GUISliderComponent, GUICheckboxComponent>(entity))
+			{
+				outEntities.resize(first);
+				return false;
+			}
+
+			if (const RelationshipComponent* rsc = registry.try_get<RelationshipComponent>(entity))
+			{
+				for (const UUID& childID : rsc->GetChildren())
+				{
+					auto it = entityMap.find(childID);
+					if (it != entityMap.end() && registry.valid(it->second))
+						outEntities.push_back(Entity((uint32_t)it->second));
+				}
+			}
+		}
+		return true;
+	}
+
+	void ScenePartition::Update()
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (m_Cells.empty())
+			return;
+
+		std::vector<glm::ivec2> focus = std::vector<glm::ivec2>();
+		{
+			auto view = m_Scene->m_Registry.view<CameraComponent, TransformComponent>();
+			for (entt::entity entity : view)
+			{
+				if (!view.get<CameraComponent>(entity).Primary)
+					continue;
+
+				glm::vec3 translation = view.get<TransformComponent>(entity).Translation;
+				glm::vec3 rotation = glm::vec3(0.0f);
+				m_Scene->GetTotalOffset(Entity((uint32_t)entity), translation, rotation);
+				focus.push_back(GetCoord(translation));
+			}
+		}
+		// Nothing to stream around, cells keep their state
+		if (focus.empty())
+			return;
+
+		std::vector<uint64_t> unloads = std::vector<uint64_t>();
+		std::vector<uint64_t> loads = std::vector<uint64_t>();
+		for (const auto& [key, cell] : m_Cells)
+		{
+			uint32_t distance = UINT32_MAX;
+			for (const glm::ivec2& coord : focus)
+			{
+				const glm::ivec2 delta = glm::abs(cell.Coord - coord);
+				distance = std::min(distance, (uint32_t)std::max(delta.x, delta.y));
+			}
+
+			if (cell.CurrentState == Cell::State::Loaded && distance > m_Config.UnloadRadius)
+				unloads.push_back(key);
+			else if (cell.CurrentState == Cell::State::Unloaded && distance <= m_Config.LoadRadius)
+				loads.push_back(key);
+		}
+
+		// Unload may add cells, lookups by key stay valid
+		if (!unloads.empty())
+		{
+			std::unordered_map<UUID, entt::entity> entityMap = std::unordered_map<UUID, entt::entity>();
+			auto idView = m_Scene->m_Registry.view<IDComponent>();
+			entityMap.reserve(idView.size());
+			for (entt::entity entity : idView)
+				entityMap.emplace(idView.get<IDComponent>(entity).ID, entity);
+
+			for (uint64_t key : unloads)
+				Unload(m_Cells.at(key), entityMap);
+		}
+		for (uint64_t key : loads)
+			RequestLoad(m_Cells.at(key));
+
+		Statistics stats = Statistics();
+		stats.Loads = m_Stats.Loads;
+		stats.Unloads = m_Stats.Unloads;
+		stats.FailedLoads = m_Stats.FailedLoads;
+		for (const auto& [key, cell] : m_Cells)
+		{
+			switch (cell.CurrentState)
+			{
+			case Cell::State::Loaded:
+				stats.LoadedCells++;
+				stats.ResidentEntities += cell.EntityCount;
+				break;
+			case Cell::State::Loading:
+				stats.LoadingCells++;
+				stats.SectionSize += cell.SectionSize;
+				break;
+			case Cell::State::Unloaded:
+				stats.UnloadedCells++;
+				stats.SectionSize += cell.SectionSize;
+				break;
+			}
+		}
+		m_Stats = stats;
+	}
+
+	void ScenePartition::Unload(Cell& cell, const std::unordered_map<UUID, entt::entity>& entityMap)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const auto start = std::chrono::steady_clock::now();
+		entt::registry& registry = m_Scene->m_Registry;
+
+		std::vector<Entity> entities = std::vector<Entity>();
+		// Roots may have been reparented into another gathered hierarchy
+		std::unordered_set<entt::entity> gathered = std::unordered_set<entt::entity>();
+		for (Entity root : cell.Roots)
+		{
+			// Destroyed while running
+			if (!registry.valid(root) || !registry.all_of<IDComponent, RelationshipComponent, TransformComponent>(root))
+				continue;
+
+			// Reparented while running, moves with its new parent's hierarchy instead
+			if (registry.get<RelationshipComponent>(root).GetParent() != registry.get<IDComponent>(root).ID)
+				continue;
+
+			std::vector<Entity> hierarchy = std::vector<Entity>();
+			// Gained a Component without a column, stays resident
+			if (!GatherHierarchy(root, entityMap, hierarchy))
+				continue;
+
+			const glm::ivec2 coord = GetCoord(registry.get<TransformComponent>(root).Translation);
+			if (coord != cell.Coord)
+			{
+				auto it = m_Cells.find(GetKey(coord));
+				if (it == m_Cells.end())
+				{
+					Cell& target = m_Cells[GetKey(coord)];
+					target.Coord = coord;
+					it = m_Cells.find(GetKey(coord));
+				}
+
+				// Unloaded cells can't take more Entities until they load
+				if (it->second.CurrentState == Cell::State::Loaded)
+				{
+					it->second.Roots.push_back(root);
+					it->second.EntityCount += (uint32_t)hierarchy.size();
+					continue;
+				}
+			}
+			for (Entity entity : hierarchy)
+			{
+				if (gathered.insert((entt::entity)entity).second)
+					entities.push_back(entity);
+			}
+		}
+
+		cell.Scripts.clear();
+		cell.ResidentSize = 0;
+		bool staticSprites = false;
+		for (Entity entity : entities)
+		{
+			const UUID uuid = registry.get<IDComponent>(entity).ID;
+			if (const SpriteRendererComponent* src = registry.try_get<SpriteRendererComponent>(entity))
+				staticSprites |= src->Static;
+			if (ScriptComponent* sc = registry.try_get<ScriptComponent>(entity))
+			{
+				Scripting::OnDestroyScript(m_Scene, entity);
+				cell.Scripts.push_back({ uuid, sc->AssetHandle });
+			}
+			if (AudioSourceComponent* asc = registry.try_get<AudioSourceComponent>(entity))
+			{
+				if (asc->ID)
+					AudioManager::RemoveSource(asc->ID);
+				asc->ID = 0;
+			}
+			if (registry.all_of<Rigidbody2DComponent>(entity))
+				m_Scene->DestroyPhysics2DBody(entity);
+
+			cell.ResidentSize += GetResidentSize(registry, entity);
+		}
+
+		cell.Section = nullptr;
+		if (!entities.empty())
+		{
+			SceneColumns columns = SceneColumns(*m_Scene, entities);
+			cell.Section = CreateRef<ScopedBuffer>(columns.GetSize());
+			uint8_t* destination = cell.Section->As<uint8_t>();
+			columns.Write(destination);
+		}
+
+		for (Entity entity : entities)
+		{
+			m_Scene->m_SpatialIndex.Remove(registry.get<IDComponent>(entity).ID);
+			registry.destroy(entity);
+		}
+		// Only removed static sprites are baked into Layer batches
+		if (staticSprites)
+			m_Scene->MarkStaticDirty();
+
+		cell.Roots.clear();
+		cell.Roots = std::vector<Entity>();
+		cell.CurrentState = Cell::State::Unloaded;
+		cell.EntityCount = (uint32_t)entities.size();
+		cell.SectionSize = cell.Section ? cell.Section->GetSize() : 0;
+		cell.UnloadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		cell.Unloads++;
+		m_Stats.Unloads++;
+	}
+
+	void ScenePartition::RequestLoad(Cell& cell)
+	{
+		cell.LoadStart = std::chrono::steady_clock::now();
+		if (!cell.Section)
+		{
+			cell.CurrentState = Cell::State::Loaded;
+			cell.Scripts.clear();
+			return;
+		}
+		cell.CurrentState = Cell::State::Loading;
+
+		// Created here, Scene construction isn't thread safe
+		Ref<Scene> staging = CreateRef<Scene>();
+		Ref<ScopedBuffer> section = cell.Section;
+		Ref<AsyncState> state = m_AsyncState;
+		const uint64_t generation = state->Generation;
+		const uint64_t key = GetKey(cell.Coord);
+		Application::SubmitToWorkerThread([state, generation, key, section, staging]()
+			{
+				const uint8_t* source = section->As<uint8_t>();
+				uint64_t entityCount = 0;
+				const bool read = SceneColumns::Read(staging, source, source + section->GetSize(), entityCount);
+
+				Application::SubmitToMainAppThread([state, generation, key, staging, read]()
+					{
+						ScenePartition* partition = state->Partition;
+						if (!partition || generation != state->Generation)
+							return;
+
+						auto it = partition->m_Cells.find(key);
+						if (it == partition->m_Cells.end() || it->second.CurrentState != Cell::State::Loading)
+							return;
+
+						if (!read)
+						{
+							// Section is kept, retried next time cell is in range
+							Cell& cell = it->second;
+							if (cell.FailedLoads++ == 0)
+								GE_CORE_ERROR("Could not load Scene Partition cell, retrying.\n\tCell : {0}, {1}\n\tEntities : {2}",
+									cell.Coord.x, cell.Coord.y, cell.EntityCount);
+							cell.CurrentState = Cell::State::Unloaded;
+							partition->m_Stats.FailedLoads++;
+							return;
+						}
+						partition->Instantiate(it->second, staging, true);
+					});
+			});
+	}
+
+	void ScenePartition::Instantiate(Cell& cell, Ref<Scene> staging, bool runtime)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const auto start = std::chrono::steady_clock::now();
+		entt::registry& from = staging->m_Registry;
+		entt::registry& to = m_Scene->m_Registry;
+
+		const std::unordered_map<UUID, UUID> scripts = std::unordered_map<UUID, UUID>(cell.Scripts.begin(), cell.Scripts.end());
+		std::unordered_set<UUID> uuids = std::unordered_set<UUID>();
+		std::vector<Entity> entities = std::vector<Entity>();
+
+		auto view = from.view<IDComponent>();
+		uuids.reserve(view.size());
+		entities.reserve(view.size());
+		bool staticSprites = false;
+		for (entt::entity entity : view)
+		{
+			uuids.insert(view.get<IDComponent>(entity).ID);
+			if (const SpriteRendererComponent* src = from.try_get<SpriteRendererComponent>(entity))
+				staticSprites |= src->Static;
+		}
+
+		for (entt::entity fromEntity : view)
+		{
+			const UUID uuid = view.get<IDComponent>(fromEntity).ID;
+			const entt::entity toEntity = to.create();
+			to.emplace<IDComponent>(toEntity, uuid);
+
+			MoveComponent<TagComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<NameComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<ActiveComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<RelationshipComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<TransformComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<AudioSourceComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<RenderComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<SpriteRendererComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<CircleRendererComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<Rigidbody2DComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<BoxCollider2DComponent>(to, from, toEntity, fromEntity);
+			MoveComponent<CircleCollider2DComponent>(to, from, toEntity, fromEntity);
+
+			auto scriptIt = scripts.find(uuid);
+			if (scriptIt != scripts.end())
+				to.emplace<ScriptComponent>(toEntity).AssetHandle = scriptIt->second;
+
+			const RelationshipComponent* rsc = to.try_get<RelationshipComponent>(toEntity);
+			if (!rsc || rsc->GetParent() == uuid || uuids.find(rsc->GetParent()) == uuids.end())
+				cell.Roots.push_back(Entity((uint32_t)toEntity));
+			entities.push_back(Entity((uint32_t)toEntity));
+		}
+
+		// Same order as Scene::OnRuntimeStart()
+		if (runtime)
+		{
+			for (Entity entity : entities)
+			{
+				if (to.all_of<Rigidbody2DComponent>(entity))
+					m_Scene->CreatePhysics2DBody(entity);
+			}
+			for (Entity entity : entities)
+			{
+				if (to.all_of<AudioSourceComponent, TransformComponent>(entity))
+					AudioManager::GenerateSource(to.get<AudioSourceComponent>(entity), to.get<TransformComponent>(entity).Translation, glm::vec3(0.0f));
+			}
+			for (Entity entity : entities)
+			{
+				if (to.all_of<ScriptComponent>(entity))
+					Scripting::OnCreateScript(m_Scene, entity);
+			}
+		}
+		// Only added static sprites need baking
+		if (staticSprites)
+			m_Scene->MarkStaticDirty();
+
+		const auto end = std::chrono::steady_clock::now();
+		cell.Section = nullptr;
+		cell.Scripts.clear();
+		cell.CurrentState = Cell::State::Loaded;
+		cell.EntityCount = (uint32_t)entities.size();
+		cell.FailedLoads = 0;
+		cell.InstantiateTime = std::chrono::duration<float, std::milli>(end - start).count();
+		cell.LoadTime = std::chrono::duration<float, std::milli>(end - cell.LoadStart).count();
+		cell.Loads++;
+		m_Stats.Loads++;
+	}
+
+	bool ScenePartition::Restore()
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Pending loads are decoded again here, their results are dropped
+		m_AsyncState->Generation++;
+		bool restored = true;
+		for (auto& [key, cell] : m_Cells)
+		{
+			if (cell.CurrentState == Cell::State::Loaded)
+				continue;
+
+			cell.LoadStart = std::chrono::steady_clock::now();
+			if (!cell.Section)
+			{
+				cell.CurrentState = Cell::State::Loaded;
+				continue;
+			}
+
+			Ref<Scene> staging = CreateRef<Scene>();
+			const uint8_t* source = cell.Section->As<uint8_t>();
+			uint64_t entityCount = 0;
+			if (!SceneColumns::Read(staging, source, source + cell.Section->GetSize(), entityCount))
+			{
+				// Section is kept for next Restore() or load
+				GE_CORE_ERROR("Could not restore Scene Partition cell, its Entities stay unloaded.\n\tCell : {0}, {1}\n\tEntities : {2}",
+					cell.Coord.x, cell.Coord.y, cell.EntityCount);
+				cell.CurrentState = Cell::State::Unloaded;
+				cell.FailedLoads++;
+				m_Stats.FailedLoads++;
+				restored = false;
+				continue;
+			}
+			Instantiate(cell, staging, false);
+		}
+		return restored;
+	}
+}
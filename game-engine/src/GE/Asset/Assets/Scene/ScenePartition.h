@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Entity.h"
+
+#include "GE/Core/Memory/Buffer.h"
+#include "GE/Core/UUID/UUID.h"
+
+#include <chrono>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace GE
+{
+	// Forward declaration
+	class Scene;
+
+	/*
+	* Divides a running Scene into square cells of root Entity hierarchies.
+	* Cells far from every primary Camera are unloaded into a SceneColumns section & their Entities destroyed,
+	* including Box2D bodies, audio sources & script instances. Sections are decoded on worker threads when cells come back in range.
+	*
+	* Hierarchies stay resident if any Entity has a Component without a column, except ScriptComponent. See SceneColumns::IsColumnar()
+	* Script instances are recreated from their Script fields, runtime state is not kept.
+	*/
+	class ScenePartition
+	{
+	public:
+		struct Config
+		{
+			// World units per cell side, 0 disables partitioning
+			float CellSize = 0.0f;
+			// Cells this many cells or closer to a Camera are loaded
+			uint32_t LoadRadius = 1;
+			// Loaded cells further than this are unloaded. Kept above LoadRadius so cells on the edge don't reload every frame
+			uint32_t UnloadRadius = 2;
+		};
+
+		struct Cell
+		{
+			enum class State
+			{
+				Loaded = 0,
+				Loading,	// Section decoding on a worker thread
+				Unloaded
+			};
+
+			glm::ivec2 Coord = glm::ivec2(0);
+			State CurrentState = State::Loaded;
+			// Root Entities while loaded, children follow their root
+			std::vector<Entity> Roots = std::vector<Entity>();
+			uint32_t EntityCount = 0;
+
+			// Columns of every Entity while unloaded, see SceneColumns
+			Ref<ScopedBuffer> Section = nullptr;
+			// <Entity UUID, Script AssetHandle> while unloaded
+			std::vector<std::pair<UUID, UUID>> Scripts = std::vector<std::pair<UUID, UUID>>();
+
+			// Approximate Component bytes as of last unload
+			uint64_t ResidentSize = 0;
+			// Section bytes as of last unload
+			uint64_t SectionSize = 0;
+			// Milliseconds from load request to instantiated
+			float LoadTime = 0.0f;
+			// Milliseconds of main thread instantiation, part of LoadTime
+			float InstantiateTime = 0.0f;
+			float UnloadTime = 0.0f;
+			uint32_t Loads = 0;
+			uint32_t Unloads = 0;
+			// Section decodes that failed since last load, section is kept & retried
+			uint32_t FailedLoads = 0;
+			std::chrono::steady_clock::time_point LoadStart;
+		};
+
+		struct Statistics
+		{
+			uint32_t LoadedCells = 0;
+			uint32_t UnloadedCells = 0;
+			uint32_t LoadingCells = 0;
+			uint32_t ResidentEntities = 0;
+			// Section bytes of unloaded cells
+			uint64_t SectionSize = 0;
+			uint32_t Loads = 0;
+			uint32_t Unloads = 0;
+			uint32_t FailedLoads = 0;
+		};
+
+		/*
+		* Assigns every streamable root hierarchy of scene to a cell, all cells start loaded
+		*
+		* @param scene : running Scene, must outlive this
+		*/
+		ScenePartition(Scene* scene, const Config& config);
+		/*
+		* Drops pending loads, unloaded cells are lost. See Restore()
+		*/
+		~ScenePartition();
+
+		const Config& GetConfig() const { return m_Config; }
+		const std::unordered_map<uint64_t, Cell>& GetCells() const { return m_Cells; }
+		const Statistics& GetStats() const { return m_Stats; }
+
+		/*
+		* Unloads cells out of range & requests loads of cells in range of primary Cameras.
+		* Finished loads are instantiated from Application::ExecuteMainThread()
+		*/
+		void Update();
+		/*
+		* Decodes every unloaded cell on this thread without creating runtime bodies, sources or scripts.
+		* Called once runtime is destroyed, so a stopped Scene has every Entity again.
+		* Returns false if any cell couldn't be decoded, it stays unloaded with its section.
+		*/
+		bool Restore();
+
+	private:
+		/*
+		* Shared with worker & main thread callbacks, Partition is cleared on destruction
+		*/
+		struct AsyncState
+		{
+			ScenePartition* Partition = nullptr;
+			uint64_t Generation = 0;
+		};
+
+		static uint64_t GetKey(const glm::ivec2& coord) { return ((uint64_t)(uint32_t)coord.x << 32) | (uint64_t)(uint32_t)coord.y; }
+		glm::ivec2 GetCoord(const glm::vec3& translation) const;
+
+		/*
+		* Returns false if any Entity of hierarchy can't be stored in a section
+		*
+		* @param outEntities : root first, then all descendants
+		*/
+		bool GatherHierarchy(Entity root, const std::unordered_map<UUID, entt::entity>& entityMap, std::vector<Entity>& outEntities) const;
+
+		/*
+		* Destroys runtime bodies, sources & scripts, then stores cell Entities in a section & destroys them.
+		* Roots that moved into another loaded cell join it instead, reparented roots move with their new parent
+		*/
+		void Unload(Cell& cell, const std::unordered_map<UUID, entt::entity>& entityMap);
+		void RequestLoad(Cell& cell);
+		/*
+		* Moves Entities of staging into Scene & creates their runtime bodies, sources & scripts
+		*
+		* @param runtime : false during Restore(), Scene is stopped
+		*/
+		void Instantiate(Cell& cell, Ref<Scene> staging, bool runtime);
+
+	private:
+		Scene* m_Scene = nullptr;
+		Config m_Config = Config();
+		std::unordered_map<uint64_t, Cell> m_Cells = std::unordered_map<uint64_t, Cell>();
+		Ref<AsyncState> m_AsyncState = nullptr;
+		Statistics m_Stats = Statistics();
+	};
+}
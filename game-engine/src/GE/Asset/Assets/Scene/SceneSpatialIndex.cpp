@@ -0,0 +1,521 @@
+#include "GE/GEpch.h"
+
+#include "SceneSpatialIndex.h"
+
+#include <queue>
+
+namespace GE
+{
+	static SceneSpatialIndex::Bounds Union(const SceneSpatialIndex::Bounds& a, const SceneSpatialIndex::Bounds& b)
+	{
+		return SceneSpatialIndex::Bounds(glm::min(a.first, b.first), glm::max(a.second, b.second));
+	}
+
+	static SceneSpatialIndex::Bounds Fatten(const SceneSpatialIndex::Bounds& bounds)
+	{
+		const glm::vec2 margin = glm::vec2(SceneSpatialIndex::Margin);
+		return SceneSpatialIndex::Bounds(bounds.first - margin, bounds.second + margin);
+	}
+
+	// Used as insertion cost, 2D equivalent of surface area
+	static float Perimeter(const SceneSpatialIndex::Bounds& bounds)
+	{
+		const glm::vec2 size = bounds.second - bounds.first;
+		return 2.0f * (size.x + size.y);
+	}
+
+	static bool Encloses(const SceneSpatialIndex::Bounds& outer, const SceneSpatialIndex::Bounds& inner)
+	{
+		return outer.first.x <= inner.first.x && outer.first.y <= inner.first.y
+			&& inner.second.x <= outer.second.x && inner.second.y <= outer.second.y;
+	}
+
+	static bool Overlaps(const SceneSpatialIndex::Bounds& a, const SceneSpatialIndex::Bounds& b)
+	{
+		return a.first.x <= b.second.x && a.second.x >= b.first.x
+			&& a.first.y <= b.second.y && a.second.y >= b.first.y;
+	}
+
+	static float DistanceSquared(const glm::vec2& point, const SceneSpatialIndex::Bounds& bounds)
+	{
+		const glm::vec2 delta = glm::max(glm::max(bounds.first - point, point - bounds.second), glm::vec2(0.0f));
+		return glm::dot(delta, delta);
+	}
+
+	/*
+	* Slab test. Returns true if ray enters bounds within maxDistance.
+	*
+	* @param inverseDirection : 1 / normalized ray direction
+	* @param outDistance : distance to entry point, zero if origin is inside bounds
+	*/
+	static bool RayIntersects(const SceneSpatialIndex::Bounds& bounds, const glm::vec2& origin, const glm::vec2& inverseDirection,
+		float maxDistance, float& outDistance)
+	{
+		const glm::vec2 t1 = (bounds.first - origin) * inverseDirection;
+		const glm::vec2 t2 = (bounds.second - origin) * inverseDirection;
+		const glm::vec2 tNear = glm::min(t1, t2);
+		const glm::vec2 tFar = glm::max(t1, t2);
+
+		const float entry = glm::max(glm::max(tNear.x, tNear.y), 0.0f);
+		const float exit = glm::min(tFar.x, tFar.y);
+		if (exit < entry || entry > maxDistance)
+			return false;
+
+		outDistance = entry;
+		return true;
+	}
+
+	SceneSpatialIndex::~SceneSpatialIndex()
+	{
+		Clear();
+	}
+
+	bool SceneSpatialIndex::Insert(const UUID& id, Entity entity, const Bounds& bounds)
+	{
+		if (m_Leaves.find(id) != m_Leaves.end())
+		{
+			m_Nodes[m_Leaves.at(id)].EntityID = (uint32_t)entity;
+			return Update(id, bounds);
+		}
+
+		int32_t leaf = AllocateNode();
+		Node& node = m_Nodes[leaf];
+		node.ID = id;
+		node.EntityID = (uint32_t)entity;
+		node.TightBounds = bounds;
+		node.FatBounds = Fatten(bounds);
+
+		InsertLeaf(leaf);
+		m_Leaves.emplace(id, leaf);
+		return true;
+	}
+
+	bool SceneSpatialIndex::Update(const UUID& id, const Bounds& bounds)
+	{
+		if (m_Leaves.find(id) == m_Leaves.end())
+			return false;
+
+		int32_t leaf = m_Leaves.at(id);
+		Node& node = m_Nodes[leaf];
+		node.TightBounds = bounds;
+
+		// Still inside fattened bounds & hasn't shrunk considerably, tree doesn't change
+		const Bounds fatBounds = Fatten(bounds);
+		if (Encloses(node.FatBounds, bounds) && Perimeter(node.FatBounds) <= 4.0f * Perimeter(fatBounds))
+			return false;
+
+		RemoveLeaf(leaf);
+		m_Nodes[leaf].FatBounds = fatBounds;
+		InsertLeaf(leaf);
+		return true;
+	}
+
+	bool SceneSpatialIndex::Remove(const UUID& id)
+	{
+		if (m_Leaves.find(id) == m_Leaves.end())
+			return false;
+
+		int32_t leaf = m_Leaves.at(id);
+		RemoveLeaf(leaf);
+		FreeNode(leaf);
+		m_Leaves.erase(id);
+		return true;
+	}
+
+	void SceneSpatialIndex::Clear()
+	{
+		m_Nodes.clear();
+		m_Nodes = std::vector<Node>();
+		m_Leaves.clear();
+		m_Leaves = std::unordered_map<UUID, int32_t>();
+
+		m_Root = s_NullNode;
+		m_FreeList = s_NullNode;
+	}
+
+	Entity SceneSpatialIndex::GetEntity(const UUID& id) const
+	{
+		if (m_Leaves.find(id) == m_Leaves.end())
+			return {};
+		return Entity(m_Nodes[m_Leaves.at(id)].EntityID);
+	}
+
+#pragma region Queries
+
+	void SceneSpatialIndex::QueryAABB(const Bounds& bounds, std::vector<Entity>& outEntities) const
+	{
+		GE_PROFILE_FUNCTION();
+		if (m_Root == s_NullNode)
+			return;
+
+		std::vector<int32_t> stack = std::vector<int32_t>();
+		stack.reserve(64);
+		stack.push_back(m_Root);
+		while (!stack.empty())
+		{
+			const Node& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			if (!Overlaps(node.FatBounds, bounds))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (Overlaps(node.TightBounds, bounds))
+					outEntities.push_back(Entity(node.EntityID));
+			}
+			else
+			{
+				stack.push_back(node.Left);
+				stack.push_back(node.Right);
+			}
+		}
+	}
+
+	void SceneSpatialIndex::QueryPoint(const glm::vec2& point, std::vector<Entity>& outEntities) const
+	{
+		QueryAABB(Bounds(point, point), outEntities);
+	}
+
+	bool SceneSpatialIndex::Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& outHit) const
+	{
+		GE_PROFILE_FUNCTION();
+		const float length = glm::length(direction);
+		if (m_Root == s_NullNode || length == 0.0f)
+			return false;
+
+		const glm::vec2 inverseDirection = 1.0f / (direction / length);
+
+		bool hit = false;
+		float closestDistance = maxDistance;
+
+		std::vector<int32_t> stack = std::vector<int32_t>();
+		stack.reserve(64);
+		stack.push_back(m_Root);
+		while (!stack.empty())
+		{
+			const Node& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			float distance = 0.0f;
+			if (!RayIntersects(node.FatBounds, origin, inverseDirection, closestDistance, distance))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if (RayIntersects(node.TightBounds, origin, inverseDirection, closestDistance, distance))
+				{
+					hit = true;
+					closestDistance = distance;
+					outHit.HitEntity = Entity(node.EntityID);
+					outHit.ID = node.ID;
+					outHit.Distance = distance;
+				}
+			}
+			else
+			{
+				stack.push_back(node.Left);
+				stack.push_back(node.Right);
+			}
+		}
+		return hit;
+	}
+
+	void SceneSpatialIndex::QueryNearest(const glm::vec2& point, uint32_t count, std::vector<Entity>& outEntities) const
+	{
+		GE_PROFILE_FUNCTION();
+		if (m_Root == s_NullNode || count == 0)
+			return;
+
+		// Best first search. Internal nodes are queued by fattened bounds, which contain all leaves beneath,
+		// leaves by tight bounds, so leaves are popped nearest first
+		auto nodeDistance = [&](int32_t index)
+			{
+				const Node& node = m_Nodes[index];
+				return DistanceSquared(point, node.IsLeaf() ? node.TightBounds : node.FatBounds);
+			};
+
+		using Candidate = std::pair<float, int32_t>;
+		std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+		queue.push(Candidate(nodeDistance(m_Root), m_Root));
+
+		uint32_t found = 0;
+		while (!queue.empty() && found < count)
+		{
+			const Node& node = m_Nodes[queue.top().second];
+			queue.pop();
+
+			if (node.IsLeaf())
+			{
+				outEntities.push_back(Entity(node.EntityID));
+				found++;
+			}
+			else
+			{
+				queue.push(Candidate(nodeDistance(node.Left), node.Left));
+				queue.push(Candidate(nodeDistance(node.Right), node.Right));
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region Tree
+
+	int32_t SceneSpatialIndex::AllocateNode()
+	{
+		if (m_FreeList == s_NullNode)
+		{
+			m_Nodes.push_back(Node());
+			m_Nodes.back().Height = 0;
+			return (int32_t)m_Nodes.size() - 1;
+		}
+
+		// Free nodes are linked by Parent
+		int32_t index = m_FreeList;
+		m_FreeList = m_Nodes[index].Parent;
+		m_Nodes[index] = Node();
+		m_Nodes[index].Height = 0;
+		return index;
+	}
+
+	void SceneSpatialIndex::FreeNode(int32_t index)
+	{
+		m_Nodes[index].Parent = m_FreeList;
+		m_Nodes[index].Height = -1;
+		m_FreeList = index;
+	}
+
+	void SceneSpatialIndex::InsertLeaf(int32_t leaf)
+	{
+		if (m_Root == s_NullNode)
+		{
+			m_Root = leaf;
+			m_Nodes[m_Root].Parent = s_NullNode;
+			return;
+		}
+
+		// Find cheapest sibling by perimeter heuristic
+		const Bounds leafBounds = m_Nodes[leaf].FatBounds;
+		int32_t index = m_Root;
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const Node& node = m_Nodes[index];
+
+			const float perimeter = Perimeter(node.FatBounds);
+			const float combinedPerimeter = Perimeter(Union(node.FatBounds, leafBounds));
+
+			// Cost of creating new parent for node & leaf
+			const float cost = 2.0f * combinedPerimeter;
+			// Minimum cost of pushing leaf further down
+			const float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+			auto childCost = [&](int32_t child)
+				{
+					const Node& childNode = m_Nodes[child];
+					const float newPerimeter = Perimeter(Union(childNode.FatBounds, leafBounds));
+					if (childNode.IsLeaf())
+						return newPerimeter + inheritanceCost;
+					return (newPerimeter - Perimeter(childNode.FatBounds)) + inheritanceCost;
+				};
+
+			const float leftCost = childCost(node.Left);
+			const float rightCost = childCost(node.Right);
+
+			if (cost < leftCost && cost < rightCost)
+				break;
+
+			index = leftCost < rightCost ? node.Left : node.Right;
+		}
+
+		const int32_t sibling = index;
+		const int32_t oldParent = m_Nodes[sibling].Parent;
+		// May reallocate m_Nodes, don't hold references across
+		const int32_t newParent = AllocateNode();
+
+		m_Nodes[newParent].Parent = oldParent;
+		m_Nodes[newParent].FatBounds = Union(leafBounds, m_Nodes[sibling].FatBounds);
+		m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+		m_Nodes[newParent].Left = sibling;
+		m_Nodes[newParent].Right = leaf;
+		m_Nodes[sibling].Parent = newParent;
+		m_Nodes[leaf].Parent = newParent;
+
+		if (oldParent != s_NullNode)
+		{
+			if (m_Nodes[oldParent].Left == sibling)
+				m_Nodes[oldParent].Left = newParent;
+			else
+				m_Nodes[oldParent].Right = newParent;
+		}
+		else
+			m_Root = newParent;
+
+		Refit(m_Nodes[leaf].Parent);
+	}
+
+	void SceneSpatialIndex::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = s_NullNode;
+			return;
+		}
+
+		const int32_t parent = m_Nodes[leaf].Parent;
+		const int32_t grandParent = m_Nodes[parent].Parent;
+		const int32_t sibling = m_Nodes[parent].Left == leaf ? m_Nodes[parent].Right : m_Nodes[parent].Left;
+
+		if (grandParent != s_NullNode)
+		{
+			// Replace parent with sibling
+			if (m_Nodes[grandParent].Left == parent)
+				m_Nodes[grandParent].Left = sibling;
+			else
+				m_Nodes[grandParent].Right = sibling;
+			m_Nodes[sibling].Parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].Parent = s_NullNode;
+			FreeNode(parent);
+		}
+		m_Nodes[leaf].Parent = s_NullNode;
+	}
+
+	void SceneSpatialIndex::Refit(int32_t index)
+	{
+		while (index != s_NullNode)
+		{
+			index = Balance(index);
+
+			Node& node = m_Nodes[index];
+			const Node& left = m_Nodes[node.Left];
+			const Node& right = m_Nodes[node.Right];
+
+			node.Height = 1 + glm::max(left.Height, right.Height);
+			node.FatBounds = Union(left.FatBounds, right.FatBounds);
+
+			index = node.Parent;
+		}
+	}
+
+	int32_t SceneSpatialIndex::Balance(int32_t iA)
+	{
+		Node& a = m_Nodes[iA];
+		if (a.IsLeaf() || a.Height < 2)
+			return iA;
+
+		const int32_t iB = a.Left;
+		const int32_t iC = a.Right;
+		Node& b = m_Nodes[iB];
+		Node& c = m_Nodes[iC];
+
+		const int32_t balance = c.Height - b.Height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			const int32_t iF = c.Left;
+			const int32_t iG = c.Right;
+			Node& f = m_Nodes[iF];
+			Node& g = m_Nodes[iG];
+
+			// Swap A & C
+			c.Left = iA;
+			c.Parent = a.Parent;
+			a.Parent = iC;
+
+			if (c.Parent != s_NullNode)
+			{
+				if (m_Nodes[c.Parent].Left == iA)
+					m_Nodes[c.Parent].Left = iC;
+				else
+					m_Nodes[c.Parent].Right = iC;
+			}
+			else
+				m_Root = iC;
+
+			if (f.Height > g.Height)
+			{
+				c.Right = iF;
+				a.Right = iG;
+				g.Parent = iA;
+				a.FatBounds = Union(b.FatBounds, g.FatBounds);
+				c.FatBounds = Union(a.FatBounds, f.FatBounds);
+
+				a.Height = 1 + glm::max(b.Height, g.Height);
+				c.Height = 1 + glm::max(a.Height, f.Height);
+			}
+			else
+			{
+				c.Right = iG;
+				a.Right = iF;
+				f.Parent = iA;
+				a.FatBounds = Union(b.FatBounds, f.FatBounds);
+				c.FatBounds = Union(a.FatBounds, g.FatBounds);
+
+				a.Height = 1 + glm::max(b.Height, f.Height);
+				c.Height = 1 + glm::max(a.Height, g.Height);
+			}
+			return iC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			const int32_t iD = b.Left;
+			const int32_t iE = b.Right;
+			Node& d = m_Nodes[iD];
+			Node& e = m_Nodes[iE];
+
+			// Swap A & B
+			b.Left = iA;
+			b.Parent = a.Parent;
+			a.Parent = iB;
+
+			if (b.Parent != s_NullNode)
+			{
+				if (m_Nodes[b.Parent].Left == iA)
+					m_Nodes[b.Parent].Left = iB;
+				else
+					m_Nodes[b.Parent].Right = iB;
+			}
+			else
+				m_Root = iB;
+
+			if (d.Height > e.Height)
+			{
+				b.Right = iD;
+				a.Left = iE;
+				e.Parent = iA;
+				a.FatBounds = Union(c.FatBounds, e.FatBounds);
+				b.FatBounds = Union(a.FatBounds, d.FatBounds);
+
+				a.Height = 1 + glm::max(c.Height, e.Height);
+				b.Height = 1 + glm::max(a.Height, d.Height);
+			}
+			else
+			{
+				b.Right = iE;
+				a.Left = iD;
+				d.Parent = iA;
+				a.FatBounds = Union(c.FatBounds, d.FatBounds);
+				b.FatBounds = Union(a.FatBounds, e.FatBounds);
+
+				a.Height = 1 + glm::max(c.Height, d.Height);
+				b.Height = 1 + glm::max(a.Height, e.Height);
+			}
+			return iB;
+		}
+
+		return iA;
+	}
+
+#pragma endregion
+
+}
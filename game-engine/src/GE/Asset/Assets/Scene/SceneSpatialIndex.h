@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Entity.h"
+
+#include "GE/Core/UUID/UUID.h"
+
+#include <glm/glm.hpp>
+
+namespace GE
+{
+	/*
+	* Dynamic AABB tree of Entity world bounds.
+	* Leaves are stored with fattened bounds so small movements don't restructure the tree.
+	*/
+	class SceneSpatialIndex
+	{
+	public:
+		// World min & max bounds
+		using Bounds = std::pair<glm::vec2, glm::vec2>;
+
+		struct RaycastHit
+		{
+			Entity HitEntity = {};
+			UUID ID = 0;
+			// Distance along ray to entry point of bounds
+			float Distance = 0.0f;
+		};
+
+		// Amount leaf bounds are fattened by, on every side
+		static constexpr float Margin = 0.1f;
+
+		SceneSpatialIndex() = default;
+		~SceneSpatialIndex();
+
+		inline const uint32_t GetCount() const { return (uint32_t)m_Leaves.size(); }
+		bool Contains(const UUID& id) const { return m_Leaves.find(id) != m_Leaves.end(); }
+		/*
+		* Returns entity inserted with id, otherwise empty Entity.
+		* Entity may have been destroyed since it was inserted, validate before use.
+		*/
+		Entity GetEntity(const UUID& id) const;
+
+		/*
+		* Inserts entity with bounds, or updates it if already inserted.
+		* Returns true if tree was restructured.
+		*
+		* @param id : IDComponent::ID of entity
+		* @param entity : entity to return from queries
+		* @param bounds : world min & max bounds
+		*/
+		bool Insert(const UUID& id, Entity entity, const Bounds& bounds);
+		/*
+		* Updates bounds of entity.
+		* Only reinserts if bounds moved outside of fattened leaf bounds.
+		* Returns true if tree was restructured.
+		*
+		* @param id : IDComponent::ID of entity
+		* @param bounds : world min & max bounds
+		*/
+		bool Update(const UUID& id, const Bounds& bounds);
+		bool Remove(const UUID& id);
+		void Clear();
+
+		/*
+		* Adds all entities whose bounds intersect given bounds to outEntities.
+		*
+		* @param bounds : world min & max bounds
+		* @param outEntities : entities found. Not cleared.
+		*/
+		void QueryAABB(const Bounds& bounds, std::vector<Entity>& outEntities) const;
+		/*
+		* Adds all entities whose bounds contain point to outEntities.
+		*
+		* @param point : world position
+		* @param outEntities : entities found. Not cleared.
+		*/
+		void QueryPoint(const glm::vec2& point, std::vector<Entity>& outEntities) const;
+		/*
+		* Returns true if ray hit any entity bounds. Sets outHit to closest hit.
+		*
+		* @param origin : world position ray starts at
+		* @param direction : ray direction, doesn't need to be normalized
+		* @param maxDistance : length of ray in units of normalized direction
+		* @param outHit : closest hit. Set inside method.
+		*/
+		bool Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& outHit) const;
+		/*
+		* Adds up to count entities closest to point to outEntities, nearest first.
+		* Distance is measured to entity bounds, zero when inside.
+		*
+		* @param point : world position
+		* @param count : max entities to find
+		* @param outEntities : entities found. Not cleared.
+		*/
+		void QueryNearest(const glm::vec2& point, uint32_t count, std::vector<Entity>& outEntities) const;
+
+	private:
+		static const int32_t s_NullNode = -1;
+
+		struct Node
+		{
+			// Fattened for leaves, union of children otherwise
+			Bounds FatBounds = Bounds();
+			// Exact bounds. Leaves only
+			Bounds TightBounds = Bounds();
+
+			UUID ID = 0;
+			uint32_t EntityID = entt::null;
+
+			int32_t Parent = s_NullNode;
+			int32_t Left = s_NullNode;
+			int32_t Right = s_NullNode;
+			// Leaf = 0, Free = -1
+			int32_t Height = -1;
+
+			bool IsLeaf() const { return Left == s_NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t index);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		/*
+		* Rotates subtree at index if unbalanced. Returns new subtree root.
+		*/
+		int32_t Balance(int32_t index);
+		/*
+		* Refits bounds & height from index to root, balancing along the way
+		*/
+		void Refit(int32_t index);
+	private:
+		std::vector<Node> m_Nodes = std::vector<Node>();
+		int32_t m_Root = s_NullNode;
+		int32_t m_FreeList = s_NullNode;
+
+		// IDComponent::ID to leaf node index
+		std::unordered_map<UUID, int32_t> m_Leaves = std::unordered_map<UUID, int32_t>();
+	};
+}
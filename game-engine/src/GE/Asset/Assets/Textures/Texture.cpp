@@ -4,6 +4,7 @@
 
 #include "GE/Rendering/Renderer/Renderer.h"
 
+#include "Platform/Headless/Assets/HeadlessTexture.h"
 #include "Platform/OpenGL/Assets/OpenGLTexture.h"
 
 namespace GE
@@ -13,8 +14,8 @@ namespace GE
 		switch (Renderer::InstanceAPI())
 		{
 		case Renderer::API::None:
-			GE_CORE_ASSERT(false, "No Renderer API given!");
-			return nullptr;
+			// Headless, CPU data only
+			return CreateRef<HeadlessTexture2D>(handle, textureConfig, data);
 			break;
 		case Renderer::API::OpenGL:
 			return CreateRef<OpenGLTexture2D>(handle, textureConfig, data);
@@ -23,4 +24,19 @@ namespace GE
 		GE_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
 	}
+
+	Ref<Texture2D> Texture2D::Create(UUID handle, const Config& textureConfig, ScopedBuffer&& data)
+	{
+		switch (Renderer::InstanceAPI())
+		{
+		case Renderer::API::None:
+			return CreateRef<HeadlessTexture2D>(handle, textureConfig, std::move(data));
+			break;
+		case Renderer::API::OpenGL:
+			return CreateRef<OpenGLTexture2D>(handle, textureConfig, std::move(data));
+			break;
+		}
+		GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ namespace GE
 {
 	class Texture : public Asset
 	{
+		friend class GlyphCache;
 	public:
 		enum class ImageFormat
 		{
@@ -70,6 +71,11 @@ namespace GE
 		virtual const uint32_t& GetWidth() const = 0;
 		virtual const uint32_t& GetHeight() const = 0;
 		virtual const uint32_t& GetID() const = 0;
+		/*
+		* Returns true if every texel is fully opaque.
+		* Determined from data when set, used by Renderer to skip blending & sort front-to-back.
+		*/
+		virtual bool IsOpaque() const = 0;
 
 		virtual void Bind(uint32_t slot = 0) const = 0;
 		virtual void Unbind() const = 0;
@@ -81,6 +87,10 @@ namespace GE
 	{
 	public:
 		static Ref<Texture2D> Create(UUID handle, const Config& textureConfig, Buffer data = Buffer());
+		/*
+		* Texture takes data as its CPU copy instead of copying it
+		*/
+		static Ref<Texture2D> Create(UUID handle, const Config& textureConfig, ScopedBuffer&& data);
 
 		// Asset override
 		virtual ~Texture2D() override { }
@@ -25,7 +25,7 @@ namespace GE
 		/*
 		* Compares type of Asset
 		*/
-		virtual bool operator==(AssetInfo other) const
+		virtual bool operator==(const AssetInfo& other) const
 		{
 			if (other.Type == this->Type)
 				return true;
@@ -39,17 +39,56 @@ namespace GE
 
 		}
 
-		AssetInfo(const AssetInfo& assetInfo) : Type(assetInfo.Type)
+		AssetInfo(const AssetInfo& assetInfo) : Type(assetInfo.Type), Codec(assetInfo.Codec), RawSize(assetInfo.RawSize)
 		{
-			InitializeData(assetInfo.DataBuffer.GetSize(), assetInfo.DataBuffer.As<uint8_t>());
+			if (assetInfo.DataBuffer.IsView())
+				InitializeView(assetInfo.DataBuffer.GetSize(), assetInfo.DataBuffer.As<uint8_t>());
+			else
+				InitializeData(assetInfo.DataBuffer.GetSize(), assetInfo.DataBuffer.As<uint8_t>());
 		}
 
+		// Takes DataBuffer, leaving assetInfo empty
+		AssetInfo(AssetInfo&& assetInfo) = default;
+		AssetInfo& operator=(const AssetInfo& assetInfo) = default;
+		AssetInfo& operator=(AssetInfo&& assetInfo) = default;
+
+		/*
+		* Returns copy viewing DataBuffer, which must outlive it. See InitializeView()
+		*/
+		AssetInfo GetView() const
+		{
+			AssetInfo view = AssetInfo(Type);
+			view.Codec = Codec;
+			view.RawSize = RawSize;
+			view.InitializeView(DataBuffer.GetSize(), DataBuffer.As<uint8_t>());
+			return view;
+		}
+
+		/*
+		* Allocates size & copies data.
+		* Without data it's left uninitialized, every writer fills all of it. See RuntimeAssetManager::SerializeAsset()
+		*/
 		void InitializeData(uint64_t size, const uint8_t* data = nullptr)
 		{
-			DataBuffer = Buffer(data, size);
+			DataBuffer = data ? Buffer(data, size) : Buffer();
+			if (!data)
+				DataBuffer.Allocate(size, false);
+		}
+
+		/*
+		* Points DataBuffer at data without copying.
+		* Data must outlive this AssetInfo, see AssetPack::ReleaseMapping()
+		*/
+		void InitializeView(uint64_t size, const uint8_t* data)
+		{
+			DataBuffer = Buffer::View(data, size);
 		}
 
 		uint16_t Type = 0;	// Asset Type: Scene, Texture2D, Font, AudioClip
+		// Compression::Codec of DataBuffer, None unless read from or written to a Version 4 pack
+		uint16_t Codec = 0;
+		// Uncompressed size of DataBuffer, 0 if uncompressed
+		uint64_t RawSize = 0;
 
 		Buffer DataBuffer = 0;
 	};
@@ -148,12 +187,28 @@ namespace GE
 
 			EntityInfo(const EntityInfo& entityInfo)
 			{
-				InitializeData(entityInfo.DataBuffer.GetSize(), entityInfo.DataBuffer.As<uint8_t>());
+				if (entityInfo.DataBuffer.IsView())
+					InitializeView(entityInfo.DataBuffer.GetSize(), entityInfo.DataBuffer.As<uint8_t>());
+				else
+					InitializeData(entityInfo.DataBuffer.GetSize(), entityInfo.DataBuffer.As<uint8_t>());
 			}
 
+			EntityInfo(EntityInfo&& entityInfo) = default;
+			EntityInfo& operator=(const EntityInfo& entityInfo) = default;
+			EntityInfo& operator=(EntityInfo&& entityInfo) = default;
+
+			// See AssetInfo::InitializeData()
 			void InitializeData(uint64_t size, const uint8_t* data = nullptr)
 			{
-				DataBuffer = Buffer(data, size);
+				DataBuffer = data ? Buffer(data, size) : Buffer();
+				if (!data)
+					DataBuffer.Allocate(size, false);
+			}
+
+			// See AssetInfo::InitializeView()
+			void InitializeView(uint64_t size, const uint8_t* data)
+			{
+				DataBuffer = Buffer::View(data, size);
 			}
 
 			Buffer DataBuffer = 0;
@@ -167,23 +222,29 @@ namespace GE
 		SceneInfo(const SceneInfo& sceneInfo) : AssetInfo(sceneInfo)
 		{
 			Type = 1; // See Asset::Type
+			ColumnEntityCount = sceneInfo.ColumnEntityCount;
 
+			// Copied once in place
 			for (auto& [uuid, assetInfo] : sceneInfo.Assets)
 			{
-				Assets[uuid] = AssetInfo(assetInfo);
+				Assets.emplace(uuid, assetInfo);
 			}
 			for (auto& [uuid, entityInfo] : sceneInfo.Entities)
 			{
-				Entities[uuid] = EntityInfo(entityInfo);
+				Entities.emplace(uuid, entityInfo);
 			}
 		}
 
+		SceneInfo(SceneInfo&& sceneInfo) = default;
+		SceneInfo& operator=(const SceneInfo& sceneInfo) = default;
+		SceneInfo& operator=(SceneInfo&& sceneInfo) = default;
+
 		void ClearAllData()
 		{
 			DataBuffer.Release();
 			DataBuffer = 0;
 
-			for (auto& [uuid, assetInfo] : Entities)
+			for (auto& [uuid, assetInfo] : Assets)
 			{
 				assetInfo.DataBuffer.Release();
 				assetInfo.DataBuffer = 0;
@@ -195,10 +256,26 @@ namespace GE
 				entityInfo.DataBuffer = 0;
 			}
 		}
+
+		/*
+		* Copies all data still viewing another buffer, so this SceneInfo owns it
+		*/
+		void DetachAllData()
+		{
+			DataBuffer.Detach();
+
+			for (auto& [uuid, assetInfo] : Assets)
+				assetInfo.DataBuffer.Detach();
+
+			for (auto& [uuid, entityInfo] : Entities)
+				entityInfo.DataBuffer.Detach();
+		}
 	
 	public:
 		// Set using AssetInfo::Data
 		std::map<uint64_t, AssetInfo> Assets = std::map<uint64_t, AssetInfo>(); // UUID, AssetInfo
 		std::map<uint64_t, EntityInfo> Entities = std::map<uint64_t, EntityInfo>(); // UUID, EntityInfo
+		// Version 5, Entities created from SceneColumns. Entities holding only columnar Components have no EntityInfo
+		uint64_t ColumnEntityCount = 0;
 	};
 }
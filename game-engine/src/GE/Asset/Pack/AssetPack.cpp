@@ -22,6 +22,41 @@ namespace GE
         {
             sceneInfo.ClearAllData();
         }
+        for (auto& [uuid, assetInfo] : m_File.Assets)
+        {
+            assetInfo.DataBuffer.Release();
+        }
+        m_File.Assets.clear();
+        m_File.Contents.Entries.clear();
+        m_Mapping.Close();
+    }
+
+    void AssetPack::ReleaseMapping()
+    {
+        if (!m_Mapping.IsOpen())
+            return;
+
+        for (auto& [uuid, sceneInfo] : m_File.Index.Scenes)
+        {
+            sceneInfo.DetachAllData();
+        }
+        for (auto& [uuid, assetInfo] : m_File.Assets)
+        {
+            assetInfo.DataBuffer.Detach();
+        }
+        m_Mapping.Close();
+    }
+
+    uint64_t AssetPack::GetHash(const Buffer& buffer)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const uint8_t* data = buffer.As<uint8_t>();
+        for (size_t i = 0; i < buffer.GetSize(); i++)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
     }
 
     const AssetInfo& AssetPack::GetAssetInfo(UUID handle)
@@ -32,6 +67,18 @@ namespace GE
             return m_EmptyAssetInfo;
         }
 
+        // Version 2, shared by all Scenes
+        auto sharedIt = m_File.Assets.find(handle);
+        if (sharedIt != m_File.Assets.end())
+        {
+#ifdef GE_ENABLE_ASSERTS
+            auto entryIt = m_File.Contents.Entries.find(handle);
+            if (entryIt != m_File.Contents.Entries.end())
+                GE_CORE_ASSERT(GetHash(sharedIt->second.DataBuffer) == entryIt->second.Hash, "Asset Pack payload hash mismatch.");
+#endif
+            return sharedIt->second;
+        }
+
         bool found = false;
         UUID sceneHandle = Project::GetSceneHandle();
 
@@ -128,6 +175,13 @@ namespace GE
             m_File.Index.Scenes.at(sceneHandle).Assets.at(handle).DataBuffer.Release();
 			m_File.Index.Scenes.at(sceneHandle).Assets.erase(handle);
             m_HandleIndex.erase(handle);
+
+            auto sharedIt = m_File.Assets.find(handle);
+            if (sharedIt != m_File.Assets.end())
+            {
+                sharedIt->second.DataBuffer.Release();
+                m_File.Assets.erase(sharedIt);
+            }
 		}
 		return true;
 	}
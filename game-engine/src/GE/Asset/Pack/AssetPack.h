@@ -3,6 +3,8 @@
 #include "AssetInfo.h"
 #include "../Assets/Asset.h"
 
+#include "GE/Core/FileSystem/MappedFile.h"
+
 #include <unordered_set>
 #include <filesystem>
 
@@ -23,7 +25,41 @@ namespace GE
 			struct Header
 			{
 				const char HEADER[3] = { 'G', 'A', 'P' };
-				uint32_t Version = 1;
+				// 3 : Entities packed, see RuntimeAssetManager::SerializeEntity()
+				// 4 : Entries record Codec & RawSize, see Compression
+				// 5 : Scenes store Components as columns, see SceneColumns
+				uint32_t Version = 5;
+			};
+
+			/*
+			* Version 2
+			* Location of a single Asset payload, relative to SOF(start of file)
+			* Contains
+			* - Type : Asset Type
+			* - Offset : aligned payload offset
+			* - Size : stored payload size
+			* - Hash : stored payload hash, see AssetPack::GetHash()
+			* - Codec : Version 4, Compression::Codec of stored payload
+			* - RawSize : Version 4, uncompressed payload size
+			*/
+			struct Entry
+			{
+				uint16_t Type = 0;
+				uint64_t Offset = 0;
+				uint64_t Size = 0;
+				uint64_t Hash = 0;
+				uint16_t Codec = 0;
+				uint64_t RawSize = 0;
+			};
+
+			/*
+			* Version 2
+			* Every Asset in the file, including Scenes, stored once.
+			* Scenes reference their Assets by handle.
+			*/
+			struct TableOfContents
+			{
+				std::unordered_map<uint64_t, Entry> Entries = std::unordered_map<uint64_t, Entry>(); // UUID, Entry
 			};
 
 			/*
@@ -45,13 +81,37 @@ namespace GE
 			*/
 			std::filesystem::path Path;
 			Header FileHeader;
+			// Version 1
 			IndexTable Index;
+			// Version 2
+			TableOfContents Contents;
+			/*
+			* Non-Scene Assets shared by all Scenes
+			* Version 2 fills on Deserialize, Serialize fills for writing
+			*/
+			std::unordered_map<uint64_t, AssetInfo> Assets = std::unordered_map<uint64_t, AssetInfo>(); // UUID, AssetInfo
 		};
 
+		/*
+		* Returns 64-bit FNV-1a hash of buffer, stored in File::Entry
+		*/
+		static uint64_t GetHash(const Buffer& buffer);
+
 		AssetPack(const std::filesystem::path& filePath = "assetPack.gap");
 		~AssetPack();
 
+		const std::filesystem::path& GetFilePath() const { return m_File.Path; }
+		/*
+		* Returns every Asset stored in the file by handle, including Scenes. Empty before Version 2
+		*/
+		const std::unordered_map<uint64_t, File::Entry>& GetEntries() const { return m_File.Contents.Entries; }
+
 		void ClearAllFileData();
+		/*
+		* Copies all Scene, Asset & Entity data still viewing the mapped .gap file, then unmaps it.
+		* Must be called before the file at Path is written or the mapping would be invalidated.
+		*/
+		void ReleaseMapping();
 
 		/*
 		* Returns true if given handle is found in all Handles across Scenes
@@ -59,9 +119,9 @@ namespace GE
 		bool HandleExists(UUID handle);
 
 		/*
-		* Returns AssetInfo given handle using Project Scene handle
-		* if given handle is found, set AssetInfo
-		* if not found, search all Scenes in AssetPack::File & set AssetInfo
+		* Returns AssetInfo given handle
+		* if given handle is found in shared Assets, return AssetInfo. See File::TableOfContents
+		* if not found, search Project Scene, then all Scenes in AssetPack::File
 		* else, return empty AssetInfo
 		*/
 		const AssetInfo& GetAssetInfo(UUID handle);
@@ -81,6 +141,11 @@ namespace GE
 
 	private:
 		File m_File;
+		/*
+		* Deserialized .gap file. 
+		* SceneInfo, AssetInfo & EntityInfo Buffers view into it until ReleaseMapping()
+		*/
+		MappedFile m_Mapping;
 
 		// All currently added asset & entity handles, including Scenes
 		std::unordered_set<UUID> m_HandleIndex;
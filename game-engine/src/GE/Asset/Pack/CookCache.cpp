@@ -0,0 +1,165 @@
+#include "GE/GEpch.h"
+
+#include "CookCache.h"
+
+#include "GE/Core/FileSystem/MappedFile.h"
+
+namespace GE
+{
+	static const char s_Signature[3] = { 'G', 'A', 'C' };
+	static const uint32_t s_Version = 2;
+
+	static inline uint64_t Rotate(uint64_t value, uint32_t bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	static inline uint64_t Mix(uint64_t value)
+	{
+		value ^= value >> 33;
+		value *= 0xFF51AFD7ED558CCDull;
+		value ^= value >> 33;
+		value *= 0xC4CEB9FE1A85EC53ull;
+		value ^= value >> 33;
+		return value;
+	}
+
+	uint64_t CookCache::GetContentHash(const uint8_t* data, size_t size)
+	{
+		static const uint64_t s_Prime1 = 0x9E3779B185EBCA87ull;
+		static const uint64_t s_Prime2 = 0xC2B2AE3D27D4EB4Full;
+
+		uint64_t hash = s_Prime1 ^ (size * s_Prime2);
+		size_t i = 0;
+		for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+		{
+			uint64_t word = 0;
+			memcpy(&word, data + i, sizeof(word));
+			hash ^= Rotate(word * s_Prime2, 31) * s_Prime1;
+			hash = Rotate(hash, 27) * s_Prime1 + s_Prime2;
+		}
+
+		// Remainder, zero padded
+		if (i < size)
+		{
+			uint64_t word = 0;
+			memcpy(&word, data + i, size - i);
+			hash ^= Rotate(word * s_Prime2, 31) * s_Prime1;
+		}
+		return Mix(hash);
+	}
+
+	bool CookCache::Load(const std::filesystem::path& path)
+	{
+		GE_PROFILE_FUNCTION();
+
+		m_Entries.clear();
+		MappedFile file = MappedFile();
+		if (!file.Open(path))
+			return false;
+
+		const uint8_t* source = file.GetData();
+		const uint8_t* end = source + file.GetSize();
+		if (file.GetSize() < GetAligned(sizeof(s_Signature) + sizeof(s_Version)) || memcmp(source, s_Signature, sizeof(s_Signature)) != 0)
+			return false;
+
+		uint32_t version = 0;
+		memcpy(&version, source + sizeof(s_Signature), sizeof(version));
+		if (version != s_Version)
+			return false;
+		source += GetAligned(sizeof(s_Signature) + sizeof(s_Version));
+
+		uint64_t count = 0;
+		if (!ReadAligned(source, end, count))
+			return false;
+
+		m_Entries.reserve(count);
+		for (uint64_t i = 0; i < count; i++)
+		{
+			uint64_t handle = 0, entityCount = 0;
+			Entry entry = Entry();
+			if (!ReadAligned(source, end, handle) || !ReadAligned(source, end, entry.SourceKey) || !ReadAligned(source, end, entry.RawHash)
+				|| !ReadAligned(source, end, entry.RequestedCodec) || !ReadAligned(source, end, entry.StoredHash)
+				|| !ReadAligned(source, end, entityCount) || entityCount > (uint64_t)(end - source) / (sizeof(uint64_t) * 2))
+			{
+				m_Entries.clear();
+				return false;
+			}
+
+			entry.Entities.reserve(entityCount);
+			for (uint64_t j = 0; j < entityCount; j++)
+			{
+				uint64_t entityHandle = 0, entityHash = 0;
+				ReadAligned(source, end, entityHandle);
+				ReadAligned(source, end, entityHash);
+				entry.Entities[entityHandle] = entityHash;
+			}
+			m_Entries[handle] = std::move(entry);
+		}
+		return true;
+	}
+
+	bool CookCache::Save(const std::filesystem::path& path) const
+	{
+		GE_PROFILE_FUNCTION();
+
+		const uint64_t headerSize = GetAligned(sizeof(s_Signature) + sizeof(s_Version));
+		uint64_t size = headerSize + GetAligned(sizeof(uint64_t));
+		for (const auto& [handle, entry] : m_Entries)
+			size += GetAligned(sizeof(uint64_t)) * 6 + GetAlignedOfArray<uint64_t>(entry.Entities.size() * 2);
+
+		// Zeroed, pads header
+		Buffer buffer = Buffer(size);
+		{
+			uint8_t* destination = buffer.As<uint8_t>();
+			memcpy(destination, s_Signature, sizeof(s_Signature));
+			memcpy(destination + sizeof(s_Signature), &s_Version, sizeof(s_Version));
+			destination += headerSize;
+
+			WriteAligned<uint64_t>(destination, m_Entries.size());
+			for (const auto& [handle, entry] : m_Entries)
+			{
+				WriteAligned<uint64_t>(destination, handle);
+				WriteAligned<uint64_t>(destination, entry.SourceKey);
+				WriteAligned<uint64_t>(destination, entry.RawHash);
+				WriteAligned<uint16_t>(destination, entry.RequestedCodec);
+				WriteAligned<uint64_t>(destination, entry.StoredHash);
+				WriteAligned<uint64_t>(destination, entry.Entities.size());
+				for (const auto& [entityHandle, entityHash] : entry.Entities)
+				{
+					WriteAligned<uint64_t>(destination, entityHandle);
+					WriteAligned<uint64_t>(destination, entityHash);
+				}
+			}
+		}
+
+		std::ofstream stream(path, std::ios::trunc | std::ios::binary);
+		if (stream)
+			stream.write(buffer.As<char>(), buffer.GetSize());
+		buffer.Release();
+
+		if (!stream.good())
+		{
+			GE_CORE_WARN("Could not write Cook Cache.\n\tFilePath : {0}", path.string().c_str());
+			return false;
+		}
+		return true;
+	}
+
+	const CookCache::Entry* CookCache::Find(uint64_t handle) const
+	{
+		auto it = m_Entries.find(handle);
+		return it != m_Entries.end() ? &it->second : nullptr;
+	}
+
+	void CookCache::Retain(const std::unordered_set<uint64_t>& handles)
+	{
+		for (auto it = m_Entries.begin(); it != m_Entries.end();)
+		{
+			if (handles.find(it->first) == handles.end())
+				it = m_Entries.erase(it);
+			else
+				it++;
+		}
+	}
+}
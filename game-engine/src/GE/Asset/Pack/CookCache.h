@@ -0,0 +1,91 @@
+#pragma once
+
+#include "GE/Core/Memory/Buffer.h"
+
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace GE
+{
+	/*
+	* Content hashes from the previous pack build, stored next to the .gap as .gapcache
+	* Payloads with unchanged hashes are copied from the previous pack instead of being compressed again.
+	* See RuntimeAssetManager::SerializeAssets()
+	*
+	* .gapcache file, Version 2
+	*  Version 1 : Entries without SourceKey. Not read, rebuilt
+	*	[8] header, info
+	*	[3] signature	// "GAC"
+	*	[4] Version
+	*	[1] Padding
+	*	[8] Entry Count
+	*	[48 + 16 * Count] Entry
+	*		[8] Handle
+	*		[8] SourceKey
+	*		[8] RawHash
+	*		[8] RequestedCodec
+	*		[8] StoredHash
+	*		[8] Entity Count
+	*		[16 * Count] Entity Handle & Hash
+	*/
+	class CookCache
+	{
+	public:
+		struct Entry
+		{
+			// File Asset was imported from, 0 if none. See RuntimeAssetManager::SetSourceKeys()
+			uint64_t SourceKey = 0;
+			// Uncompressed payload, see GetContentHash()
+			uint64_t RawHash = 0;
+			// Compression::Codec requested when built, stored Codec is None if compression didn't pay off
+			uint16_t RequestedCodec = 0;
+			// Stored payload, matches previous pack Entry Hash. See AssetPack::GetHash()
+			uint64_t StoredHash = 0;
+			// Scenes only, <Entity UUID, serialized Entity hash>
+			std::unordered_map<uint64_t, uint64_t> Entities = std::unordered_map<uint64_t, uint64_t>();
+		};
+
+		// Of last build, see ResetStats()
+		struct Statistics
+		{
+			uint32_t Hits = 0;
+			uint32_t Misses = 0;
+			uint32_t EntityHits = 0;
+			uint32_t EntityMisses = 0;
+			// Stored bytes copied from previous pack
+			uint64_t ReusedBytes = 0;
+		};
+
+		/*
+		* Returns fast non-cryptographic 64-bit hash of data, read 8 bytes at a time
+		*/
+		static uint64_t GetContentHash(const uint8_t* data, size_t size);
+		static uint64_t GetContentHash(const Buffer& buffer) { return GetContentHash(buffer.As<uint8_t>(), buffer.GetSize()); }
+
+		/*
+		* Replaces entries with file at path.
+		* Returns false if file is missing or invalid, cache is left empty
+		*/
+		bool Load(const std::filesystem::path& path);
+		bool Save(const std::filesystem::path& path) const;
+		void Clear() { m_Entries.clear(); }
+
+		/*
+		* Returns entry for handle or nullptr
+		*/
+		const Entry* Find(uint64_t handle) const;
+		Entry& Get(uint64_t handle) { return m_Entries[handle]; }
+		/*
+		* Drops entries of handles not in the latest build
+		*/
+		void Retain(const std::unordered_set<uint64_t>& handles);
+
+		Statistics& GetStats() { return m_Stats; }
+		void ResetStats() { m_Stats = Statistics(); }
+
+	private:
+		std::unordered_map<uint64_t, Entry> m_Entries = std::unordered_map<uint64_t, Entry>();
+		Statistics m_Stats = Statistics();
+	};
+}
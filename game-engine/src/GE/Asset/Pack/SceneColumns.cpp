@@ -0,0 +1,709 @@
+#include "GE/GEpch.h"
+
+#include "SceneColumns.h"
+
+#include "GE/Asset/RuntimeAssetManager.h"
+#include "GE/Asset/Assets/Scene/Scene.h"
+
+#include "GE/Core/Memory/Buffer.h"
+
+namespace GE
+{
+	using ComponentType = RuntimeAssetManager::ComponentType;
+
+	/*
+	* Column Records, fixed size & trivially copyable.
+	* Fields are ordered largest first, Records are value initialized so padding is zeroed.
+	*/
+	struct PoolRecord
+	{
+		uint64_t Offset = 0;	// Bytes into Pool
+		uint64_t Count = 0;		// Elements
+	};
+
+	struct RelationshipRecord
+	{
+		uint64_t Parent = 0;
+		PoolRecord Children = PoolRecord();
+	};
+
+	struct TransformRecord
+	{
+		float Translation[3] = {};
+		float Rotation[3] = {};
+		float Scale[3] = {};
+		uint32_t Pivot = 0;
+	};
+
+	struct AudioSourceRecord
+	{
+		uint64_t AssetHandle = 0;
+		float Pitch = 0.0f;
+		float Gain = 0.0f;
+		uint8_t Loop = 0;
+	};
+
+	struct SpriteRendererRecord
+	{
+		uint64_t AssetHandle = 0;
+		float Color[4] = {};
+		float TilingFactor = 0.0f;
+		uint8_t Static = 0;
+	};
+
+	struct CircleRendererRecord
+	{
+		uint64_t AssetHandle = 0;
+		float Color[4] = {};
+		float TilingFactor = 0.0f;
+		float Radius = 0.0f;
+		float Thickness = 0.0f;
+		float Fade = 0.0f;
+	};
+
+	struct Rigidbody2DRecord
+	{
+		uint16_t Type = 0;
+		uint8_t FixedRotation = 0;
+	};
+
+	struct BoxCollider2DRecord
+	{
+		float Density = 0.0f;
+		float Friction = 0.0f;
+		float Restitution = 0.0f;
+		float RestitutionThreshold = 0.0f;
+		float Offset[2] = {};
+		float Size[2] = {};
+		uint8_t Show = 0;
+	};
+
+	struct CircleCollider2DRecord
+	{
+		float Density = 0.0f;
+		float Friction = 0.0f;
+		float Restitution = 0.0f;
+		float RestitutionThreshold = 0.0f;
+		float Radius = 0.0f;
+		float Offset[2] = {};
+		uint8_t Show = 0;
+	};
+
+	template<typename T>
+	static inline PoolRecord WritePool(std::vector<uint8_t>& pool, const T* data, size_t count)
+	{
+		PoolRecord record = PoolRecord();
+		record.Offset = pool.size();
+		record.Count = count;
+		pool.resize(GetAligned(pool.size() + count * sizeof(T)), 0);
+		if (count)
+			memcpy(pool.data() + record.Offset, data, count * sizeof(T));
+		return record;
+	}
+
+	template<typename T>
+	static inline bool ReadPool(const PoolRecord& record, const uint8_t* pool, uint64_t poolSize, const T*& outData)
+	{
+		if (record.Offset > poolSize || record.Count > (poolSize - record.Offset) / sizeof(T))
+			return false;
+		outData = (const T*)(pool + record.Offset);
+		return true;
+	}
+
+	/*
+	* ComponentColumn<T> describes how Component T is stored
+	* - Type : ComponentType of column
+	* - Record : fixed size part
+	* - Encode : fills Record & appends to Pool
+	* - Decode : fills default constructed Component, false if Record is invalid
+	*/
+	template<typename T>
+	struct ComponentColumn;
+
+	template<>
+	struct ComponentColumn<TagComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Tag;
+		using Record = uint32_t;
+
+		static void Encode(const TagComponent& tc, Record& record, std::vector<uint8_t>& pool) { record = tc.TagID; }
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, TagComponent& tc) { tc.TagID = record; return true; }
+	};
+
+	template<>
+	struct ComponentColumn<NameComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Name;
+		using Record = PoolRecord;
+
+		static void Encode(const NameComponent& nc, Record& record, std::vector<uint8_t>& pool)
+		{
+			record = WritePool<char>(pool, nc.Name.data(), nc.Name.size());
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, NameComponent& nc)
+		{
+			const char* name = nullptr;
+			if (!ReadPool(record, pool, poolSize, name))
+				return false;
+			nc.Name.assign(name, record.Count);
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<ActiveComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Active;
+		// Active & Hidden
+		using Record = uint16_t;
+
+		static void Encode(const ActiveComponent& ac, Record& record, std::vector<uint8_t>& pool)
+		{
+			record = (ac.Active ? 1 : 0) | (ac.Hidden ? 2 : 0);
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, ActiveComponent& ac)
+		{
+			ac.Active = record & 1;
+			ac.Hidden = record & 2;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<RelationshipComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Relationship;
+		using Record = RelationshipRecord;
+
+		static void Encode(const RelationshipComponent& rsc, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.Parent = rsc.GetParent();
+			record.Children = WritePool<UUID>(pool, rsc.GetChildren().data(), rsc.GetChildren().size());
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, RelationshipComponent& rsc)
+		{
+			const uint64_t* children = nullptr;
+			if (!ReadPool(record.Children, pool, poolSize, children))
+				return false;
+			rsc = RelationshipComponent(record.Parent, std::vector<UUID>(children, children + record.Children.Count));
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<TransformComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Transform;
+		using Record = TransformRecord;
+
+		static void Encode(const TransformComponent& trsc, Record& record, std::vector<uint8_t>& pool)
+		{
+			memcpy(record.Translation, &trsc.Translation, sizeof(record.Translation));
+			memcpy(record.Rotation, &trsc.Rotation, sizeof(record.Rotation));
+			memcpy(record.Scale, &trsc.Scale, sizeof(record.Scale));
+			record.Pivot = (uint32_t)trsc.GetPivot();
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, TransformComponent& trsc)
+		{
+			if (record.Pivot > Pivot::BottomMiddle)
+				return false;
+			memcpy(&trsc.Translation, record.Translation, sizeof(record.Translation));
+			memcpy(&trsc.Rotation, record.Rotation, sizeof(record.Rotation));
+			memcpy(&trsc.Scale, record.Scale, sizeof(record.Scale));
+			trsc.SetPivot((Pivot)record.Pivot);
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<AudioSourceComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::AudioSource;
+		using Record = AudioSourceRecord;
+
+		static void Encode(const AudioSourceComponent& asc, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.AssetHandle = asc.AssetHandle;
+			record.Pitch = asc.Pitch;
+			record.Gain = asc.Gain;
+			record.Loop = asc.Loop;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, AudioSourceComponent& asc)
+		{
+			asc.AssetHandle = record.AssetHandle;
+			asc.Pitch = record.Pitch;
+			asc.Gain = record.Gain;
+			asc.Loop = record.Loop;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<RenderComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Render;
+		// LayerIDs
+		using Record = PoolRecord;
+
+		static void Encode(const RenderComponent& rc, Record& record, std::vector<uint8_t>& pool)
+		{
+			record = WritePool<uint64_t>(pool, rc.LayerIDs.data(), rc.LayerIDs.size());
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, RenderComponent& rc)
+		{
+			const uint64_t* ids = nullptr;
+			if (!ReadPool(record, pool, poolSize, ids))
+				return false;
+			rc.LayerIDs.assign(ids, ids + record.Count);
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<SpriteRendererComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::SpriteRenderer;
+		using Record = SpriteRendererRecord;
+
+		static void Encode(const SpriteRendererComponent& src, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.AssetHandle = src.AssetHandle;
+			memcpy(record.Color, &src.Color, sizeof(record.Color));
+			record.TilingFactor = src.TilingFactor;
+			record.Static = src.Static;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, SpriteRendererComponent& src)
+		{
+			src.AssetHandle = record.AssetHandle;
+			memcpy(&src.Color, record.Color, sizeof(record.Color));
+			src.TilingFactor = record.TilingFactor;
+			src.Static = record.Static;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<CircleRendererComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::CircleRenderer;
+		using Record = CircleRendererRecord;
+
+		static void Encode(const CircleRendererComponent& crc, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.AssetHandle = crc.AssetHandle;
+			memcpy(record.Color, &crc.Color, sizeof(record.Color));
+			record.TilingFactor = crc.TilingFactor;
+			record.Radius = crc.Radius;
+			record.Thickness = crc.Thickness;
+			record.Fade = crc.Fade;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, CircleRendererComponent& crc)
+		{
+			crc.AssetHandle = record.AssetHandle;
+			memcpy(&crc.Color, record.Color, sizeof(record.Color));
+			crc.TilingFactor = record.TilingFactor;
+			crc.Radius = record.Radius;
+			crc.Thickness = record.Thickness;
+			crc.Fade = record.Fade;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<Rigidbody2DComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::Rigidbody2D;
+		using Record = Rigidbody2DRecord;
+
+		static void Encode(const Rigidbody2DComponent& rb2D, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.Type = (uint16_t)rb2D.Type;
+			record.FixedRotation = rb2D.FixedRotation;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, Rigidbody2DComponent& rb2D)
+		{
+			if (record.Type > (uint16_t)Rigidbody2DComponent::BodyType::Kinematic)
+				return false;
+			rb2D.Type = (Rigidbody2DComponent::BodyType)record.Type;
+			rb2D.FixedRotation = record.FixedRotation;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<BoxCollider2DComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::BoxCollider2D;
+		using Record = BoxCollider2DRecord;
+
+		static void Encode(const BoxCollider2DComponent& bc2d, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.Density = bc2d.Density;
+			record.Friction = bc2d.Friction;
+			record.Restitution = bc2d.Restitution;
+			record.RestitutionThreshold = bc2d.RestitutionThreshold;
+			memcpy(record.Offset, &bc2d.Offset, sizeof(record.Offset));
+			memcpy(record.Size, &bc2d.Size, sizeof(record.Size));
+			record.Show = bc2d.Show;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, BoxCollider2DComponent& bc2d)
+		{
+			bc2d.Density = record.Density;
+			bc2d.Friction = record.Friction;
+			bc2d.Restitution = record.Restitution;
+			bc2d.RestitutionThreshold = record.RestitutionThreshold;
+			memcpy(&bc2d.Offset, record.Offset, sizeof(record.Offset));
+			memcpy(&bc2d.Size, record.Size, sizeof(record.Size));
+			bc2d.Show = record.Show;
+			return true;
+		}
+	};
+
+	template<>
+	struct ComponentColumn<CircleCollider2DComponent>
+	{
+		static constexpr ComponentType Type = ComponentType::CircleCollider2D;
+		using Record = CircleCollider2DRecord;
+
+		static void Encode(const CircleCollider2DComponent& cc2d, Record& record, std::vector<uint8_t>& pool)
+		{
+			record.Density = cc2d.Density;
+			record.Friction = cc2d.Friction;
+			record.Restitution = cc2d.Restitution;
+			record.RestitutionThreshold = cc2d.RestitutionThreshold;
+			record.Radius = cc2d.Radius;
+			memcpy(record.Offset, &cc2d.Offset, sizeof(record.Offset));
+			record.Show = cc2d.Show;
+		}
+
+		static bool Decode(const Record& record, const uint8_t* pool, uint64_t poolSize, CircleCollider2DComponent& cc2d)
+		{
+			cc2d.Density = record.Density;
+			cc2d.Friction = record.Friction;
+			cc2d.Restitution = record.Restitution;
+			cc2d.RestitutionThreshold = record.RestitutionThreshold;
+			cc2d.Radius = record.Radius;
+			memcpy(&cc2d.Offset, record.Offset, sizeof(record.Offset));
+			cc2d.Show = record.Show;
+			return true;
+		}
+	};
+
+	/*
+	* Decodes all Records & inserts them into registry in one pass
+	*/
+	template<typename T>
+	static bool InsertColumn(entt::registry& registry, const std::vector<entt::entity>& entities, const uint32_t* rows, uint64_t rowCount,
+		const uint8_t* records, const uint8_t* pool, uint64_t poolSize)
+	{
+		using Record = typename ComponentColumn<T>::Record;
+
+		std::vector<entt::entity> rowEntities = std::vector<entt::entity>();
+		std::vector<T> components = std::vector<T>(rowCount);
+		rowEntities.reserve(rowCount);
+		for (uint64_t i = 0; i < rowCount; i++)
+		{
+			Record record = Record();
+			memcpy(&record, records + i * sizeof(Record), sizeof(Record));
+			if (!ComponentColumn<T>::Decode(record, pool, poolSize, components[i]))
+				return false;
+			rowEntities.push_back(entities[rows[i]]);
+		}
+
+		registry.insert<T>(rowEntities.begin(), rowEntities.end(), std::make_move_iterator(components.begin()));
+		return true;
+	}
+
+	SceneColumns::SceneColumns(Ref<Scene> scene)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!scene)
+			return;
+
+		entt::registry& registry = scene->m_Registry;
+		std::vector<uint32_t> entities = std::vector<uint32_t>();
+		{
+			auto view = registry.view<IDComponent>();
+			entities.reserve(view.size());
+			m_UUIDs.reserve(view.size());
+			for (entt::entity entity : view)
+			{
+				entities.push_back((uint32_t)entity);
+				m_UUIDs.push_back(view.get<IDComponent>(entity).ID);
+			}
+		}
+		AddColumns(*scene, entities);
+	}
+
+	SceneColumns::SceneColumns(Scene& scene, const std::vector<Entity>& entities)
+	{
+		GE_PROFILE_FUNCTION();
+
+		std::vector<uint32_t> ids = std::vector<uint32_t>();
+		ids.reserve(entities.size());
+		m_UUIDs.reserve(entities.size());
+		for (Entity entity : entities)
+		{
+			ids.push_back((uint32_t)entity);
+			m_UUIDs.push_back(scene.m_Registry.get<IDComponent>(entity).ID);
+		}
+		AddColumns(scene, ids);
+	}
+
+	void SceneColumns::AddColumns(Scene& scene, const std::vector<uint32_t>& entities)
+	{
+		if (entities.empty())
+			return;
+
+		AddColumn<TagComponent>(scene, entities);
+		AddColumn<NameComponent>(scene, entities);
+		AddColumn<ActiveComponent>(scene, entities);
+		AddColumn<RelationshipComponent>(scene, entities);
+		AddColumn<TransformComponent>(scene, entities);
+		AddColumn<AudioSourceComponent>(scene, entities);
+		AddColumn<RenderComponent>(scene, entities);
+		AddColumn<SpriteRendererComponent>(scene, entities);
+		AddColumn<CircleRendererComponent>(scene, entities);
+		AddColumn<Rigidbody2DComponent>(scene, entities);
+		AddColumn<BoxCollider2DComponent>(scene, entities);
+		AddColumn<CircleCollider2DComponent>(scene, entities);
+	}
+
+	bool SceneColumns::IsColumnar(uint16_t componentType)
+	{
+		switch ((ComponentType)componentType)
+		{
+		case ComponentType::Tag:
+		case ComponentType::Name:
+		case ComponentType::Active:
+		case ComponentType::Relationship:
+		case ComponentType::Transform:
+		case ComponentType::AudioSource:
+		case ComponentType::Render:
+		case ComponentType::SpriteRenderer:
+		case ComponentType::CircleRenderer:
+		case ComponentType::Rigidbody2D:
+		case ComponentType::BoxCollider2D:
+		case ComponentType::CircleCollider2D:
+			return true;
+		default:
+			break;
+		}
+		return false;
+	}
+
+	template<typename T>
+	void SceneColumns::AddColumn(Scene& scene, const std::vector<uint32_t>& entities)
+	{
+		using Record = typename ComponentColumn<T>::Record;
+
+		auto view = scene.m_Registry.view<T>();
+		if (view.empty())
+			return;
+
+		Column column = Column();
+		column.Type = (uint16_t)ComponentColumn<T>::Type;
+		column.Rows.reserve(view.size());
+		column.Records.reserve(view.size() * sizeof(Record));
+		for (uint32_t i = 0; i < entities.size(); i++)
+		{
+			const entt::entity entity = (entt::entity)entities[i];
+			if (!view.contains(entity))
+				continue;
+
+			Record record = Record();
+			ComponentColumn<T>::Encode(view.template get<T>(entity), record, column.Pool);
+
+			column.Rows.push_back(i);
+			const size_t offset = column.Records.size();
+			column.Records.resize(offset + sizeof(Record));
+			memcpy(column.Records.data() + offset, &record, sizeof(Record));
+		}
+
+		if (!column.Rows.empty())
+			m_Columns.push_back(std::move(column));
+	}
+
+	uint64_t SceneColumns::GetSize() const
+	{
+		uint64_t size = GetAlignedOfArray<uint64_t>(m_UUIDs.size());
+		if (m_UUIDs.empty())
+			return size;
+
+		size += GetAligned(sizeof(uint64_t)); // Column Count
+		for (const Column& column : m_Columns)
+		{
+			size += GetAligned(sizeof(uint64_t))
+				+ GetAlignedOfArray<uint32_t>(column.Rows.size())
+				+ GetAlignedOfArray<uint8_t>(column.Records.size())
+				+ GetAlignedOfArray<uint8_t>(column.Pool.size());
+		}
+		return size;
+	}
+
+	void SceneColumns::Write(uint8_t*& destination) const
+	{
+		GE_PROFILE_FUNCTION();
+
+		const uint64_t* uuids = m_UUIDs.data();
+		WriteAlignedArray<uint64_t>(destination, uuids, m_UUIDs.size());
+		if (m_UUIDs.empty())
+			return;
+
+		WriteAligned<uint64_t>(destination, m_Columns.size());
+		for (const Column& column : m_Columns)
+		{
+			WriteAligned<uint16_t>(destination, column.Type);
+
+			const uint32_t* rows = column.Rows.data();
+			WriteAlignedArray<uint32_t>(destination, rows, column.Rows.size());
+			const uint8_t* records = column.Records.data();
+			WriteAlignedArray<uint8_t>(destination, records, column.Records.size());
+			const uint8_t* pool = column.Pool.data();
+			WriteAlignedArray<uint8_t>(destination, pool, column.Pool.size());
+		}
+	}
+
+	/*
+	* Returns view of an aligned array written by WriteAlignedArray(), count is in elements
+	*/
+	template<typename T>
+	static inline bool ReadColumnArray(const uint8_t*& source, const uint8_t* end, const T*& outData, uint64_t& outCount)
+	{
+		if (!ReadAligned(source, end, outCount) || outCount > (uint64_t)(end - source) / sizeof(T))
+			return false;
+
+		outData = (const T*)source;
+		source += GetAligned(outCount * sizeof(T));
+		return source <= end;
+	}
+
+	bool SceneColumns::Read(Ref<Scene> scene, const uint8_t*& source, const uint8_t* end, uint64_t& outEntityCount)
+	{
+		GE_PROFILE_FUNCTION();
+
+		outEntityCount = 0;
+		const uint64_t* uuids = nullptr;
+		uint64_t entityCount = 0;
+		if (!ReadColumnArray(source, end, uuids, entityCount))
+			return false;
+		if (!entityCount)
+			return true;
+		if (entityCount > UINT32_MAX)
+			return false;
+
+		entt::registry& registry = scene->m_Registry;
+		std::vector<entt::entity> entities = std::vector<entt::entity>(entityCount);
+		registry.create(entities.begin(), entities.end());
+		{
+			std::vector<IDComponent> ids = std::vector<IDComponent>();
+			ids.reserve(entityCount);
+			for (uint64_t i = 0; i < entityCount; i++)
+				ids.emplace_back(uuids[i]);
+			registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin());
+		}
+		outEntityCount = entityCount;
+
+		uint64_t columnCount = 0;
+		if (!ReadAligned(source, end, columnCount))
+			return false;
+
+		uint32_t readTypes = 0;
+		bool markStatic = false;
+		for (uint64_t i = 0; i < columnCount; i++)
+		{
+			uint16_t type = 0;
+			const uint32_t* rows = nullptr;
+			const uint8_t* records = nullptr;
+			const uint8_t* pool = nullptr;
+			uint64_t rowCount = 0, recordSize = 0, poolSize = 0;
+			if (!ReadAligned(source, end, type) || !ReadColumnArray(source, end, rows, rowCount)
+				|| !ReadColumnArray(source, end, records, recordSize) || !ReadColumnArray(source, end, pool, poolSize))
+				return false;
+
+			// Each type once, rows ascending & in range
+			if (!IsColumnar(type) || (readTypes & (1u << type)))
+				return false;
+			readTypes |= 1u << type;
+			for (uint64_t row = 0; row < rowCount; row++)
+			{
+				if (rows[row] >= entityCount || (row && rows[row] <= rows[row - 1]))
+					return false;
+			}
+
+			bool inserted = false;
+			auto insert = [&](auto* component) -> bool
+				{
+					using T = std::remove_pointer_t<decltype(component)>;
+					if (recordSize != rowCount * sizeof(typename ComponentColumn<T>::Record))
+						return false;
+					return InsertColumn<T>(registry, entities, rows, rowCount, records, pool, poolSize);
+				};
+
+			switch ((ComponentType)type)
+			{
+			case ComponentType::Tag:
+				inserted = insert((TagComponent*)nullptr);
+				break;
+			case ComponentType::Name:
+				inserted = insert((NameComponent*)nullptr);
+				break;
+			case ComponentType::Active:
+				inserted = insert((ActiveComponent*)nullptr);
+				break;
+			case ComponentType::Relationship:
+				inserted = insert((RelationshipComponent*)nullptr);
+				break;
+			case ComponentType::Transform:
+				inserted = insert((TransformComponent*)nullptr);
+				break;
+			case ComponentType::AudioSource:
+				inserted = insert((AudioSourceComponent*)nullptr);
+				break;
+			case ComponentType::Render:
+				inserted = insert((RenderComponent*)nullptr);
+				break;
+			case ComponentType::SpriteRenderer:
+				inserted = insert((SpriteRendererComponent*)nullptr);
+				markStatic = inserted;
+				break;
+			case ComponentType::CircleRenderer:
+				inserted = insert((CircleRendererComponent*)nullptr);
+				break;
+			case ComponentType::Rigidbody2D:
+				inserted = insert((Rigidbody2DComponent*)nullptr);
+				break;
+			case ComponentType::BoxCollider2D:
+				inserted = insert((BoxCollider2DComponent*)nullptr);
+				break;
+			case ComponentType::CircleCollider2D:
+				inserted = insert((CircleCollider2DComponent*)nullptr);
+				break;
+			default:
+				break;
+			}
+
+			if (!inserted)
+			{
+				GE_CORE_ERROR("Could not read Scene Columns. Invalid column : {0}", type);
+				return false;
+			}
+		}
+
+		// Components were inserted without Scene::OnEntityComponentAdded()
+		if (markStatic)
+			scene->MarkStaticDirty();
+		return true;
+	}
+}
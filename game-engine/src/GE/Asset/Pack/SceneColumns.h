@@ -0,0 +1,74 @@
+#pragma once
+
+#include "GE/Core/Core.h"
+
+#include <vector>
+
+namespace GE
+{
+	// Forward declaration
+	class Entity;
+	class Scene;
+
+	/*
+	* Version 5 Scene section storing each Component type as one contiguous array across all Entities.
+	* Loaded with one create & one insert per Component type instead of a switch per Component per Entity.
+	* Components without a column are still stored per Entity, see RuntimeAssetManager::SerializeEntity()
+	*
+	* Columns, aligned
+	*	[8 + 8 * Count] Entity UUIDs	// Row index of every column. Count 0 : Scene has no columns
+	*	[8] Column Count
+	*	[? * Count] Column
+	*		[8] ComponentType			// See RuntimeAssetManager::ComponentType
+	*		[8 + 4 * Rows] Rows			// Ascending Entity indices of Entities with Component
+	*		[8 + ? * Rows] Records		// One fixed size Record per Row, see SceneColumns.cpp
+	*		[8 + ?] Pool				// Strings & arrays, Records store offset & count
+	*/
+	class SceneColumns
+	{
+	public:
+		/*
+		* Gathers columns of every Entity with an IDComponent, empty if scene is nullptr
+		*/
+		SceneColumns(Ref<Scene> scene);
+		/*
+		* Gathers columns of entities only, in order. Every entity must have an IDComponent
+		*/
+		SceneColumns(Scene& scene, const std::vector<Entity>& entities);
+
+		/*
+		* Returns true if type is stored in a column instead of per Entity
+		*/
+		static bool IsColumnar(uint16_t componentType);
+
+		uint64_t GetEntityCount() const { return m_UUIDs.size(); }
+		uint64_t GetSize() const;
+		void Write(uint8_t*& destination) const;
+
+		/*
+		* Creates every Entity & inserts all columns into scene
+		* Returns false if the section is malformed, scene may be left partially filled
+		*
+		* @param source : read pointer, left after section
+		* @param outEntityCount : Entities created, 0 if Scene is stored per Entity
+		*/
+		static bool Read(Ref<Scene> scene, const uint8_t*& source, const uint8_t* end, uint64_t& outEntityCount);
+
+	private:
+		struct Column
+		{
+			uint16_t Type = 0;
+			std::vector<uint32_t> Rows = std::vector<uint32_t>();
+			std::vector<uint8_t> Records = std::vector<uint8_t>();
+			std::vector<uint8_t> Pool = std::vector<uint8_t>();
+		};
+
+		void AddColumns(Scene& scene, const std::vector<uint32_t>& entities);
+		template<typename T>
+		void AddColumn(Scene& scene, const std::vector<uint32_t>& entities);
+
+	private:
+		std::vector<uint64_t> m_UUIDs = std::vector<uint64_t>();
+		std::vector<Column> m_Columns = std::vector<Column>();
+	};
+}
@@ -17,7 +17,8 @@ namespace GE
 			{ ".jpg",	Asset::Type::Texture2D		},
 			{ ".ttf",	Asset::Type::Font			},
 			{ ".wav",	Asset::Type::Audio			},
-			{ ".cs",	Asset::Type::Script			}
+			{ ".cs",	Asset::Type::Script			},
+			{ ".prefab",	Asset::Type::Prefab			}
 			// { ".mp3",	Asset::Type::Audio			},
 			// { ".ogg",	Asset::Type::Audio			},
 
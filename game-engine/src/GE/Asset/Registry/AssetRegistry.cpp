@@ -10,6 +10,14 @@ namespace GE
 		m_AssetRegistry = std::map<UUID, AssetMetadata>();
 	}
 
+	void AssetRegistry::Clear()
+	{
+		m_AssetRegistry.clear();
+		m_AssetRegistry = std::map<UUID, AssetMetadata>();
+		m_HandleIndex.clear();
+		m_PathIndex.clear();
+	}
+
 	void AssetRegistry::SetFilePath(const std::filesystem::path& filePath)
 	{
 		if (!filePath.empty() && filePath != m_FilePath)
@@ -18,12 +26,18 @@ namespace GE
 
 	const AssetMetadata& AssetRegistry::GetAssetMetadata(UUID handle)
 	{
-		return m_AssetRegistry.find(handle)->second;
+		return *m_HandleIndex.find(handle)->second;
 	}
 
 	bool AssetRegistry::AssetExists(UUID handle)
 	{
-		return m_AssetRegistry.find(handle) != m_AssetRegistry.end();
+		return m_HandleIndex.find(handle) != m_HandleIndex.end();
+	}
+
+	UUID AssetRegistry::GetHandle(const std::filesystem::path& filePath) const
+	{
+		auto it = m_PathIndex.find(GetPathKey(filePath));
+		return it != m_PathIndex.end() ? it->second.Handle : UUID(0);
 	}
 
 	bool AssetRegistry::AddAsset(const AssetMetadata& metadata)
@@ -39,17 +53,45 @@ namespace GE
 			GE_CORE_WARN("Asset already exists in Registry.");
 			return false;
 		}
-		m_AssetRegistry.emplace(metadata.Handle, metadata);
+		auto [it, inserted] = m_AssetRegistry.emplace(metadata.Handle, metadata);
+		m_HandleIndex.emplace(metadata.Handle, &it->second);
+		PathEntry& pathEntry = m_PathIndex[GetPathKey(metadata.FilePath)];
+		if (!pathEntry.Count++)
+			pathEntry.Handle = metadata.Handle;
 		return true;
 	}
 
 	bool AssetRegistry::RemoveAsset(UUID handle)
 	{
-		if (!AssetExists(handle))
+		auto indexIt = m_HandleIndex.find(handle);
+		if (indexIt == m_HandleIndex.end())
 			return false;
 
+		const std::string pathKey = GetPathKey(indexIt->second->FilePath);
+		m_HandleIndex.erase(indexIt);
 		m_AssetRegistry.erase(handle);
+
+		auto pathIt = m_PathIndex.find(pathKey);
+		if (pathIt != m_PathIndex.end() && !--pathIt->second.Count)
+			m_PathIndex.erase(pathIt);
+		else if (pathIt != m_PathIndex.end() && pathIt->second.Handle == handle)
+		{
+			// Another Asset sharing the path takes its place
+			for (const auto& [otherHandle, metadata] : m_AssetRegistry)
+			{
+				if (GetPathKey(metadata.FilePath) == pathKey)
+				{
+					pathIt->second.Handle = otherHandle;
+					break;
+				}
+			}
+		}
 		return true;
 	}
 
+	std::string AssetRegistry::GetPathKey(const std::filesystem::path& filePath)
+	{
+		return filePath.lexically_normal().generic_string();
+	}
+
 }
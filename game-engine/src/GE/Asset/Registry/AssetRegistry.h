@@ -2,28 +2,53 @@
 
 #include "AssetMetadata.h"
 
+#include <unordered_map>
+
 namespace GE
 {
+	/*
+	* Ordered by handle for serialization. Handles & normalized paths are indexed, see GetPathKey()
+	* Both indices are kept in sync by AddAsset(), RemoveAsset() & Clear()
+	*/
 	class AssetRegistry
 	{
 		friend class AssetManager;
 	public:
 		AssetRegistry(const std::filesystem::path& filePath = "assetRegistry.gar");
 		
-		inline void Clear() { m_AssetRegistry.clear(); m_AssetRegistry = std::map<UUID, AssetMetadata>(); }
+		void Clear();
 		inline const std::map<UUID, AssetMetadata>& GetRegistry() { return m_AssetRegistry; }
 		inline const std::filesystem::path& GetFilePath() { return m_FilePath; }
 		void SetFilePath(const std::filesystem::path& filePath);
 
 		const AssetMetadata& GetAssetMetadata(UUID handle);
 		bool AssetExists(UUID handle);
+		/*
+		* Returns handle of Asset at filePath, 0 if not registered
+		* If several Assets share a path, the first added is returned
+		*/
+		UUID GetHandle(const std::filesystem::path& filePath) const;
 
 		bool AddAsset(const AssetMetadata& metadata);
 		bool RemoveAsset(UUID handle);
 
+		/*
+		* Returns lexically normal path with '/' separators, so equivalent spellings of a path match
+		*/
+		static std::string GetPathKey(const std::filesystem::path& filePath);
+
 	private:
 		std::filesystem::path m_FilePath;
 		std::map<UUID, AssetMetadata> m_AssetRegistry;
+		// Metadata of m_AssetRegistry, nodes aren't moved by inserts or erases
+		std::unordered_map<UUID, const AssetMetadata*> m_HandleIndex = std::unordered_map<UUID, const AssetMetadata*>();
+		struct PathEntry
+		{
+			UUID Handle = 0;
+			// Assets registered with this path, rarely more than one
+			uint32_t Count = 0;
+		};
+		// <GetPathKey(), PathEntry>
+		std::unordered_map<std::string, PathEntry> m_PathIndex = std::unordered_map<std::string, PathEntry>();
 	};
 }
-
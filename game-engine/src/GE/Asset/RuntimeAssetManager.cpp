@@ -4,10 +4,14 @@
 
 #include "GE/Asset/Assets/Audio/Audio.h"
 #include "GE/Asset/Assets/Font/Font.h"
+#include "GE/Asset/Assets/Prefab/Prefab.h"
 #include "GE/Asset/Assets/Scene/Components/Components.h"
 #include "GE/Asset/Assets/Scene/Scene.h"
+#include "GE/Asset/Pack/SceneColumns.h"
 
+#include "GE/Core/Application/Application.h"
 #include "GE/Core/Memory/Buffer.h"
+#include "GE/Core/Memory/ProcessMemory.h"
 
 #include "GE/Project/Project.h"
 
@@ -15,92 +19,96 @@
 
 namespace GE
 {
-
-#pragma region Font
-	template<typename T, typename S, int N, msdf_atlas::GeneratorFunction<S, N> func>
-	static Ref<Texture2D> LoadFontAtlas(Buffer data, const uint32_t& width, const uint32_t& height, Font::AtlasConfig& atlasConfig, Ref<Font::MSDFData> msdfData)
+	/*
+	* Reads one byte per page so a mapped buffer is paged in by the calling thread
+	*/
+	static void TouchPages(const Buffer& buffer)
 	{
-		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
-		if (!ft)
-		{
-			GE_CORE_ERROR("Failed to load Font Freetype Handle");
-			return 0;
-		}
+		static const size_t pageSize = 4096;
+		const volatile uint8_t* data = buffer.As<uint8_t>();
+		uint8_t sum = 0;
+		for (size_t i = 0; i < buffer.GetSize(); i += pageSize)
+			sum += data[i];
+		(void)sum;
+	}
 
-		msdfgen::FontHandle* font = msdfgen::loadFontData(ft, data.As<uint8_t>(), (int)data.GetSize());
-		if (!font)
-		{
-			GE_CORE_ERROR("Failed to load Font Atlas.");
-			return 0;
-		}
+	/*
+	* Reads .gap signature & Version, source is left after them
+	*/
+	static bool ReadPackHeader(const uint8_t*& source, const uint8_t* end, uint32_t& version)
+	{
+		const AssetPack::File::Header fileHeader = AssetPack::File::Header();
+		char header[sizeof(fileHeader.HEADER)] = {};
+		if (!ReadPacked(source, end, header) || memcmp(header, fileHeader.HEADER, sizeof(header)) != 0)
+			return false;
+		return ReadPacked(source, end, version);
+	}
 
-		struct CharsetRange
-		{
-			uint32_t Begin, End;
-		};
+	/*
+	* Reads Version 2 - 5 Table of Contents from a whole .gap, every Entry must fit before end
+	*/
+	static bool ReadTableOfContents(const uint8_t* base, const uint8_t* end, uint32_t version, AssetPack::File::TableOfContents& contents)
+	{
+		const uint8_t* source = base + GetAligned(sizeof(AssetPack::File::Header::HEADER) + sizeof(AssetPack::File::Header::Version));
 
-		static const CharsetRange charsetRanges[] =
-		{
-			{ 0x0020, 0x00FF } // Basic Latin + Latin Supplement
-		};
+		uint64_t count = 0;
+		if (!ReadAligned(source, end, count))
+			return false;
 
-		msdf_atlas::Charset charset;
-		for (CharsetRange range : charsetRanges)
+		contents.Entries.clear();
+		contents.Entries.reserve(count);
+		for (uint64_t i = 0; i < count; i++)
 		{
-			for (uint32_t c = range.Begin; c <= range.End; c++)
-				charset.add(c);
-		}
-
-		msdfData->FontGeometry = msdf_atlas::FontGeometry(&msdfData->Glyphs);
-		int loadedGlyph = msdfData->FontGeometry.loadCharset(font, 1.0, charset);
-
-		destroyFont(font);
-		deinitializeFreetype(ft);
-
-#define DEFAULT_ANGLE_THRESHOLD 3.0
-#define LCG_MULTIPLIER 6364136223846793005ull
-#define LCG_INCREMENT 1442695040888963407ull
+			uint64_t handle = 0;
+			AssetPack::File::Entry entry = AssetPack::File::Entry();
+			if (!ReadAligned(source, end, handle) || !ReadAligned(source, end, entry.Type)
+				|| !ReadAligned(source, end, entry.Offset) || !ReadAligned(source, end, entry.Size)
+				|| !ReadAligned(source, end, entry.Hash))
+				return false;
+			if (version >= 4 && (!ReadAligned(source, end, entry.Codec) || !ReadAligned(source, end, entry.RawSize)))
+				return false;
 
-		if (atlasConfig.ExpensiveColoring)
-		{
-			msdf_atlas::Workload([&glyphs = msdfData->Glyphs, &seed = atlasConfig.Seed](int i, int threadNum) -> bool
-				{
-					unsigned long long glyphSeed = (LCG_MULTIPLIER * (seed ^ i) + LCG_INCREMENT) * !!seed;
-					glyphs[i].edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD, glyphSeed);
-					return true;
-				}, (int)msdfData->Glyphs.size()).finish(atlasConfig.ThreadCount);
-		}
-		else
-		{
-			unsigned long long glyphSeed = atlasConfig.Seed;
-			for (msdf_atlas::GlyphGeometry& glyph : msdfData->Glyphs)
+			if (entry.Offset + entry.Size > (uint64_t)(end - base))
 			{
-				glyphSeed *= LCG_MULTIPLIER;
-				glyph.edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD, glyphSeed);
+				GE_CORE_ERROR("Could not read Asset Pack. Entry exceeds end of file.");
+				return false;
 			}
+			contents.Entries[handle] = entry;
 		}
+		return true;
+	}
 
-		Texture::Config config = Texture::Config(width, height, 0, false);
-		config.InternalFormat = Texture::ImageFormat::RGB8;
-		config.Format = Texture::DataFormat::RGB;
-
-		Buffer dataBuffer(data.As<void>(),
-			config.Height * config.Width * (config.InternalFormat == Texture::ImageFormat::RGB8 ? 3 : 4));
-		Ref<Texture2D> texture = Texture2D::Create(0, config, dataBuffer);
-		dataBuffer.Release();
+	void RuntimeAssetManager::LoadHistogram::Add(float milliseconds)
+	{
+		uint32_t bucket = 0;
+		while (bucket < BucketCount - 1 && milliseconds >= (float)(1u << bucket))
+			bucket++;
 
-		return texture;
+		Buckets[bucket]++;
+		Count++;
+		MaxMilliseconds = std::max(MaxMilliseconds, milliseconds);
 	}
 
-#pragma endregion
-
 	RuntimeAssetManager::RuntimeAssetManager(const AssetMap& assetMap /*= AssetMap()*/) : m_LoadedAssets(assetMap)
 	{
 		m_AssetPack = CreateRef<AssetPack>();
+		m_AsyncState = CreateRef<AsyncState>();
+		m_AsyncState->Manager = this;
 	}
 
 	RuntimeAssetManager::~RuntimeAssetManager()
 	{
+		CancelAsyncLoads();
+		m_AsyncState->Manager = nullptr;
+
+		for (const auto& [type, histogram] : m_LoadHistograms)
+		{
+			std::stringstream buckets;
+			for (uint32_t i = 0; i < LoadHistogram::BucketCount; i++)
+				buckets << (i < LoadHistogram::BucketCount - 1 ? "<" : ">=") << (1u << std::min(i, LoadHistogram::BucketCount - 2)) << "ms : " << histogram.Buckets[i] << " ";
+			GE_CORE_INFO("{0} Async Loads : {1}, Max : {2}ms\n\t{3}", AssetUtils::AssetTypeToString(type), histogram.Count, histogram.MaxMilliseconds, buckets.str());
+		}
+
 		InvalidateAssets();
 		m_LoadedAssets.clear();
 		m_AssetPack->ClearAllFileData();
@@ -123,21 +131,121 @@ namespace GE
 			return asset;
 		}
 
+		m_Residency.Touch(handle);
 		if (AssetLoaded(handle))
 		{
 			asset = m_LoadedAssets.at(handle);
 		}
 		else
 		{
+			// Version 2 finds handle in O(1), see AssetPack::File::TableOfContents
 			const AssetInfo& assetInfo = m_AssetPack->GetAssetInfo(handle);
 			asset = DeserializeAsset(assetInfo);
 			if (asset)
-				m_LoadedAssets.at(handle) = asset;
+				m_LoadedAssets[handle] = asset;
 		}
 
 		return asset;
 	}
 
+	Ref<Asset> RuntimeAssetManager::GetAssetAsync(UUID handle)
+	{
+		m_Residency.Touch(handle);
+		if (AssetLoaded(handle))
+			return m_LoadedAssets.at(handle);
+
+		auto pendingIt = m_PendingLoads.find(handle);
+		if (pendingIt != m_PendingLoads.end())
+			return pendingIt->second.Placeholder;
+
+		if (!HandleExists(handle))
+		{
+			GE_CORE_ERROR("Runtime Asset Handle does not exist.");
+			return nullptr;
+		}
+
+		// Views Pack data, never copies it. See CancelAsyncLoads()
+		const AssetInfo assetInfo = m_AssetPack->GetAssetInfo(handle).GetView();
+		if (!assetInfo.DataBuffer)
+			return nullptr;
+
+		PendingLoad& pendingLoad = m_PendingLoads[handle];
+		pendingLoad.Placeholder = CreateRef<Asset>(handle, (Asset::Type)assetInfo.Type, Asset::Status::Loading);
+		pendingLoad.Start = std::chrono::steady_clock::now();
+
+		Ref<AsyncState> state = m_AsyncState;
+		const uint64_t generation = state->Generation;
+		state->Decoding++;
+		Application::SubmitToWorkerThread([this, state, generation, handle, assetInfo]()
+			{
+				// Manager waits for Decoding in CancelAsyncLoads(), this is valid here
+				std::function<Ref<Asset>()> create = DecodeAsset(assetInfo);
+
+				Application::SubmitToMainAppThread([state, generation, handle, create]()
+					{
+						RuntimeAssetManager* manager = state->Manager;
+						if (!manager || generation != state->Generation)
+							return;
+
+						auto pendingIt = manager->m_PendingLoads.find(handle);
+						if (pendingIt == manager->m_PendingLoads.end())
+							return;
+						PendingLoad pendingLoad = pendingIt->second;
+						manager->m_PendingLoads.erase(pendingIt);
+
+						Ref<Asset> asset = create ? create() : nullptr;
+						if (!asset)
+						{
+							pendingLoad.Placeholder->p_Status = Asset::Status::Invalid;
+							return;
+						}
+
+						asset->p_Status = Asset::Status::Ready;
+						// GetAsset() may have loaded it synchronously meanwhile
+						if (!manager->AssetLoaded(handle))
+							manager->m_LoadedAssets[handle] = asset;
+
+						const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - pendingLoad.Start).count();
+						manager->m_LoadHistograms[asset->GetType()].Add(duration);
+					});
+				state->Decoding--;
+			});
+
+		return pendingLoad.Placeholder;
+	}
+
+	void RuntimeAssetManager::CancelAsyncLoads()
+	{
+		while (m_AsyncState->Decoding > 0)
+			std::this_thread::yield();
+
+		m_AsyncState->Generation++;
+		for (auto& [handle, pendingLoad] : m_PendingLoads)
+			pendingLoad.Placeholder->p_Status = Asset::Status::Invalid;
+		m_PendingLoads.clear();
+	}
+
+	void RuntimeAssetManager::UpdateResidency(const std::unordered_set<UUID>& referencedHandles)
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Assets added from a map, example when building a pack, can't be reloaded
+		const bool reloadable = m_AssetPack->m_Mapping.IsOpen();
+		AssetResidency::Result result = m_Residency.Update(m_LoadedAssets, referencedHandles, reloadable, reloadable);
+
+		for (const UUID& handle : result.Evict)
+		{
+			// Scenes view their assets by handle, they are requested again when needed
+			m_LoadedAssets.erase(handle);
+			GE_CORE_TRACE("RuntimeAssetManager::UpdateResidency() Evicted Asset : {0}", (uint64_t)handle);
+		}
+		for (const UUID& handle : result.Trim)
+		{
+			if (AssetLoaded(handle))
+				m_LoadedAssets.at(handle)->ReleaseCPUData();
+		}
+	}
+
 	const AssetMap& RuntimeAssetManager::GetLoadedAssets()
 	{
 		return m_LoadedAssets;
@@ -177,100 +285,236 @@ namespace GE
 
 	bool RuntimeAssetManager::SerializeAssets()
 	{
-		// .gap(Game Asset Pack) file
+		// .gap(Game Asset Pack) file, Version 5
+		//  Version 4 : Scenes without Columns. See SerializeScene()
+		//  Version 3 : Entries without Codec & RawSize, [40] each
+		//  Version 2 : Entities aligned. See SerializeEntity()
 		//  [bytes]
 
 		//	[8] header, info
-		//  [4] signature // File Extension "GAP"
+		//  [3] signature // File Extension "GAP"
 		//  [4] Version // File Format Version
+		//  [1] Padding // Aligns Table of Contents
 
-		//	[100 + ?] index, data. Size depends on Assets & Entities.
-		//  [8] Size	// Size of all Scenes, Count & Map
-		//	[8] Scene Map Count
-		//  [84 + ?] Scene Map			// Size based on how many Scenes are loaded
-		//      Asset Handle    : Key
-		//      [84 + ?] SceneInfo  : Value
-		//          [8] Packed Size : Size of whole Scene
-		//			[76 + ?] Data
-		//				[8] Handle
-		//				[2] Type
-		//				[8] Name
-		//				[8] Asset Map Count
-		//				[26 + ?] Asset Map			// Size based on how many Assets are loaded
-		//				    Asset Handle    : Key
-		//				    [26 + ?] AssetInfo	: Value
-		//				        [8] Packed Size
-		//						[18 + ?] Packed Data
-		//							[8] Handle
-		//							[2] Type
-		//							[8] Name
-		//							[?] Asset Specific Info : See DeserializeAsset(AssetInfo&)
-		//				[8] Entity Map Count
-		//				[16 + ?] Entity Map			// Size based on how many Entities are loaded
-		//				    Handle			: Key
-		//				    [8 + ?] EntityInfo	: Value
-		//				        [8] Packed Size
-		//						[?]	Packed Data
-		//							[?] Entity Specific Info : See DeserializeEntity(const EntityInfo&, Entity&)
+		//	[8 + 56 * Count] Table of Contents
+		//	[8] Entry Count
+		//  [56] Entry		// Per Asset, including Scenes
+		//		[8] Handle
+		//		[8] Type
+		//		[8] Offset	// Relative to SOF, aligned
+		//		[8] Size	// Stored
+		//		[8] Hash	// Stored, see AssetPack::GetHash()
+		//		[8] Codec	// See Compression::Codec
+		//		[8] RawSize	// Uncompressed
+
+		//	[?] Payloads, aligned & stored once at Entry.Offset
+		//		Scene : See SerializeScene(), references its Assets by handle. Never compressed
+		//		Asset : See SerializeAsset(), compressed stream if Codec isn't None
+
+		GE_PROFILE_FUNCTION();
 
 		AssetPack::File& packFile = m_AssetPack->m_File;
 		std::filesystem::path path = Project::GetPathToAsset(packFile.Path);
+		std::filesystem::path cachePath = path;
+		cachePath += "cache";
 		GE_CORE_TRACE("Serializing AssetRegistry\n\tFilePath : {0}", path.string().c_str());
+		const auto startTime = std::chrono::steady_clock::now();
 
-		std::ofstream stream(path, std::ios::app | std::ios::binary);
-		if (!stream)
-		{
-			GE_CORE_ERROR("Could not open Asset Pack file to write.");
-			return false;
-		}
+		// Loaded Scenes & pending loads may still view the file being written
+		CancelAsyncLoads();
+		m_AssetPack->ReleaseMapping();
+		// Pack may have been read from an older Version, always written as the current one
+		packFile.FileHeader.Version = AssetPack::File::Header().Version;
 
-		// Header
+		// Previous build, unchanged payloads are copied from it. Closed before the pack is written
+		MappedFile previousPack = MappedFile();
+		AssetPack::File::TableOfContents previousContents = AssetPack::File::TableOfContents();
 		{
-			stream.write(reinterpret_cast<const char*>(packFile.FileHeader.HEADER), sizeof(packFile.FileHeader.HEADER));
-			stream.write(reinterpret_cast<const char*>(&packFile.FileHeader.Version), sizeof(packFile.FileHeader.Version));
+			bool reusable = m_CookCache.Load(cachePath) && previousPack.Open(path);
+			if (reusable)
+			{
+				// Entries are only comparable within the current Version
+				const uint8_t* source = previousPack.GetData();
+				const uint8_t* end = source + previousPack.GetSize();
+				uint32_t previousVersion = 0;
+				reusable = ReadPackHeader(source, end, previousVersion) && previousVersion == packFile.FileHeader.Version
+					&& ReadTableOfContents(previousPack.GetData(), end, previousVersion, previousContents);
+			}
+			if (!reusable)
+			{
+				m_CookCache.Clear();
+				previousPack.Close();
+				previousContents.Entries.clear();
+			}
 		}
-
-		// Index
+		m_CookCache.ResetStats();
+		CookCache::Statistics& cookStats = m_CookCache.GetStats();
+
+		// Payloads, in write order
+		std::vector<std::pair<uint64_t, const AssetInfo*>> payloads = std::vector<std::pair<uint64_t, const AssetInfo*>>();
+		// Of compressed payloads only
+		uint64_t rawSize = 0, storedSize = 0;
+		for (const auto& [uuid, asset] : Project::GetAssetManager<RuntimeAssetManager>()->GetLoadedAssets())
 		{
-			for (const auto& [uuid, asset] : Project::GetAssetManager<RuntimeAssetManager>()->GetLoadedAssets())
+			AssetInfo* assetInfo = nullptr;
+			if (asset->GetType() == Asset::Type::Scene)
+				assetInfo = &packFile.Index.Scenes[uuid];
+			else
+				assetInfo = &packFile.Assets[uuid];
+
+			// Previous payload is only valid if it was built with the same settings & is the one in the pack
+			const CookCache::Entry* cached = m_CookCache.Find(uuid);
+			auto previousIt = previousContents.Entries.find(uuid);
+			const bool previousValid = cached && previousIt != previousContents.Entries.end()
+				&& cached->RequestedCodec == (uint16_t)m_Compression && cached->StoredHash == previousIt->second.Hash;
+
+			// Unchanged source file, copied without serializing
+			const uint64_t sourceKey = m_SourceKeys.find(uuid) != m_SourceKeys.end() ? m_SourceKeys.at(uuid) : 0;
+			const bool sourceUnchanged = previousValid && sourceKey && cached->SourceKey == sourceKey;
+			if (sourceUnchanged)
+				assetInfo->Type = previousIt->second.Type;
+			else if (!SerializeAsset(asset, *assetInfo))
+				continue;
+			payloads.emplace_back(uuid, assetInfo);
+
+			assetInfo->Codec = (uint16_t)Compression::Codec::None;
+			assetInfo->RawSize = 0;
+
+			// Without a source, serialized data is still needed to know if it changed, compressing it isn't
+			const uint64_t rawHash = sourceUnchanged ? cached->RawHash : CookCache::GetContentHash(assetInfo->DataBuffer);
+			if (sourceUnchanged || (previousValid && cached->RawHash == rawHash))
 			{
-				if (asset->GetType() == Asset::Type::Scene)
+				// Byte-for-byte copy, previous pack is closed before writing
+				const AssetPack::File::Entry& previous = previousIt->second;
+				assetInfo->DataBuffer.Release();
+				assetInfo->DataBuffer = Buffer(previousPack.GetData() + previous.Offset, previous.Size);
+				assetInfo->Codec = previous.Codec;
+				assetInfo->RawSize = previous.RawSize;
+				if (previous.Codec)
 				{
-					if (SerializeAsset(asset, packFile.Index.Scenes[uuid]))
-					{
-						// Scene and its children have been populated into pack->m_File.Index.Scenes.at(uuid)
-						// Scene.Size should represent the total scene size and be aligned
-						// Add to Index.Size for each Scene Asset
-						packFile.Index.Size += packFile.Index.Scenes.at(uuid).DataBuffer.GetSize();
-					}
+					rawSize += previous.RawSize;
+					storedSize += previous.Size;
 				}
+
+				cookStats.Hits++;
+				cookStats.ReusedBytes += previous.Size;
+				m_CookCache.Get(uuid).SourceKey = sourceKey;
+				continue;
 			}
 
-			// Index.Size contains
-			// - Scene Count
-			// - All Scenes
-			packFile.Index.Size += GetAligned(sizeof(packFile.Index.Scenes.size()));
-			stream.write(reinterpret_cast<const char*>(&packFile.Index.Size), sizeof(packFile.Index.Size));
+			cookStats.Misses++;
+			CookCache::Entry& cookEntry = m_CookCache.Get(uuid);
+			cookEntry.SourceKey = sourceKey;
+			cookEntry.RawHash = rawHash;
+			cookEntry.RequestedCodec = (uint16_t)m_Compression;
+			if (m_Compression != Compression::Codec::None && asset->GetType() != Asset::Type::Scene)
+			{
+				Buffer compressed = Compression::Compress(assetInfo->DataBuffer, m_Compression);
+				if (compressed)
+				{
+					rawSize += assetInfo->DataBuffer.GetSize();
+					storedSize += compressed.GetSize();
+
+					assetInfo->Codec = (uint16_t)m_Compression;
+					assetInfo->RawSize = assetInfo->DataBuffer.GetSize();
+					assetInfo->DataBuffer.Release();
+					assetInfo->DataBuffer = compressed;
+				}
+			}
+		}
+		if (rawSize)
+			GE_CORE_INFO("Asset Pack Compression\n\tRaw : {0} bytes\n\tStored : {1} bytes", rawSize, storedSize);
+
+		// Table of Contents
+		const uint64_t headerSize = GetAligned(sizeof(packFile.FileHeader.HEADER) + sizeof(packFile.FileHeader.Version));
+		const uint64_t entrySize = GetAligned(sizeof(uint64_t)) * 7;
+		const uint64_t contentsSize = GetAligned(sizeof(uint64_t)) + entrySize * payloads.size();
+
+		packFile.Contents.Entries.clear();
+		uint64_t offset = headerSize + contentsSize;
+		for (const auto& [uuid, assetInfo] : payloads)
+		{
+			AssetPack::File::Entry entry = AssetPack::File::Entry();
+			entry.Type = assetInfo->Type;
+			entry.Offset = offset;
+			entry.Size = assetInfo->DataBuffer.GetSize();
+			entry.Hash = AssetPack::GetHash(assetInfo->DataBuffer);
+			entry.Codec = assetInfo->Codec;
+			entry.RawSize = assetInfo->RawSize;
+			packFile.Contents.Entries[uuid] = entry;
+
+			offset += GetAligned(entry.Size);
+		}
 
-			uint64_t allScenesCount = packFile.Index.Scenes.size();
-			stream.write(reinterpret_cast<const char*>(&allScenesCount), sizeof(uint64_t));
-			for (const auto& [sceneHandle, sceneInfo] : packFile.Index.Scenes)
+		Buffer contentsBuffer = Buffer(headerSize + contentsSize);
+		{
+			uint8_t* destination = contentsBuffer.As<uint8_t>();
+			// Header, unaligned. Padded by zeroed Buffer
+			memcpy(destination, packFile.FileHeader.HEADER, sizeof(packFile.FileHeader.HEADER));
+			memcpy(destination + sizeof(packFile.FileHeader.HEADER), &packFile.FileHeader.Version, sizeof(packFile.FileHeader.Version));
+			destination += headerSize;
+
+			WriteAligned<uint64_t>(destination, payloads.size());
+			for (const auto& [uuid, assetInfo] : payloads)
 			{
-				// Write all data
-				// SceneInfo.Data contains all AssetInfo & EntityInfo
-				size_t sceneSize = sceneInfo.DataBuffer.GetSize();
-				stream.write(reinterpret_cast<const char*>(&sceneSize), sizeof(sceneSize));
-				stream.write(reinterpret_cast<const char*>(sceneInfo.DataBuffer.As<char>()), sceneSize * sizeof(uint8_t));
+				const AssetPack::File::Entry& entry = packFile.Contents.Entries.at(uuid);
+				WriteAligned<uint64_t>(destination, uuid);
+				WriteAligned<uint16_t>(destination, entry.Type);
+				WriteAligned<uint64_t>(destination, entry.Offset);
+				WriteAligned<uint64_t>(destination, entry.Size);
+				WriteAligned<uint64_t>(destination, entry.Hash);
+				WriteAligned<uint16_t>(destination, entry.Codec);
+				WriteAligned<uint64_t>(destination, entry.RawSize);
+			}
+		}
+
+		// Reused payloads are owned copies
+		previousPack.Close();
+
+		std::ofstream stream(path, std::ios::trunc | std::ios::binary);
+		if (!stream)
+		{
+			GE_CORE_ERROR("Could not open Asset Pack file to write.");
+			contentsBuffer.Release();
+			return false;
+		}
 
+		stream.write(contentsBuffer.As<char>(), contentsBuffer.GetSize());
+		contentsBuffer.Release();
+
+		// Payloads
+		{
+			const char padding[BYTE_ALIGNMENT] = {};
+			for (const auto& [uuid, assetInfo] : payloads)
+			{
+				const uint64_t size = assetInfo->DataBuffer.GetSize();
+				stream.write(assetInfo->DataBuffer.As<char>(), size);
+				stream.write(padding, GetAligned(size) - size);
 			}
 		}
 
 		if (stream.is_open() && stream.good())
 		{
 			stream.close();
-			GE_CORE_INFO("Asset Pack Serialization Complete");
+
+			// Stored hashes tie the cache to the pack just written
+			std::unordered_set<uint64_t> handles = std::unordered_set<uint64_t>();
+			for (const auto& [uuid, entry] : packFile.Contents.Entries)
+			{
+				m_CookCache.Get(uuid).StoredHash = entry.Hash;
+				handles.emplace(uuid);
+			}
+			m_CookCache.Retain(handles);
+			m_CookCache.Save(cachePath);
+
+			const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+			GE_CORE_INFO("Asset Pack Serialization Complete.\n\tPayloads Reused : {0}\n\tPayloads Rebuilt : {1}\n\tEntities Unchanged : {2}\n\tEntities Changed : {3}\n\tReused : {4} bytes\n\tDuration : {5}ms",
+				cookStats.Hits, cookStats.Misses, cookStats.EntityHits, cookStats.EntityMisses, cookStats.ReusedBytes, duration);
 			return true;
 		}
+		// Cache may no longer match what's on disk
+		m_CookCache.Clear();
+		std::filesystem::remove(cachePath);
 		GE_CORE_WARN("Asset Pack Serialization Failed.");
 		return false;
 	}
@@ -278,6 +522,72 @@ namespace GE
 	bool RuntimeAssetManager::DeserializeAssets()
 	{
 		// .gap(Game Asset Pack) file
+		// See SerializeAssets() for Version 2
+		// See DeserializeIndex() for Version 1
+
+		GE_PROFILE_FUNCTION();
+
+		AssetPack::File& packFile = m_AssetPack->m_File;
+		std::filesystem::path path = Project::GetPathToAsset(packFile.Path);
+		GE_CORE_INFO("Asset Pack Deserialization Started.\n\tFilePath : {0}", path.string().c_str());
+		const auto startTime = std::chrono::steady_clock::now();
+		const uint64_t copiedBytes = BufferStats::CopiedBytes;
+		const uint64_t residentSize = ProcessMemory::GetResidentSize();
+		m_LoadStats = LoadStatistics();
+
+		// Scene, Asset & Entity Buffers view the mapping, nothing is copied until consumed
+		CancelAsyncLoads();
+		m_AssetPack->ReleaseMapping();
+		if (!m_AssetPack->m_Mapping.Open(path))
+		{
+			GE_CORE_ERROR("Could not open Asset Pack file to read.");
+			return false;
+		}
+
+		const uint8_t* source = m_AssetPack->m_Mapping.GetData();
+		const uint8_t* end = source + m_AssetPack->m_Mapping.GetSize();
+
+		if (!ReadPackHeader(source, end, packFile.FileHeader.Version))
+		{
+			GE_CORE_ERROR("Could not read Asset Pack. Invalid header.");
+			m_AssetPack->m_Mapping.Close();
+			return false;
+		}
+
+		bool success = false;
+		switch (packFile.FileHeader.Version)
+		{
+		case 1:
+			success = DeserializeIndex(source, end);
+			break;
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+			success = DeserializeContents(end);
+			break;
+		default:
+			GE_CORE_ERROR("Could not read Asset Pack. Unknown Version : {0}", packFile.FileHeader.Version);
+			break;
+		}
+
+		// Only Scenes are decoded here, the rest are first requested by Project::SceneStart() prefetch
+		m_LoadStats.Duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+		m_LoadStats.Mapped = m_AssetPack->m_Mapping.GetSize();
+		m_LoadStats.Copied = BufferStats::CopiedBytes - copiedBytes;
+		m_LoadStats.Registered = (uint32_t)m_AssetPack->m_HandleIndex.size();
+		m_LoadStats.Decoded = (uint32_t)m_LoadedAssets.size();
+		m_LoadStats.ResidentGrowth = (int64_t)ProcessMemory::GetResidentSize() - (int64_t)residentSize;
+		m_LoadStats.PeakResident = ProcessMemory::GetPeakResidentSize();
+		GE_CORE_INFO("Asset Pack Deserialization {0}.\n\tMapped : {1} bytes\n\tCopied : {2} bytes\n\tRegistered : {3} Assets\n\tDecoded : {4} Assets\n\tResident Growth : {5} bytes\n\tPeak Resident : {6} bytes\n\tDuration : {7}ms",
+			success ? "Complete" : "Failed", m_LoadStats.Mapped, m_LoadStats.Copied, m_LoadStats.Registered, m_LoadStats.Decoded,
+			m_LoadStats.ResidentGrowth, m_LoadStats.PeakResident, m_LoadStats.Duration);
+		return success;
+	}
+
+	bool RuntimeAssetManager::DeserializeIndex(const uint8_t*& source, const uint8_t* end)
+	{
+		// .gap(Game Asset Pack) file, Version 1
 		//  [bytes]
 
 		//	[8] header, info
@@ -314,81 +624,126 @@ namespace GE
 		//							[?] Entity Specific Info : See DeserializeEntity(const EntityInfo&, Entity&)
 
 		AssetPack::File& packFile = m_AssetPack->m_File;
-		std::filesystem::path path = Project::GetPathToAsset(packFile.Path);
-		GE_CORE_INFO("Asset Pack Deserialization Started.\n\tFilePath : {0}", path.string().c_str());
 
-		std::ifstream stream(path, std::ios::app | std::ios::binary);
-		if (!stream)
-		{
-			GE_CORE_ERROR("Could not open Asset Pack file to read.");
+		uint64_t sceneCount = 0;
+		if (!ReadPacked(source, end, packFile.Index.Size) || !ReadPacked(source, end, sceneCount))
 			return false;
-		}
 
-		// Header
+		for (uint64_t i = 0; i < sceneCount; i++)
 		{
-			stream.read((char*)&packFile.FileHeader.HEADER, sizeof(packFile.FileHeader.HEADER));
-			stream.read((char*)&packFile.FileHeader.Version, sizeof(packFile.FileHeader.Version));
+			SceneInfo sceneInfo = SceneInfo();
+
+			size_t size = 0;
+			if (!ReadPacked(source, end, size) || source + size > end)
+			{
+				GE_CORE_ERROR("Could not read Asset Pack. Scene exceeds end of file.");
+				return false;
+			}
+
+			// Scenes are packed after unaligned header, ReadAligned() relies on x64 unaligned loads
+			sceneInfo.InitializeView(size, source);
+			source += size;
+
+			DeserializeSceneInfo(sceneInfo);
 		}
+		return true;
+	}
+
+	bool RuntimeAssetManager::DeserializeContents(const uint8_t* end)
+	{
+		AssetPack::File& packFile = m_AssetPack->m_File;
+		const uint8_t* base = m_AssetPack->m_Mapping.GetData();
+
+		if (!ReadTableOfContents(base, end, packFile.FileHeader.Version, packFile.Contents))
+			return false;
 
-		// Index
+		// Shared Assets first, Scenes reference them by handle
+		uint64_t rawSize = 0, storedSize = 0;
+		for (const auto& [handle, entry] : packFile.Contents.Entries)
 		{
-			stream.read((char*)&packFile.Index.Size, sizeof(packFile.Index.Size));
-			uint64_t sceneCount = 0;
-			stream.read((char*)&sceneCount, sizeof(sceneCount));
-			for (uint64_t i = 0; i < sceneCount; i++)
-			{
-				SceneInfo sceneInfo = SceneInfo();
+			if ((Asset::Type)entry.Type == Asset::Type::Scene)
+				continue;
+
+			// Compressed payloads are inflated when decoded, see DecodeAsset()
+			AssetInfo assetInfo = AssetInfo(entry.Type);
+			assetInfo.InitializeView(entry.Size, base + entry.Offset);
+			assetInfo.Codec = entry.Codec;
+			assetInfo.RawSize = entry.RawSize;
+			packFile.Assets.emplace(handle, assetInfo);
+			storedSize += entry.Size;
+			rawSize += entry.Codec ? entry.RawSize : entry.Size;
+			m_AssetPack->m_HandleIndex.emplace(handle);
+		}
 
-				size_t size = 0;
-				stream.read((char*)&size, sizeof(size));
+		for (const auto& [handle, entry] : packFile.Contents.Entries)
+		{
+			if ((Asset::Type)entry.Type != Asset::Type::Scene)
+				continue;
 
-				uint8_t* data = new uint8_t[size];
-				stream.read((char*)data, size * sizeof(uint8_t));
+			SceneInfo sceneInfo = SceneInfo();
+			sceneInfo.InitializeView(entry.Size, base + entry.Offset);
+			DeserializeSceneInfo(sceneInfo);
+		}
 
-				sceneInfo.DataBuffer = Buffer(data, size);
+		m_LoadStats.AssetsRaw = rawSize;
+		m_LoadStats.AssetsStored = storedSize;
+		GE_CORE_INFO("Asset Pack Contents\n\tAssets Raw : {0} bytes\n\tAssets Stored : {1} bytes", rawSize, storedSize);
+		return true;
+	}
 
-				delete[] data;
+	bool RuntimeAssetManager::DeserializeSceneInfo(SceneInfo& sceneInfo)
+	{
+		bool success = false;
+		// Includes Entities created from SceneColumns in DeserializeAsset<Scene>(AssetInfo&)
+		const auto startTime = std::chrono::steady_clock::now();
+		if (Ref<Asset> sceneAsset = DeserializeAsset(sceneInfo))
+		{
+			// Registered with Pack data first, AddAsset() would register it without
+			if (m_AssetPack->AddAsset(sceneAsset, sceneInfo))
+			{
+				m_LoadedAssets.emplace(sceneAsset->GetHandle(), sceneAsset);
+				success = true;
+				// Scene Assets are only registered with their handle, decoded by GetAsset() or GetAssetAsync() when used
 
-				if (Ref<Asset> sceneAsset = DeserializeAsset(sceneInfo))
+				if (Ref<Scene> scene = Project::GetAssetAs<Scene>(sceneAsset))
 				{
-					if (Project::GetAssetManager()->AddAsset(sceneAsset) && m_AssetPack->AddAsset(sceneAsset, sceneInfo))
+					// Entities are created in DeserializeAsset<Scene>(AssetInfo&)
+					// Looked up once, GetEntityByUUID() is linear until the spatial index is built
+					std::vector<Entity> entities = scene->GetAllEntitiesWith<IDComponent>();
+					std::unordered_map<uint64_t, Entity> entityMap = std::unordered_map<uint64_t, Entity>();
+					entityMap.reserve(entities.size());
+					for (Entity entity : entities)
+						entityMap.emplace(scene->GetComponent<IDComponent>(entity).ID, entity);
+
+					uint64_t entityBytes = 0;
+					for (const auto& [uuid, entityInfo] : sceneInfo.Entities)
 					{
-						for (const auto& [uuid, childAssetInfo] : sceneInfo.Assets)
-						{
-							if (Ref<Asset> childAsset = DeserializeAsset(childAssetInfo))
-							{
-								Project::GetAssetManager()->AddAsset(childAsset);
-							}
-						}
+						auto it = entityMap.find(uuid);
+						if (it == entityMap.end())
+							continue;
 
-						if (Ref<Scene> scene = Project::GetAssetAs<Scene>(sceneAsset))
+						Entity entity = it->second;
+						entityBytes += entityInfo.DataBuffer.GetSize();
+						if (!DeserializeEntity(scene, entityInfo, entity))
 						{
-							for (const auto& [uuid, entityInfo] : sceneInfo.Entities)
-							{
-								// Entity is created in DeserializeAsset<Scene>(AssetInfo&)
-								Entity entity = scene->GetEntityByUUID(uuid);
-								if (!DeserializeEntity(scene, entityInfo, entity))
-								{
-									scene->DestroyEntity(entity);
-								}
-							}
+							scene->DestroyEntity(entity);
 						}
 					}
+
+					// Layouts are compared by Entities/s, see SceneColumns
+					const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+					GE_CORE_INFO("RuntimeAssetManager::DeserializeSceneInfo() Entities Loaded.\n\tLayout : {0}\n\tCount : {1}\n\tEntity Data : {2} bytes\n\tDuration : {3}ms\n\tThroughput : {4} Entities/s",
+						sceneInfo.ColumnEntityCount ? "Columns" : "Entities", entities.size(), entityBytes, duration, duration > 0.0f ? (uint64_t)(entities.size() / (duration / 1000.0f)) : 0);
 				}
-				else
-				{
-					GE_CORE_ERROR("Could not deserialize Scene Asset.");
-				}
-				sceneInfo.ClearAllData();
 			}
 		}
-
-		if (stream.is_open() && stream.good())
+		else
 		{
-			stream.close();
-			return true;
+			GE_CORE_ERROR("Could not deserialize Scene Asset.");
 		}
-		return false;
+		// Views only, Pack keeps its own views of the mapping
+		sceneInfo.ClearAllData();
+		return success;
 	}
 
 #pragma region Asset Info Serialization
@@ -411,6 +766,9 @@ namespace GE
 		case Asset::Type::Script:
 			return SerializeScript(asset, assetInfo);
 			break;
+		case Asset::Type::Prefab:
+			return SerializePrefab(asset, assetInfo);
+			break;
 		default:
 			GE_CORE_ERROR("Serialize asset info function not found for Type: " + AssetUtils::AssetTypeToString(asset->GetType()));
 			break;
@@ -420,63 +778,129 @@ namespace GE
 
 	Ref<Asset> RuntimeAssetManager::DeserializeAsset(const AssetInfo& assetInfo)
 	{
+		if (assetInfo.Codec != (uint16_t)Compression::Codec::None)
+		{
+			Ref<AssetInfo> inflated = InflateAsset(assetInfo);
+			return inflated ? DeserializeAsset(*inflated) : nullptr;
+		}
+
+		Ref<Asset> asset = nullptr;
 		Asset::Type assetType = (Asset::Type)assetInfo.Type;
 		switch (assetType)
 		{
 		case Asset::Type::Scene:
-			return DeserializeScene(assetInfo);
+			asset = DeserializeScene(assetInfo);
 			break;
 		case Asset::Type::Texture2D:
-			return DeserializeTexture2D(assetInfo);
+			asset = DeserializeTexture2D(assetInfo);
 			break;
 		case Asset::Type::Font:
-			return DeserializeFont(assetInfo);
+			asset = DeserializeFont(assetInfo);
 			break;
 		case Asset::Type::Audio:
-			return DeserializeAudio(assetInfo);
+			asset = DeserializeAudio(assetInfo);
 			break;
 		case Asset::Type::Script:
-			return DeserializeScript(assetInfo);
+			asset = DeserializeScript(assetInfo);
+			break;
+		case Asset::Type::Prefab:
+			asset = DeserializePrefab(assetInfo);
 			break;
 		default:
 			GE_CORE_ERROR("Deserialize function not found for Type: " + AssetUtils::AssetTypeToString(assetType));
 			break;
 		}
-		return nullptr;
+
+		if (asset)
+			asset->p_Status = Asset::Status::Ready;
+		return asset;
 	}
 
-	bool RuntimeAssetManager::SerializeScene(Ref<Asset> asset, AssetInfo& assetInfo)
+	std::function<Ref<Asset>()> RuntimeAssetManager::DecodeAsset(const AssetInfo& assetInfo)
 	{
-		// ScenePackFormat
-		//      [84 + ?] SceneInfo  : Value, corresponding Key handled in SerializePack
-		//          [8] Packed Size : Size of whole Scene
-		//			[76 + ?] Data
-		//				[8] Handle
-		//				[2] Type
-		//				[8] Asset Map Count
-		//				[26 + ?] Asset Map			// Size based on how many Assets are loaded
-		//				    Asset Handle    : Key
-		//				    [26 + ?] AssetInfo	: Value
-		//				        [8] Packed Size
-		//						[18 + ?] Packed Data
-		//							[8] Handle
-		//							[2] Type
-		//							[8] Name
-		//							[?] Asset Specific Info : See DeserializeAsset(AssetInfo&)
-		//				[8] Entity Map Count
-		//				[16 + ?] Entity Map			// Size based on how many Entities are loaded
-		//				    Handle			: Key
-		//				    [8 + ?] EntityInfo	: Value
-		//				        [8] Packed Size
-		//						[?]	Packed Data
-		//							[?] Entity Specific Info : See DeserializeEntity(const EntityInfo&, Entity&)
+		GE_PROFILE_FUNCTION();
+
+		if (assetInfo.Codec != (uint16_t)Compression::Codec::None)
+		{
+			Ref<AssetInfo> inflated = InflateAsset(assetInfo);
+			std::function<Ref<Asset>()> create = inflated ? DecodeAsset(*inflated) : nullptr;
+			if (!create)
+				return nullptr;
+			// Decoded data views inflated, keep it until created
+			return [inflated, create]() { return create(); };
+		}
+
+		Asset::Type assetType = (Asset::Type)assetInfo.Type;
+		switch (assetType)
+		{
+		case Asset::Type::Texture2D:
+			return DecodeTexture2D(assetInfo);
+			break;
+		case Asset::Type::Font:
+			return DecodeFont(assetInfo);
+			break;
+		case Asset::Type::Audio:
+			return DecodeAudio(assetInfo);
+			break;
+		default:
+			break;
+		}
+
+		// Scenes & Scripts aren't split yet. Only page in here, deserialize on main thread
+		TouchPages(assetInfo.DataBuffer);
+		return [this, view = assetInfo.GetView()]() { return DeserializeAsset(view); };
+	}
+
+	Ref<AssetInfo> RuntimeAssetManager::InflateAsset(const AssetInfo& assetInfo)
+	{
+		GE_PROFILE_FUNCTION();
+
+		Ref<AssetInfo> inflated = Ref<AssetInfo>(new AssetInfo(assetInfo.Type), [](AssetInfo* info)
+			{
+				info->DataBuffer.Release();
+				delete info;
+			});
+		inflated->InitializeData(assetInfo.RawSize);
+
+		// Blocks are split across workers, the calling thread decodes too
+		if (!Compression::Decompress(assetInfo.DataBuffer, (Compression::Codec)assetInfo.Codec, inflated->DataBuffer, Application::SubmitToWorkerThread))
+		{
+			GE_CORE_ERROR("RuntimeAssetManager::InflateAsset(AssetInfo&) Failed.\n\tCorrupt or unknown Codec : {0}", assetInfo.Codec);
+			return nullptr;
+		}
+		return inflated;
+	}
+
+	bool RuntimeAssetManager::SerializeScene(Ref<Asset> asset, AssetInfo& assetInfo)
+	{
+		// ScenePackFormat, Version 5
+		//      [?] SceneInfo  : Payload, see SerializeAssets()
+		//			[8] Handle
+		//			[8] Type
+		//			[8] Step Frames
+		//			[8] Asset Handle Count
+		//			[8 * Count] Asset Handles	// Referenced by Components, payloads are shared. See AssetPack::File::TableOfContents
+		//			[8 + ?] Columns				// Version 5, see SceneColumns. Entities holding only columnar Components have no EntityInfo
+		//			[8] Entity Map Count
+		//			[?] Entity Map				// Size based on how many Entities are loaded
+		//			    [1-10 + ?] EntityInfo	// Unaligned
+		//			        [1-10] Packed Size	// Varint. Version 2 : [8], aligned
+		//					[?]	Packed Data
+		//						[?] Entity Specific Info : See SerializeEntity()
 
 		Ref<Scene> scene = Project::GetAssetAs<Scene>(asset);
 		if (!scene)
 			return false;
-		SceneInfo sceneInfo = *(SceneInfo*)&assetInfo;
+		// Entity data is only needed until written below, freed together
+		SceneInfo sceneInfo = SceneInfo();
+		BufferArena entityArena = BufferArena();
+		std::vector<uint64_t> assetHandles = std::vector<uint64_t>();
 		uint64_t requiredSize = 0;
 
+		// Empty if disabled, every Component is then stored per Entity
+		const SceneColumns sceneColumns = m_ColumnarScenes ? SceneColumns(scene) : SceneColumns(nullptr);
+		const bool columns = sceneColumns.GetEntityCount() > 0;
+
 		// Calculate Size
 		{
 			const UUID& sceneHandle = scene->GetHandle();
@@ -485,36 +909,62 @@ namespace GE
 				+ GetAligned(sizeof(scene->GetType()))	// sizeof(uint16_t)
 				+ GetAligned(sizeof(sceneConfig.StepFrames)); // sizeof(uint64_t)
 
-			// For Assets
+			// For Assets, by handle only. Only those referenced by Components, others are still in the Table of Contents
 			{
-				AssetMap assetMap = Project::GetAssetManager<RuntimeAssetManager>()->GetLoadedAssets();
-				requiredSize += GetAligned(sizeof(assetMap.size())); //sizeof(assetCount)
-				for (const auto& [uuid, asset] : assetMap)
+				std::unordered_set<UUID> referencedHandles = std::unordered_set<UUID>();
+				scene->GetAssetHandles(referencedHandles);
+
+				const AssetMap& assetMap = Project::GetAssetManager<RuntimeAssetManager>()->GetLoadedAssets();
+				for (const UUID& uuid : referencedHandles)
 				{
-					if (uuid == sceneHandle || asset->GetType() == Asset::Type::Scene)
+					auto assetIt = assetMap.find(uuid);
+					if (uuid == sceneHandle || assetIt == assetMap.end() || assetIt->second->GetType() == Asset::Type::Scene)
 						continue;
 
-					if (SerializeAsset(asset, sceneInfo.Assets[uuid]))
-					{
-						// += SizeofData + Data
-						requiredSize += GetAlignedOfArray<uint8_t>(sceneInfo.Assets.at(uuid).DataBuffer.GetSize());
-					}
+					assetHandles.push_back(uuid);
 				}
+				// Same order every build, see CookCache
+				std::sort(assetHandles.begin(), assetHandles.end());
+				requiredSize += GetAlignedOfArray<uint64_t>(assetHandles.size());
 			}
 
+			requiredSize += sceneColumns.GetSize();
+
 			// For Entities
 			{
 				requiredSize += GetAligned(sizeof(uint64_t)); //sizeof(eCount)
 				{
+					// Entity hashes of previous build, see CookCache
+					CookCache::Entry& cookEntry = m_CookCache.Get(sceneHandle);
+					std::unordered_map<uint64_t, uint64_t> previousHashes = std::move(cookEntry.Entities);
+					cookEntry.Entities.clear();
+					CookCache::Statistics& cookStats = m_CookCache.GetStats();
+
 					// Every Entity needs an ID
 					std::vector<Entity> entities = scene->GetAllEntitiesWith<IDComponent>();
 					for (Entity entity : entities)
 					{
 						UUID uuid = scene->GetComponent<IDComponent>(entity).ID;
-						if (SerializeEntity(scene, sceneInfo.Entities[uuid], entity))
+						if (SerializeEntity(scene, sceneInfo.Entities[uuid], entity, &entityArena, columns))
 						{
+							const Buffer& entityBuffer = sceneInfo.Entities.at(uuid).DataBuffer;
+							// Every Component is in a column
+							if (!entityBuffer)
+							{
+								sceneInfo.Entities.erase(uuid);
+								continue;
+							}
+
 							// += SizeofData + Data
-							requiredSize += GetAlignedOfArray<uint8_t>(sceneInfo.Entities.at(uuid).DataBuffer.GetSize());
+							requiredSize += GetPackedOfArray<uint8_t>(entityBuffer.GetSize());
+
+							const uint64_t hash = CookCache::GetContentHash(entityBuffer);
+							auto previousIt = previousHashes.find(uuid);
+							if (previousIt != previousHashes.end() && previousIt->second == hash)
+								cookStats.EntityHits++;
+							else
+								cookStats.EntityMisses++;
+							cookEntry.Entities[uuid] = hash;
 						}
 
 					}
@@ -553,18 +1003,12 @@ namespace GE
 
 						// For Assets
 						{
-							WriteAligned<uint64_t>(destination, sceneInfo.Assets.size());
-
-							for (const auto& [uuid, assetInfo] : sceneInfo.Assets)
-							{
-								//  asset size & data
-								const uint8_t* data = assetInfo.DataBuffer.As<uint8_t>();
-								WriteAlignedArray<uint8_t>(destination, data, assetInfo.DataBuffer.GetSize());
-
-							}
-
+							const uint64_t* data = assetHandles.data();
+							WriteAlignedArray<uint64_t>(destination, data, assetHandles.size());
 						}
 
+						sceneColumns.Write(destination);
+
 						// For Entities
 						{
 							WriteAligned<uint64_t>(destination, sceneInfo.Entities.size());
@@ -573,14 +1017,14 @@ namespace GE
 							{
 								// e size & data
 								const uint8_t* data = eInfo.DataBuffer.As<uint8_t>();
-								WriteAlignedArray<uint8_t>(destination, data, eInfo.DataBuffer.GetSize());
+								WritePackedArray<uint8_t>(destination, data, eInfo.DataBuffer.GetSize());
 							}
 						}
 					}
 
 					if (destination - assetInfo.DataBuffer.As<uint8_t>() == requiredSize)
 					{
-						GE_CORE_INFO("RuntimeAssetManager::SerializeScene() Successful.");
+						GE_CORE_INFO("RuntimeAssetManager::SerializeScene() Successful.\n\tColumn Entities : {0}\n\tEntities : {1}\n\tSize : {2} bytes", sceneColumns.GetEntityCount(), sceneInfo.Entities.size(), requiredSize);
 					}
 					else
 					{
@@ -597,13 +1041,13 @@ namespace GE
 
 		}
 
-		// assetInfo has all Serialized Data.
+		// assetInfo has all Serialized Data. Entity data views entityArena
 		sceneInfo.ClearAllData();
 		return true;
 
 	}
 
-	bool RuntimeAssetManager::SerializeEntity(Ref<Scene> scene, SceneInfo::EntityInfo& eInfo, const Entity& entity)
+	bool RuntimeAssetManager::SerializeEntity(Ref<Scene> scene, SceneInfo::EntityInfo& eInfo, const Entity& entity, BufferArena* arena /*= nullptr*/, bool columns /*= false*/)
 	{
 		uint64_t requiredSize = 0;
 
@@ -616,62 +1060,62 @@ namespace GE
 				return false;
 			}
 			// ComponentType as uint16_t + IDComponent UUID  
-			requiredSize += GetAligned(sizeof(uint16_t)) + GetAligned(sizeof(uint64_t));
+			requiredSize += sizeof(uint16_t) + sizeof(uint64_t);
 
 			// Tag Component 
-			if (scene->HasComponent<TagComponent>(entity))
+			if (!columns && scene->HasComponent<TagComponent>(entity))
 			{
 				TagComponent tc = scene->GetComponent<TagComponent>(entity);
-				requiredSize += GetAligned(sizeof(uint16_t)) + GetAligned(sizeof(tc.TagID));
+				requiredSize += sizeof(uint16_t) + sizeof(tc.TagID);
 			}
 
 			// Name Component 
-			if (scene->HasComponent<NameComponent>(entity))
+			if (!columns && scene->HasComponent<NameComponent>(entity))
 			{
 				NameComponent nc = scene->GetComponent<NameComponent>(entity);
 				// Component identifier + Name String
-				requiredSize += GetAligned(sizeof(uint16_t)) + GetAlignedOfArray<char>(nc.Name.size());
+				requiredSize += sizeof(uint16_t) + GetPackedOfArray<char>(nc.Name.size());
 			}
 
-			if (scene->HasComponent<ActiveComponent>(entity))
+			if (!columns && scene->HasComponent<ActiveComponent>(entity))
 			{
-				requiredSize += GetAligned(sizeof(uint16_t)) + GetAligned(sizeof(bool)) + GetAligned(sizeof(bool));
+				requiredSize += sizeof(uint16_t) + sizeof(bool) + sizeof(bool);
 			}
-			if (scene->HasComponent<RelationshipComponent>(entity))
+			if (!columns && scene->HasComponent<RelationshipComponent>(entity))
 			{
 				auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
-				requiredSize += GetAligned(sizeof(uint16_t)) + GetAligned(sizeof(uint64_t)) + GetAlignedOfArray<uint64_t>(rsc.Children.size());
+				requiredSize += sizeof(uint16_t) + sizeof(uint64_t) + GetPackedOfArray<uint64_t>(rsc.Children.size());
 			}
 
 			// Transform
-			if (scene->HasComponent<TransformComponent>(entity))
+			if (!columns && scene->HasComponent<TransformComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				// Translation
-				requiredSize += GetAlignedOfVec3<float>();
+				requiredSize += GetPackedOfVec3<float>();
 
 				// Rotation
-				requiredSize += GetAlignedOfVec3<float>();
+				requiredSize += GetPackedOfVec3<float>();
 
 				// Scale
-				requiredSize += GetAlignedOfVec3<float>();
+				requiredSize += GetPackedOfVec3<float>();
 
 				// Pivot Enum
-				requiredSize += GetAligned(sizeof(uint32_t));
+				requiredSize += sizeof(uint32_t);
 			}
 
 			// AudioSource
-			if (scene->HasComponent<AudioSourceComponent>(entity))
+			if (!columns && scene->HasComponent<AudioSourceComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint64_t))	// Audio Asset UUID, See Assets(UUID)
-					+ GetAligned(sizeof(bool))					// Loop
-					+ GetAligned(sizeof(float))				// Pitch
-					+ GetAligned(sizeof(float));				//Gain
+				requiredSize += sizeof(uint64_t)	// Audio Asset UUID, See Assets(UUID)
+					+ sizeof(bool)					// Loop
+					+ sizeof(float)				// Pitch
+					+ sizeof(float);				//Gain
 
 			}
 
@@ -679,309 +1123,319 @@ namespace GE
 			if (scene->HasComponent<AudioListenerComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 			}
 
 			// Render
-			if (scene->HasComponent<RenderComponent>(entity))
+			if (!columns && scene->HasComponent<RenderComponent>(entity))
 			{
 				auto& rc = scene->GetComponent<RenderComponent>(entity);
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned<uint64_t>(rc.LayerIDs.size() * sizeof(uint64_t));
+				requiredSize += GetPackedOfArray<uint64_t>(rc.LayerIDs.size());
 			}
 
 			// Camera
 			if (scene->HasComponent<CameraComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(bool))	// Primary
-					+ GetAligned(sizeof(bool));			// FixedAspectRatio
+				requiredSize += sizeof(bool)	// Primary
+					+ sizeof(bool);			// FixedAspectRatio
 
 				// SceneCamera Variables
-				requiredSize += GetAligned(sizeof(float))	// FOV
-					+ GetAligned(sizeof(float))			// NearCip
-					+ GetAligned(sizeof(float));			// FarCip
+				requiredSize += sizeof(float)	// FOV
+					+ sizeof(float)			// NearCip
+					+ sizeof(float);			// FarCip
 			}
 
 			// SpriteRenderer
-			if (scene->HasComponent<SpriteRendererComponent>(entity))
+			if (!columns && scene->HasComponent<SpriteRendererComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				SpriteRendererComponent src = scene->GetComponent<SpriteRendererComponent>(entity);
 
-				requiredSize += GetAligned(sizeof(uint64_t))	// Texture Asset UUID
-					+ GetAligned(sizeof(float));				// TilingFactor
+				requiredSize += sizeof(uint64_t)	// Texture Asset UUID
+					+ sizeof(float);				// TilingFactor
 
 				// Color
-				requiredSize += GetAlignedOfVec4<float>();
+				requiredSize += GetPackedOfVec4<float>();
+
+				requiredSize += sizeof(bool);		// Static
 			}
 
 			// CircleRenderer
-			if (scene->HasComponent<CircleRendererComponent>(entity))
+			if (!columns && scene->HasComponent<CircleRendererComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				CircleRendererComponent crc = scene->GetComponent<CircleRendererComponent>(entity);
 
-				requiredSize += GetAligned(sizeof(uint64_t))	// Texture Asset UUID
-					+ GetAligned(sizeof(float))				// TilingFactor
-					+ GetAligned(sizeof(float))				// Radius
-					+ GetAligned(sizeof(float))				// Thickness
-					+ GetAligned(sizeof(float));				// Fade
+				requiredSize += sizeof(uint64_t)	// Texture Asset UUID
+					+ sizeof(float)				// TilingFactor
+					+ sizeof(float)				// Radius
+					+ sizeof(float)				// Thickness
+					+ sizeof(float);				// Fade
 
 				// Color
-				requiredSize += GetAlignedOfVec4<float>();
+				requiredSize += GetPackedOfVec4<float>();
 			}
 
 			// TextRenderer
 			if (scene->HasComponent<TextRendererComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				TextRendererComponent trc = scene->GetComponent<TextRendererComponent>(entity);
 
-				requiredSize += GetAligned(sizeof(uint64_t))		// Texture Asset UUID
-					+ GetAligned(sizeof(trc.KerningOffset))			// KerningOffset
-					+ GetAligned(sizeof(trc.LineHeightOffset))		// LineHeightOffset
-					+ GetAlignedOfArray<char>(trc.Text.size());		// size of Text String & Text String
+				requiredSize += sizeof(uint64_t)		// Texture Asset UUID
+					+ sizeof(trc.KerningOffset)			// KerningOffset
+					+ sizeof(trc.LineHeightOffset)		// LineHeightOffset
+					+ GetPackedOfArray<char>(trc.Text.size());		// size of Text String & Text String
 
 				// TextColor & BGColor
-				requiredSize += GetAlignedOfVec4<float>() + GetAlignedOfVec4<float>();
+				requiredSize += GetPackedOfVec4<float>() + GetPackedOfVec4<float>();
 				// TextScalar & Offset
-				requiredSize += GetAligned(sizeof(float)) + GetAlignedOfVec2<float>();
+				requiredSize += sizeof(float) + GetPackedOfVec2<float>();
 
 			}
 			if (scene->HasComponent<GUICanvasComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint32_t)); // CanvasMode
+				requiredSize += sizeof(bool) + sizeof(bool) // ControlMouse & ShowMouse
+					+ sizeof(uint32_t); // CanvasMode
 			}
 			if (scene->HasComponent<GUILayoutComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint32_t)) + // LayoutMode
-					GetAlignedOfVec2<float>() + GetAlignedOfVec2<float>() + GetAlignedOfVec2<float>();
+				requiredSize += sizeof(uint32_t) + // LayoutMode
+					GetPackedOfVec2<float>() + GetPackedOfVec2<float>() + GetPackedOfVec2<float>();
 			}
 			// TODO : GUIMaskComponent
 			if (scene->HasComponent<GUIImageComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAlignedOfVec4<float>() + GetAligned(sizeof(UUID)) + GetAligned(sizeof(float));
+				requiredSize += GetPackedOfVec4<float>() + sizeof(UUID) + sizeof(float);
 			}
 			if (scene->HasComponent<GUIButtonComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				auto& guiBC = scene->GetComponent<GUIButtonComponent>(entity);
-				requiredSize += GetAligned(sizeof(uint64_t))		// Font Asset UUID
-					+ GetAligned(sizeof(float))						// KerningOffset
-					+ GetAligned(sizeof(float))						// LineHeightOffset
-					+ GetAlignedOfArray<char>(guiBC.Text.size())	// size of Text String & Text String
-					+ GetAlignedOfVec4<float>() + GetAlignedOfVec4<float>() // TextColor & BGColor
-					+ GetAligned(sizeof(float)) + GetAlignedOfVec2<float>() + GetAlignedOfVec2<float>(); // Text SizeScalar & StartingOffset & TextSize
+				requiredSize += sizeof(uint64_t)		// Font Asset UUID
+					+ sizeof(float)						// KerningOffset
+					+ sizeof(float)						// LineHeightOffset
+					+ GetPackedOfArray<char>(guiBC.Text.size())	// size of Text String & Text String
+					+ GetPackedOfVec4<float>() + GetPackedOfVec4<float>() // TextColor & BGColor
+					+ sizeof(float) + GetPackedOfVec2<float>() + GetPackedOfVec2<float>(); // Text SizeScalar & StartingOffset & TextSize
 
 				// BG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 
 				// MG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 
 				// FG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 			}
 			if (scene->HasComponent<GUIInputFieldComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 
 				auto& guiIFC = scene->GetComponent<GUIInputFieldComponent>(entity);
-				requiredSize += GetAligned(sizeof(uint64_t))		// BG Texture Asset UUID
-					+ GetAlignedOfVec4<float>() // BG Texture Color
-					+ GetAligned(sizeof(bool)); // Fill BG
-
-				requiredSize += GetAligned(sizeof(uint64_t))		// Font Asset UUID
-					+ GetAligned(sizeof(float))						// KerningOffset
-					+ GetAligned(sizeof(float))						// LineHeightOffset
-					+ GetAlignedOfArray<char>(guiIFC.Text.size())	// size of Text String & Text String
-					+ GetAlignedOfVec4<float>() + GetAlignedOfVec4<float>() // TextColor & BGColor
-					+ GetAligned(sizeof(float)) + GetAlignedOfVec2<float>() // Text SizeScalar & StartingOffset
-					+ GetAlignedOfVec2<float>() + GetAlignedOfVec2<float>(); // Text Size & Padding
+				requiredSize += sizeof(uint64_t)		// BG Texture Asset UUID
+					+ GetPackedOfVec4<float>() // BG Texture Color
+					+ sizeof(bool); // Fill BG
+
+				requiredSize += sizeof(uint64_t)		// Font Asset UUID
+					+ sizeof(float)						// KerningOffset
+					+ sizeof(float)						// LineHeightOffset
+					+ GetPackedOfArray<char>(guiIFC.Text.size())	// size of Text String & Text String
+					+ GetPackedOfVec4<float>() + GetPackedOfVec4<float>() // TextColor & BGColor
+					+ sizeof(float) + GetPackedOfVec2<float>() // Text SizeScalar & StartingOffset
+					+ GetPackedOfVec2<float>() + GetPackedOfVec2<float>(); // Text Size & Padding
 
 			}
 			if (scene->HasComponent<GUISliderComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint32_t)) + GetAligned(sizeof(float));
+				requiredSize += sizeof(uint32_t) + sizeof(float);
 
 				// BG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 				// MG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 				// FG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 
 			}
 			if (scene->HasComponent<GUICheckboxComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				// BG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 				// MG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 				// FG
-				requiredSize += GetAligned(sizeof(uint64_t)) + GetAlignedOfVec4<float>();
+				requiredSize += sizeof(uint64_t) + GetPackedOfVec4<float>();
 
 			}
 
 			// TODO : GUIScrollRectComponent & GUIScrollbarComponent
 
 			// Rigidbody2D
-			if (scene->HasComponent<Rigidbody2DComponent>(entity))
+			if (!columns && scene->HasComponent<Rigidbody2DComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(uint16_t))	// Type
-					+ GetAligned(sizeof(bool));					// FixedRotation
+				requiredSize += sizeof(uint16_t)	// Type
+					+ sizeof(bool);					// FixedRotation
 			}
 
 			// BoxCollider2D
-			if (scene->HasComponent<BoxCollider2DComponent>(entity))
+			if (!columns && scene->HasComponent<BoxCollider2DComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(bool))	// Show
-					+ GetAligned(sizeof(float))			// Density
-					+ GetAligned(sizeof(float))			// Friction
-					+ GetAligned(sizeof(float))			// Restitution
-					+ GetAligned(sizeof(float));			// RestitutionThreshold
+				requiredSize += sizeof(bool)	// Show
+					+ sizeof(float)			// Density
+					+ sizeof(float)			// Friction
+					+ sizeof(float)			// Restitution
+					+ sizeof(float);			// RestitutionThreshold
 
 				// Offset
-				requiredSize += GetAlignedOfVec2<float>();
+				requiredSize += GetPackedOfVec2<float>();
 
 				// Size
-				requiredSize += GetAlignedOfVec2<float>();
+				requiredSize += GetPackedOfVec2<float>();
 
 			}
 
 			// CircleCollider2D
-			if (scene->HasComponent<CircleCollider2DComponent>(entity))
+			if (!columns && scene->HasComponent<CircleCollider2DComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
-				requiredSize += GetAligned(sizeof(bool))	// Show
-					+ GetAligned(sizeof(float))				// Density
-					+ GetAligned(sizeof(float))				// Friction
-					+ GetAligned(sizeof(float))				// Restitution
-					+ GetAligned(sizeof(float));			// RestitutionThreshold
+				requiredSize += sizeof(bool)	// Show
+					+ sizeof(float)				// Density
+					+ sizeof(float)				// Friction
+					+ sizeof(float)				// Restitution
+					+ sizeof(float);			// RestitutionThreshold
 
 				// Radius & Offset
-				requiredSize += GetAligned(sizeof(float)) + GetAlignedOfVec2<float>();
+				requiredSize += sizeof(float) + GetPackedOfVec2<float>();
 			}
 
 			// NativeScript
 			if (scene->HasComponent<NativeScriptComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 			}
 
 			// Script
 			if (scene->HasComponent<ScriptComponent>(entity))
 			{
 				// Component identifier
-				requiredSize += GetAligned(sizeof(uint16_t));
+				requiredSize += sizeof(uint16_t);
 
 				ScriptComponent sc = scene->GetComponent<ScriptComponent>(entity);
-				requiredSize += GetAligned(sizeof(sc.AssetHandle));
+				requiredSize += sizeof(sc.AssetHandle);
 
 				// Field Name, Type & Data
 				const ScriptFieldMap& fields = Scripting::GetEntityFields(scene->GetComponent<IDComponent>(entity).ID);
-				requiredSize += GetAligned(sizeof(uint64_t)); // size of Fields
+				requiredSize += GetVarintSize(fields.size()); // size of Fields
 				for (const auto& [name, field] : fields)
 				{
 					const char* fieldName = name.c_str();
-					requiredSize += GetAlignedOfArray<char>(name.size()) // Field Name
-						+ GetAligned(sizeof(uint16_t));					// Field Type
+					requiredSize += GetPackedOfArray<char>(name.size()) // Field Name
+						+ sizeof(uint32_t);					// Field Type
 
 					// Field Data
 					switch (field.GetType())
 					{
 					case ScriptField::Type::Char:
-						requiredSize += GetAligned(sizeof(char));
+						requiredSize += sizeof(char);
 						break;
 					case ScriptField::Type::Int:
-						requiredSize += GetAligned(sizeof(int));
+						requiredSize += sizeof(int);
 						break;
 					case ScriptField::Type::UInt:
-						requiredSize += GetAligned(sizeof(uint32_t));
+						requiredSize += sizeof(uint32_t);
 						break;
 					case ScriptField::Type::Float:
-						requiredSize += GetAligned(sizeof(float));
+						requiredSize += sizeof(float);
 						break;
 					case ScriptField::Type::Byte:
-						requiredSize += GetAligned(sizeof(int8_t));
+						requiredSize += sizeof(int8_t);
 						break;
 					case ScriptField::Type::Bool:
-						requiredSize += GetAligned(sizeof(bool));
+						requiredSize += sizeof(bool);
 						break;
 					case ScriptField::Type::Vector2:
 					{
-						requiredSize += GetAlignedOfVec2<float>();
+						requiredSize += GetPackedOfVec2<float>();
 					}
 					break;
 					case ScriptField::Type::Vector3:
 					{
-						requiredSize += GetAlignedOfVec3<float>();
+						requiredSize += GetPackedOfVec3<float>();
 					}
 					break;
 					case ScriptField::Type::Vector4:
 					{
-						requiredSize += GetAlignedOfVec4<float>();
+						requiredSize += GetPackedOfVec4<float>();
 					}
 					break;
 					case ScriptField::Type::Entity:
-						requiredSize += GetAligned(sizeof(uint64_t));
+						requiredSize += sizeof(uint64_t);
 						break;
 					}
 				}
 			}
 		}
 
-		// Allocate Size for Data
-		eInfo.DataBuffer.Allocate(requiredSize);
+		// Only the ID, Entity is created from SceneColumns
+		if (columns && requiredSize == sizeof(uint16_t) + sizeof(uint64_t))
+			return true;
+
+		// Allocate Size for Data, cleared below
+		if (arena)
+			eInfo.InitializeView(requiredSize, arena->Allocate(requiredSize));
+		else
+			eInfo.InitializeData(requiredSize);
 
 		// Set Data
 		if (eInfo.DataBuffer.As<uint8_t>())
@@ -1000,102 +1454,102 @@ namespace GE
 					// ID Component
 					{
 						uint16_t currentType = (uint16_t)ComponentType::ID;
-						WriteAligned(destination, currentType);
+						WritePacked(destination, currentType);
 
 						uint64_t uuid = scene->GetComponent<IDComponent>(entity).ID;
-						WriteAligned(destination, uuid);
+						WritePacked(destination, uuid);
 					}
 
 					// All Other Components
 					{
 						// Tag
-						if (scene->HasComponent<TagComponent>(entity))
+						if (!columns && scene->HasComponent<TagComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Tag;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							TagComponent& tc = scene->GetComponent<TagComponent>(entity);
 
-							WriteAligned<uint32_t>(destination, tc.TagID);
+							WritePacked<uint32_t>(destination, tc.TagID);
 
 						}
 
 						// Name
-						if (scene->HasComponent<NameComponent>(entity))
+						if (!columns && scene->HasComponent<NameComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Name;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							NameComponent& nc = scene->GetComponent<NameComponent>(entity);
 
 							const char* tagCStr = nc.Name.c_str();
-							WriteAlignedArray<char>(destination, tagCStr, nc.Name.size());
+							WritePackedArray<char>(destination, tagCStr, nc.Name.size());
 
 						}
 
 						// Active
-						if (scene->HasComponent<ActiveComponent>(entity))
+						if (!columns && scene->HasComponent<ActiveComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Active;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							auto& ac = scene->GetComponent<ActiveComponent>(entity);
 
-							WriteAligned<bool>(destination, ac.Active);
-							WriteAligned<bool>(destination, ac.Hidden);
+							WritePacked<bool>(destination, ac.Active);
+							WritePacked<bool>(destination, ac.Hidden);
 
 						}
 						// Relationship
-						if (scene->HasComponent<RelationshipComponent>(entity))
+						if (!columns && scene->HasComponent<RelationshipComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Relationship;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
-							WriteAligned<uint64_t>(destination, rsc.Parent);
+							WritePacked<uint64_t>(destination, rsc.Parent);
 
 							const uint64_t* data = (uint64_t*)rsc.Children.data();
-							WriteAlignedArray<uint64_t>(destination, data, rsc.Children.size());
+							WritePackedArray<uint64_t>(destination, data, rsc.Children.size());
 
 						}
 						
 						// Transform
-						if (scene->HasComponent<TransformComponent>(entity))
+						if (!columns && scene->HasComponent<TransformComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Transform;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							TransformComponent& trsc = scene->GetComponent<TransformComponent>(entity);
 
 							// Translation
 							const glm::vec3& translation = trsc.Translation;
-							WriteAlignedVec3<float>(destination, translation.x, translation.y, translation.z);
+							WritePackedVec3<float>(destination, translation.x, translation.y, translation.z);
 
 							// Rotation
-							WriteAlignedVec3<float>(destination, trsc.Rotation.x, trsc.Rotation.y, trsc.Rotation.z);
+							WritePackedVec3<float>(destination, trsc.Rotation.x, trsc.Rotation.y, trsc.Rotation.z);
 
 							// Scale
-							WriteAlignedVec3<float>(destination, trsc.Scale.x, trsc.Scale.y, trsc.Scale.z);
+							WritePackedVec3<float>(destination, trsc.Scale.x, trsc.Scale.y, trsc.Scale.z);
 							// Pivot Enum
 							const uint32_t& pivotEnum = trsc.GetPivot();
-							WriteAligned<uint32_t>(destination, pivotEnum);
+							WritePacked<uint32_t>(destination, pivotEnum);
 
 						}
 
 						// AudioSource
-						if (scene->HasComponent<AudioSourceComponent>(entity))
+						if (!columns && scene->HasComponent<AudioSourceComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::AudioSource;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							AudioSourceComponent& asc = scene->GetComponent<AudioSourceComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, asc.AssetHandle);
+							WritePacked<uint64_t>(destination, asc.AssetHandle);
 
-							WriteAligned<bool>(destination, asc.Loop);
+							WritePacked<bool>(destination, asc.Loop);
 
-							WriteAligned<float>(destination, asc.Pitch);
-							WriteAligned<float>(destination, asc.Gain);
+							WritePacked<float>(destination, asc.Pitch);
+							WritePacked<float>(destination, asc.Gain);
 
 						}
 
@@ -1103,385 +1557,384 @@ namespace GE
 						if (scene->HasComponent<AudioListenerComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::AudioListener;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							AudioListenerComponent& alc = scene->GetComponent<AudioListenerComponent>(entity);
 
 						}
 
 						// Render
-						if (scene->HasComponent<RenderComponent>(entity))
+						if (!columns && scene->HasComponent<RenderComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Render;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							auto& rc = scene->GetComponent<RenderComponent>(entity);
-							for (uint64_t id : rc.LayerIDs)
-							{
-								WriteAligned<uint64_t>(destination, id);
-							}
+							const uint64_t* data = rc.LayerIDs.data();
+							WritePackedArray<uint64_t>(destination, data, rc.LayerIDs.size());
 						}
 
 						// Camera
 						if (scene->HasComponent<CameraComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Camera;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							CameraComponent& cc = scene->GetComponent<CameraComponent>(entity);
 
-							WriteAligned<bool>(destination, cc.Primary);
-							WriteAligned<bool>(destination, cc.FixedAspectRatio);
+							WritePacked<bool>(destination, cc.Primary);
+							WritePacked<bool>(destination, cc.FixedAspectRatio);
 
 							// SceneCamera Variables
-							WriteAligned<float>(destination, cc.ActiveCamera.GetFOV());
-							WriteAligned<float>(destination, cc.ActiveCamera.GetNearClip());
-							WriteAligned<float>(destination, cc.ActiveCamera.GetFarClip());
+							WritePacked<float>(destination, cc.ActiveCamera.GetFOV());
+							WritePacked<float>(destination, cc.ActiveCamera.GetNearClip());
+							WritePacked<float>(destination, cc.ActiveCamera.GetFarClip());
 
 						}
 
 						// SpriteRenderer
-						if (scene->HasComponent<SpriteRendererComponent>(entity))
+						if (!columns && scene->HasComponent<SpriteRendererComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::SpriteRenderer;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							SpriteRendererComponent& src = scene->GetComponent<SpriteRendererComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, src.AssetHandle);
+							WritePacked<uint64_t>(destination, src.AssetHandle);
 
-							WriteAligned<float>(destination, src.TilingFactor);
+							WritePacked<float>(destination, src.TilingFactor);
 
 							// Color
-							WriteAlignedVec4<float>(destination, src.Color.a, src.Color.g, src.Color.b, src.Color.a);
+							WritePackedVec4<float>(destination, src.Color.a, src.Color.g, src.Color.b, src.Color.a);
 
+							WritePacked<bool>(destination, src.Static);
 						}
 
 						// CircleRenderer
-						if (scene->HasComponent<CircleRendererComponent>(entity))
+						if (!columns && scene->HasComponent<CircleRendererComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::CircleRenderer;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							CircleRendererComponent& crc = scene->GetComponent<CircleRendererComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, crc.AssetHandle);
+							WritePacked<uint64_t>(destination, crc.AssetHandle);
 
-							WriteAligned<float>(destination, crc.TilingFactor);
-							WriteAligned<float>(destination, crc.Radius);
-							WriteAligned<float>(destination, crc.Thickness);
-							WriteAligned<float>(destination, crc.Fade);
+							WritePacked<float>(destination, crc.TilingFactor);
+							WritePacked<float>(destination, crc.Radius);
+							WritePacked<float>(destination, crc.Thickness);
+							WritePacked<float>(destination, crc.Fade);
 
 							// Color
-							WriteAlignedVec4<float>(destination, crc.Color.a, crc.Color.g, crc.Color.b, crc.Color.a);
+							WritePackedVec4<float>(destination, crc.Color.a, crc.Color.g, crc.Color.b, crc.Color.a);
 						}
 
 						// TextRenderer
 						if (scene->HasComponent<TextRendererComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::TextRenderer;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							TextRendererComponent& trc = scene->GetComponent<TextRendererComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, trc.AssetHandle);
+							WritePacked<uint64_t>(destination, trc.AssetHandle);
 
-							WriteAligned<float>(destination, trc.KerningOffset);
-							WriteAligned<float>(destination, trc.LineHeightOffset);
+							WritePacked<float>(destination, trc.KerningOffset);
+							WritePacked<float>(destination, trc.LineHeightOffset);
 
 							// Text
 							const char* trcTextCStr = trc.Text.c_str();
-							WriteAlignedArray<char>(destination, trcTextCStr, trc.Text.size());
+							WritePackedArray<char>(destination, trcTextCStr, trc.Text.size());
 
 							// Color
-							WriteAlignedVec4<float>(destination, trc.TextColor.a, trc.TextColor.g, trc.TextColor.b, trc.TextColor.a);
+							WritePackedVec4<float>(destination, trc.TextColor.a, trc.TextColor.g, trc.TextColor.b, trc.TextColor.a);
 
-							WriteAlignedVec4<float>(destination, trc.BGColor.a, trc.BGColor.g, trc.BGColor.b, trc.BGColor.a);
+							WritePackedVec4<float>(destination, trc.BGColor.a, trc.BGColor.g, trc.BGColor.b, trc.BGColor.a);
 
-							WriteAligned<float>(destination, trc.TextScalar);
-							WriteAlignedVec2<float>(destination, trc.TextOffset.x, trc.TextOffset.y);
+							WritePacked<float>(destination, trc.TextScalar);
+							WritePackedVec2<float>(destination, trc.TextOffset.x, trc.TextOffset.y);
 						}
 
 						if (scene->HasComponent<GUICanvasComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUICanvas;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUICanvasComponent& guiCC = scene->GetComponent<GUICanvasComponent>(entity);
 
-							WriteAligned<bool>(destination, guiCC.ControlMouse);
-							WriteAligned<bool>(destination, guiCC.ShowMouse);
+							WritePacked<bool>(destination, guiCC.ControlMouse);
+							WritePacked<bool>(destination, guiCC.ShowMouse);
 
 							uint32_t mode = (uint32_t)guiCC.Mode;
-							WriteAligned<uint32_t>(destination, mode);
+							WritePacked<uint32_t>(destination, mode);
 						}
 						if (scene->HasComponent<GUILayoutComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUILayout;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUILayoutComponent& guiLOC = scene->GetComponent<GUILayoutComponent>(entity);
 
 							uint32_t mode = (uint32_t)guiLOC.Mode;
-							WriteAligned<uint32_t>(destination, mode);
+							WritePacked<uint32_t>(destination, mode);
 
-							WriteAlignedVec2<float>(destination, guiLOC.StartingOffset.x, guiLOC.StartingOffset.y);
-							WriteAlignedVec2<float>(destination, guiLOC.ChildSize.x, guiLOC.ChildSize.y);
-							WriteAlignedVec2<float>(destination, guiLOC.ChildPadding.x, guiLOC.ChildPadding.y);
+							WritePackedVec2<float>(destination, guiLOC.StartingOffset.x, guiLOC.StartingOffset.y);
+							WritePackedVec2<float>(destination, guiLOC.ChildSize.x, guiLOC.ChildSize.y);
+							WritePackedVec2<float>(destination, guiLOC.ChildPadding.x, guiLOC.ChildPadding.y);
 						}
 						// TODO : GUIMaskComponent
 						if (scene->HasComponent<GUIImageComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUILayout;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUIImageComponent& guIIC = scene->GetComponent<GUIImageComponent>(entity);
 
-							WriteAlignedVec4<float>(destination, guIIC.Color.x, guIIC.Color.y, guIIC.Color.z, guIIC.Color.w);
-							WriteAligned<UUID>(destination, guIIC.TextureHandle);
-							WriteAligned<float>(destination, guIIC.TilingFactor);
+							WritePackedVec4<float>(destination, guIIC.Color.x, guIIC.Color.y, guIIC.Color.z, guIIC.Color.w);
+							WritePacked<UUID>(destination, guIIC.TextureHandle);
+							WritePacked<float>(destination, guIIC.TilingFactor);
 						}
 						if (scene->HasComponent<GUIButtonComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUIButton;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUIButtonComponent& guiBC = scene->GetComponent<GUIButtonComponent>(entity);
 
 							// Font
-							WriteAligned<uint64_t>(destination, guiBC.FontAssetHandle);
-							WriteAligned<float>(destination, guiBC.KerningOffset);
-							WriteAligned<float>(destination, guiBC.LineHeightOffset);
+							WritePacked<uint64_t>(destination, guiBC.FontAssetHandle);
+							WritePacked<float>(destination, guiBC.KerningOffset);
+							WritePacked<float>(destination, guiBC.LineHeightOffset);
 
 							const char* trcTextCStr = guiBC.Text.c_str();
-							WriteAlignedArray<char>(destination, trcTextCStr, guiBC.Text.size());
-							WriteAlignedVec4<float>(destination, guiBC.TextColor.a, guiBC.TextColor.g, guiBC.TextColor.b, guiBC.TextColor.a);
-							WriteAlignedVec4<float>(destination, guiBC.BGColor.a, guiBC.BGColor.g, guiBC.BGColor.b, guiBC.BGColor.a);
-							WriteAligned<float>(destination, guiBC.TextScalar);
-							WriteAlignedVec2<float>(destination, guiBC.TextStartingOffset.x, guiBC.TextStartingOffset.y);
-							WriteAlignedVec2<float>(destination, guiBC.TextSize.x, guiBC.TextSize.y);
+							WritePackedArray<char>(destination, trcTextCStr, guiBC.Text.size());
+							WritePackedVec4<float>(destination, guiBC.TextColor.a, guiBC.TextColor.g, guiBC.TextColor.b, guiBC.TextColor.a);
+							WritePackedVec4<float>(destination, guiBC.BGColor.a, guiBC.BGColor.g, guiBC.BGColor.b, guiBC.BGColor.a);
+							WritePacked<float>(destination, guiBC.TextScalar);
+							WritePackedVec2<float>(destination, guiBC.TextStartingOffset.x, guiBC.TextStartingOffset.y);
+							WritePackedVec2<float>(destination, guiBC.TextSize.x, guiBC.TextSize.y);
 
 							// Textures & Colors
-							WriteAligned<uint64_t>(destination, guiBC.BackgroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.BackgroundColor.r, guiBC.BackgroundColor.g, guiBC.BackgroundColor.b, guiBC.BackgroundColor.a);
+							WritePacked<uint64_t>(destination, guiBC.BackgroundTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.BackgroundColor.r, guiBC.BackgroundColor.g, guiBC.BackgroundColor.b, guiBC.BackgroundColor.a);
 
-							WriteAligned<uint64_t>(destination, guiBC.DisabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.DisabledColor.r, guiBC.DisabledColor.g, guiBC.DisabledColor.b, guiBC.DisabledColor.a);
+							WritePacked<uint64_t>(destination, guiBC.DisabledTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.DisabledColor.r, guiBC.DisabledColor.g, guiBC.DisabledColor.b, guiBC.DisabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiBC.EnabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.EnabledColor.r, guiBC.EnabledColor.g, guiBC.EnabledColor.b, guiBC.EnabledColor.a);
+							WritePacked<uint64_t>(destination, guiBC.EnabledTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.EnabledColor.r, guiBC.EnabledColor.g, guiBC.EnabledColor.b, guiBC.EnabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiBC.HoveredTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.HoveredColor.r, guiBC.HoveredColor.g, guiBC.HoveredColor.b, guiBC.HoveredColor.a);
+							WritePacked<uint64_t>(destination, guiBC.HoveredTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.HoveredColor.r, guiBC.HoveredColor.g, guiBC.HoveredColor.b, guiBC.HoveredColor.a);
 
-							WriteAligned<uint64_t>(destination, guiBC.SelectedTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.SelectedColor.r, guiBC.SelectedColor.g, guiBC.SelectedColor.b, guiBC.SelectedColor.a);
+							WritePacked<uint64_t>(destination, guiBC.SelectedTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.SelectedColor.r, guiBC.SelectedColor.g, guiBC.SelectedColor.b, guiBC.SelectedColor.a);
 
-							WriteAligned<uint64_t>(destination, guiBC.ForegroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiBC.ForegroundColor.r, guiBC.ForegroundColor.g, guiBC.ForegroundColor.b, guiBC.ForegroundColor.a);
+							WritePacked<uint64_t>(destination, guiBC.ForegroundTextureHandle);
+							WritePackedVec4<float>(destination, guiBC.ForegroundColor.r, guiBC.ForegroundColor.g, guiBC.ForegroundColor.b, guiBC.ForegroundColor.a);
 
 						}
 						if (scene->HasComponent<GUIInputFieldComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUIInputField;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUIInputFieldComponent& guiIFC = scene->GetComponent<GUIInputFieldComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, guiIFC.FontAssetHandle);
-							WriteAligned<float>(destination, guiIFC.KerningOffset);
-							WriteAligned<float>(destination, guiIFC.LineHeightOffset);
+							WritePacked<uint64_t>(destination, guiIFC.FontAssetHandle);
+							WritePacked<float>(destination, guiIFC.KerningOffset);
+							WritePacked<float>(destination, guiIFC.LineHeightOffset);
 
 							const char* trcTextCStr = guiIFC.Text.c_str();
-							WriteAlignedArray<char>(destination, trcTextCStr, guiIFC.Text.size());
-							WriteAlignedVec4<float>(destination, guiIFC.TextColor.a, guiIFC.TextColor.g, guiIFC.TextColor.b, guiIFC.TextColor.a);
-							WriteAlignedVec4<float>(destination, guiIFC.BGColor.a, guiIFC.BGColor.g, guiIFC.BGColor.b, guiIFC.BGColor.a);
-							WriteAligned<float>(destination, guiIFC.TextScalar);
-							WriteAlignedVec2<float>(destination, guiIFC.TextStartingOffset.x, guiIFC.TextStartingOffset.y);
-							WriteAlignedVec2<float>(destination, guiIFC.TextSize.x, guiIFC.TextSize.y);
-							WriteAlignedVec2<float>(destination, guiIFC.Padding.x, guiIFC.Padding.y);
+							WritePackedArray<char>(destination, trcTextCStr, guiIFC.Text.size());
+							WritePackedVec4<float>(destination, guiIFC.TextColor.a, guiIFC.TextColor.g, guiIFC.TextColor.b, guiIFC.TextColor.a);
+							WritePackedVec4<float>(destination, guiIFC.BGColor.a, guiIFC.BGColor.g, guiIFC.BGColor.b, guiIFC.BGColor.a);
+							WritePacked<float>(destination, guiIFC.TextScalar);
+							WritePackedVec2<float>(destination, guiIFC.TextStartingOffset.x, guiIFC.TextStartingOffset.y);
+							WritePackedVec2<float>(destination, guiIFC.TextSize.x, guiIFC.TextSize.y);
+							WritePackedVec2<float>(destination, guiIFC.Padding.x, guiIFC.Padding.y);
 
 						}
 						if (scene->HasComponent<GUISliderComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUISlider;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUISliderComponent& guiSC = scene->GetComponent<GUISliderComponent>(entity);
 
 							uint32_t direction = (uint32_t)guiSC.Direction;
-							WriteAligned<uint32_t>(destination, direction);
-							WriteAligned<float>(destination, guiSC.Fill);
+							WritePacked<uint32_t>(destination, direction);
+							WritePacked<float>(destination, guiSC.Fill);
 
-							WriteAligned<uint64_t>(destination, guiSC.BackgroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.BackgroundColor.r, guiSC.BackgroundColor.g, guiSC.BackgroundColor.b, guiSC.BackgroundColor.a);
+							WritePacked<uint64_t>(destination, guiSC.BackgroundTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.BackgroundColor.r, guiSC.BackgroundColor.g, guiSC.BackgroundColor.b, guiSC.BackgroundColor.a);
 
-							WriteAligned<uint64_t>(destination, guiSC.DisabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.DisabledColor.r, guiSC.DisabledColor.g, guiSC.DisabledColor.b, guiSC.DisabledColor.a);
+							WritePacked<uint64_t>(destination, guiSC.DisabledTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.DisabledColor.r, guiSC.DisabledColor.g, guiSC.DisabledColor.b, guiSC.DisabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiSC.EnabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.EnabledColor.r, guiSC.EnabledColor.g, guiSC.EnabledColor.b, guiSC.EnabledColor.a);
+							WritePacked<uint64_t>(destination, guiSC.EnabledTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.EnabledColor.r, guiSC.EnabledColor.g, guiSC.EnabledColor.b, guiSC.EnabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiSC.HoveredTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.HoveredColor.r, guiSC.HoveredColor.g, guiSC.HoveredColor.b, guiSC.HoveredColor.a);
+							WritePacked<uint64_t>(destination, guiSC.HoveredTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.HoveredColor.r, guiSC.HoveredColor.g, guiSC.HoveredColor.b, guiSC.HoveredColor.a);
 
-							WriteAligned<uint64_t>(destination, guiSC.SelectedTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.SelectedColor.r, guiSC.SelectedColor.g, guiSC.SelectedColor.b, guiSC.SelectedColor.a);
+							WritePacked<uint64_t>(destination, guiSC.SelectedTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.SelectedColor.r, guiSC.SelectedColor.g, guiSC.SelectedColor.b, guiSC.SelectedColor.a);
 
-							WriteAligned<uint64_t>(destination, guiSC.ForegroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiSC.ForegroundColor.r, guiSC.ForegroundColor.g, guiSC.ForegroundColor.b, guiSC.ForegroundColor.a);
+							WritePacked<uint64_t>(destination, guiSC.ForegroundTextureHandle);
+							WritePackedVec4<float>(destination, guiSC.ForegroundColor.r, guiSC.ForegroundColor.g, guiSC.ForegroundColor.b, guiSC.ForegroundColor.a);
 
 						}
 						if (scene->HasComponent<GUICheckboxComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::GUICheckbox;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							GUICheckboxComponent& guiCBC = scene->GetComponent<GUICheckboxComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, guiCBC.BackgroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.BackgroundColor.r, guiCBC.BackgroundColor.g, guiCBC.BackgroundColor.b, guiCBC.BackgroundColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.BackgroundTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.BackgroundColor.r, guiCBC.BackgroundColor.g, guiCBC.BackgroundColor.b, guiCBC.BackgroundColor.a);
 
-							WriteAligned<uint64_t>(destination, guiCBC.DisabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.DisabledColor.r, guiCBC.DisabledColor.g, guiCBC.DisabledColor.b, guiCBC.DisabledColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.DisabledTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.DisabledColor.r, guiCBC.DisabledColor.g, guiCBC.DisabledColor.b, guiCBC.DisabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiCBC.EnabledTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.EnabledColor.r, guiCBC.EnabledColor.g, guiCBC.EnabledColor.b, guiCBC.EnabledColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.EnabledTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.EnabledColor.r, guiCBC.EnabledColor.g, guiCBC.EnabledColor.b, guiCBC.EnabledColor.a);
 
-							WriteAligned<uint64_t>(destination, guiCBC.HoveredTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.HoveredColor.r, guiCBC.HoveredColor.g, guiCBC.HoveredColor.b, guiCBC.HoveredColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.HoveredTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.HoveredColor.r, guiCBC.HoveredColor.g, guiCBC.HoveredColor.b, guiCBC.HoveredColor.a);
 
-							WriteAligned<uint64_t>(destination, guiCBC.SelectedTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.SelectedColor.r, guiCBC.SelectedColor.g, guiCBC.SelectedColor.b, guiCBC.SelectedColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.SelectedTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.SelectedColor.r, guiCBC.SelectedColor.g, guiCBC.SelectedColor.b, guiCBC.SelectedColor.a);
 
-							WriteAligned<uint64_t>(destination, guiCBC.ForegroundTextureHandle);
-							WriteAlignedVec4<float>(destination, guiCBC.ForegroundColor.r, guiCBC.ForegroundColor.g, guiCBC.ForegroundColor.b, guiCBC.ForegroundColor.a);
+							WritePacked<uint64_t>(destination, guiCBC.ForegroundTextureHandle);
+							WritePackedVec4<float>(destination, guiCBC.ForegroundColor.r, guiCBC.ForegroundColor.g, guiCBC.ForegroundColor.b, guiCBC.ForegroundColor.a);
 
 						}
 
 						// TODO : GUIScrollRectComponent & GUIScrollbarComponent
 
 						// Rigidbody2D
-						if (scene->HasComponent<Rigidbody2DComponent>(entity))
+						if (!columns && scene->HasComponent<Rigidbody2DComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Rigidbody2D;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							Rigidbody2DComponent& rb2D = scene->GetComponent<Rigidbody2DComponent>(entity);
 
 							uint16_t typeInt = (uint16_t)rb2D.Type;
-							WriteAligned<uint16_t>(destination, typeInt);
+							WritePacked<uint16_t>(destination, typeInt);
 
-							WriteAligned<bool>(destination, rb2D.FixedRotation);
+							WritePacked<bool>(destination, rb2D.FixedRotation);
 						}
 
 						// BoxCollider2D
-						if (scene->HasComponent<BoxCollider2DComponent>(entity))
+						if (!columns && scene->HasComponent<BoxCollider2DComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::BoxCollider2D;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							BoxCollider2DComponent& bc2d = scene->GetComponent<BoxCollider2DComponent>(entity);
 
-							WriteAligned<bool>(destination, bc2d.Show);
+							WritePacked<bool>(destination, bc2d.Show);
 
-							WriteAligned<float>(destination, bc2d.Density);
-							WriteAligned<float>(destination, bc2d.Friction);
-							WriteAligned<float>(destination, bc2d.Restitution);
-							WriteAligned<float>(destination, bc2d.RestitutionThreshold);
+							WritePacked<float>(destination, bc2d.Density);
+							WritePacked<float>(destination, bc2d.Friction);
+							WritePacked<float>(destination, bc2d.Restitution);
+							WritePacked<float>(destination, bc2d.RestitutionThreshold);
 
 							// Offset
-							WriteAlignedVec2<float>(destination, bc2d.Offset.x, bc2d.Offset.y);
+							WritePackedVec2<float>(destination, bc2d.Offset.x, bc2d.Offset.y);
 
 							// Size
-							WriteAlignedVec2<float>(destination, bc2d.Size.x, bc2d.Size.y);
+							WritePackedVec2<float>(destination, bc2d.Size.x, bc2d.Size.y);
 
 						}
 
 						// CircleCollider2D
-						if (scene->HasComponent<CircleCollider2DComponent>(entity))
+						if (!columns && scene->HasComponent<CircleCollider2DComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::CircleCollider2D;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							CircleCollider2DComponent& cc2d = scene->GetComponent<CircleCollider2DComponent>(entity);
 
-							WriteAligned<bool>(destination, cc2d.Show);
+							WritePacked<bool>(destination, cc2d.Show);
 
-							WriteAligned<float>(destination, cc2d.Density);
-							WriteAligned<float>(destination, cc2d.Friction);
-							WriteAligned<float>(destination, cc2d.Restitution);
-							WriteAligned<float>(destination, cc2d.RestitutionThreshold);
-							WriteAligned<float>(destination, cc2d.Radius);
-							WriteAlignedVec2<float>(destination, cc2d.Offset.x, cc2d.Offset.y);
+							WritePacked<float>(destination, cc2d.Density);
+							WritePacked<float>(destination, cc2d.Friction);
+							WritePacked<float>(destination, cc2d.Restitution);
+							WritePacked<float>(destination, cc2d.RestitutionThreshold);
+							WritePacked<float>(destination, cc2d.Radius);
+							WritePackedVec2<float>(destination, cc2d.Offset.x, cc2d.Offset.y);
 						}
 
 						// NativeScript
 						if (scene->HasComponent<NativeScriptComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::NativeScript;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 						}
 
 						// Script
 						if (scene->HasComponent<ScriptComponent>(entity))
 						{
 							uint16_t currentType = (uint16_t)ComponentType::Script;
-							WriteAligned(destination, currentType);
+							WritePacked(destination, currentType);
 
 							ScriptComponent& sc = scene->GetComponent<ScriptComponent>(entity);
 
-							WriteAligned<uint64_t>(destination, sc.AssetHandle);
+							WritePacked<uint64_t>(destination, sc.AssetHandle);
 
 							// Field Name, Type & Data
 							const ScriptFieldMap& fields = Scripting::GetEntityFields(scene->GetComponent<IDComponent>(entity).ID);
-							WriteAligned<uint64_t>(destination, fields.size());
+							WriteVarint(destination, fields.size());
 							for (const auto& [name, field] : fields)
 							{
 								const char* fieldName = name.c_str();
-								WriteAlignedArray<char>(destination, fieldName, name.size());
+								WritePackedArray<char>(destination, fieldName, name.size());
 								const uint32_t type = (uint32_t)field.GetType();
-								WriteAligned<uint32_t>(destination, type);
+								WritePacked<uint32_t>(destination, type);
 								switch (field.GetType())
 								{
 								case ScriptField::Type::Char:
-									WriteAligned<char>(destination, field.GetValue<char>());
+									WritePacked<char>(destination, field.GetValue<char>());
 									break;
 								case ScriptField::Type::Int:
-									WriteAligned<int>(destination, field.GetValue<int>());
+									WritePacked<int>(destination, field.GetValue<int>());
 									break;
 								case ScriptField::Type::UInt:
-									WriteAligned<uint32_t>(destination, field.GetValue<uint32_t>());
+									WritePacked<uint32_t>(destination, field.GetValue<uint32_t>());
 									break;
 								case ScriptField::Type::Float:
-									WriteAligned<float>(destination, field.GetValue<float>());
+									WritePacked<float>(destination, field.GetValue<float>());
 									break;
 								case ScriptField::Type::Byte:
-									WriteAligned<uint8_t>(destination, field.GetValue<uint8_t>());
+									WritePacked<uint8_t>(destination, field.GetValue<uint8_t>());
 									break;
 								case ScriptField::Type::Bool:
-									WriteAligned<bool>(destination, field.GetValue<bool>());
+									WritePacked<bool>(destination, field.GetValue<bool>());
 									break;
 								case ScriptField::Type::Vector2:
 								{
 									const glm::vec2 data = field.GetValue<glm::vec2>();
-									WriteAlignedVec2<float>(destination, data.x, data.y);
+									WritePackedVec2<float>(destination, data.x, data.y);
 								}
 									break;
 								case ScriptField::Type::Vector3:
 								{
 									const glm::vec3 data = field.GetValue<glm::vec3>();
-									WriteAlignedVec3<float>(destination, data.x, data.y, data.z);
+									WritePackedVec3<float>(destination, data.x, data.y, data.z);
 								}
 									break;
 								case ScriptField::Type::Vector4:
 								{
 									const glm::vec4 data = field.GetValue<glm::vec4>();
-									WriteAlignedVec4<float>(destination, data.x, data.y, data.z, data.w);
+									WritePackedVec4<float>(destination, data.x, data.y, data.z, data.w);
 								}
 									break;
 								case ScriptField::Type::Entity:
-									WriteAligned<uint64_t>(destination, field.GetValue<uint64_t>());
+									WritePacked<uint64_t>(destination, field.GetValue<uint64_t>());
 									break;
 								}
 							}
@@ -1607,6 +2060,13 @@ namespace GE
 		* * ~ FontAtlasBuffer : Texture2D Buffer
 		* * * * - Size
 		* * * * - Data
+		* ~ GlyphTable : Baked at pack time, no msdfgen at runtime
+		* * - AscenderY : float
+		* * - DescenderY : float
+		* * - LineHeight : float
+		* * ~ Glyphs : Font::Glyph array, sorted by Codepoint
+		* * ~ Kerning : Font::KerningPair array, sorted by Codepoints
+		* ~ Source : Font file data for GlyphCache, may be empty
 		*/
 
 		Ref<Font> font = Project::GetAssetAs<Font>(asset);
@@ -1619,6 +2079,13 @@ namespace GE
 			return false;
 		}
 
+		const Font::GlyphTable& glyphTable = font->GetGlyphTable();
+		if (glyphTable.IsEmpty())
+		{
+			GE_CORE_ERROR("Cannot Serialize Font Asset that does not have Glyphs");
+			return false;
+		}
+
 		uint64_t requiredSize = 0;
 
 		// Size
@@ -1636,6 +2103,15 @@ namespace GE
 
 			// Special case for Font Atlas Texture Size & Data. Not handled with SerializeAsset(Ref<Asset>, AssetInfo&)
 			requiredSize += GetAlignedOfArray<uint8_t>(atlasTexture->GetConfig().TextureBuffer.GetSize());
+
+			// Glyph Table
+			requiredSize += GetAligned(sizeof(float))		// AscenderY
+				+ GetAligned(sizeof(float))					// DescenderY
+				+ GetAligned(sizeof(float))					// LineHeight
+				+ GetAlignedOfArray<Font::Glyph>(glyphTable.Glyphs.size())
+				+ GetAlignedOfArray<Font::KerningPair>(glyphTable.Kerning.size());
+
+			requiredSize += GetAlignedOfArray<uint8_t>(font->GetSource().GetSize());
 		}
 
 		// Allocate Size for Data
@@ -1675,6 +2151,25 @@ namespace GE
 					WriteAlignedArray<uint8_t>(destination, data, atlasTexture->GetConfig().TextureBuffer.GetSize());
 				}
 
+				// Glyph Table
+				{
+					WriteAligned<float>(destination, glyphTable.FontMetrics.AscenderY);
+					WriteAligned<float>(destination, glyphTable.FontMetrics.DescenderY);
+					WriteAligned<float>(destination, glyphTable.FontMetrics.LineHeight);
+
+					const Font::Glyph* glyphs = glyphTable.Glyphs.data();
+					WriteAlignedArray<Font::Glyph>(destination, glyphs, glyphTable.Glyphs.size());
+					const Font::KerningPair* kerning = glyphTable.Kerning.data();
+					WriteAlignedArray<Font::KerningPair>(destination, kerning, glyphTable.Kerning.size());
+				}
+
+				// Source
+				{
+					const Buffer& source = font->GetSource();
+					const uint8_t* data = source.As<uint8_t>();
+					WriteAlignedArray<uint8_t>(destination, data, source.GetSize());
+				}
+
 				if (destination - assetInfo.DataBuffer.As<uint8_t>() == requiredSize)
 				{
 					GE_CORE_INFO("RuntimeAssetManager::SerializeFont() Successful.");
@@ -1862,15 +2357,222 @@ namespace GE
 		return true;
 	}
 
-	Ref<Asset> RuntimeAssetManager::DeserializeScene(const AssetInfo& assetInfo)
+	bool RuntimeAssetManager::SerializePrefab(Ref<Asset> asset, AssetInfo& assetInfo)
 	{
+		// PrefabPackFormat
+		//	[8] Handle
+		//	[8] Type
+		//	[8] Entity Count
+		//	[?] EntityInfo		// Unaligned, root first & parents before children. See Prefab::Resolve()
+		//		[1-10] Packed Size
+		//		[?] Packed Data : See SerializeEntity()
+
+		Ref<Prefab> prefab = Project::GetAssetAs<Prefab>(asset);
+		if (!prefab || !prefab->GetEntityCount())
+			return false;
+		assetInfo.Type = 6; // See Asset::Type::Prefab
+
+		Ref<Scene> prefabTemplate = prefab->GetTemplate();
+		const std::vector<Entity> entities = prefab->GetEntities();
+		// Entity data is only needed until written below, freed together
+		BufferArena entityArena = BufferArena();
+		std::vector<SceneInfo::EntityInfo> entityInfos = std::vector<SceneInfo::EntityInfo>(entities.size());
+		uint64_t requiredSize = 0;
+
+		// Size
+		{
+			requiredSize = GetAligned(sizeof(uint64_t)) // Handle
+				+ GetAligned(sizeof(uint16_t))	// Type
+				+ GetAligned(sizeof(uint64_t)); // Entity Count
+
+			for (uint64_t i = 0; i < entities.size(); i++)
+			{
+				if (!SerializeEntity(prefabTemplate, entityInfos[i], entities[i], &entityArena))
+					return false;
+				requiredSize += GetPackedOfArray<uint8_t>(entityInfos[i].DataBuffer.GetSize());
+			}
+		}
+
+		// Allocate Size for Data
+		assetInfo.InitializeData(requiredSize);
+
+		// Data
 		if (assetInfo.DataBuffer)
+		{
+			if (assetInfo.DataBuffer.GetSize() >= requiredSize)
+			{
+				// Start at beginning of buffer
+				uint8_t* destination = assetInfo.DataBuffer.As<uint8_t>();
+
+				// Clear requiredSize from destination
+				memset(destination, 0, requiredSize);
+
+				// Fill out buffer
+				{
+					WriteAligned<uint64_t>(destination, prefab->GetHandle());
+					WriteAligned<uint16_t>(destination, (uint16_t)prefab->GetType());
+
+					WriteAligned<uint64_t>(destination, entityInfos.size());
+					for (const SceneInfo::EntityInfo& eInfo : entityInfos)
+					{
+						const uint8_t* data = eInfo.DataBuffer.As<uint8_t>();
+						WritePackedArray<uint8_t>(destination, data, eInfo.DataBuffer.GetSize());
+					}
+				}
+
+				if (destination - assetInfo.DataBuffer.As<uint8_t>() == requiredSize)
+				{
+					GE_CORE_INFO("RuntimeAssetManager::SerializePrefab() Successful.\n\tEntities : {0}\n\tSize : {1} bytes", entityInfos.size(), requiredSize);
+					return true;
+				}
+				else
+				{
+					GE_CORE_ASSERT(false, "Buffer overflow.");
+				}
+			}
+			else
+			{
+				GE_CORE_ERROR("RuntimeAssetManager::SerializePrefab() Failed.\n\tRequired size is larger than given buffer size.");
+			}
+		}
+
+		return false;
+	}
+
+	bool RuntimeAssetManager::EncodeScene(Ref<Scene> scene, ScopedBuffer& outData)
+	{
+		// SceneCacheFormat
+		//	[8 + ?] Columns			// See SceneColumns, Count is 0 if disabled
+		//	[8] Entity Count
+		//	[?] EntityInfo			// Unaligned, Entities holding only columnar Components have none
+		//		[1-10] Packed Size
+		//		[?] Packed Data : See SerializeEntity()
+
+		GE_PROFILE_FUNCTION();
+
+		if (!scene)
+			return false;
+
+		// Entity data is only needed until written below, freed together
+		BufferArena entityArena = BufferArena();
+		const SceneColumns sceneColumns = m_ColumnarScenes ? SceneColumns(scene) : SceneColumns(nullptr);
+		const bool columns = sceneColumns.GetEntityCount() > 0;
+
+		std::vector<Entity> entities = scene->GetAllEntitiesWith<IDComponent>();
+		std::vector<SceneInfo::EntityInfo> entityInfos = std::vector<SceneInfo::EntityInfo>(entities.size());
+		uint64_t entityCount = 0;
+		uint64_t requiredSize = sceneColumns.GetSize() + GetAligned(sizeof(uint64_t));
+		for (uint64_t i = 0; i < entities.size(); i++)
+		{
+			// Every Component is in a column if left empty
+			if (!SerializeEntity(scene, entityInfos[i], entities[i], &entityArena, columns) || !entityInfos[i].DataBuffer)
+				continue;
+
+			requiredSize += GetPackedOfArray<uint8_t>(entityInfos[i].DataBuffer.GetSize());
+			entityCount++;
+		}
+
+		outData.Allocate(requiredSize);
+		if (!outData)
+			return false;
+
+		uint8_t* destination = outData.As<uint8_t>();
+		memset(destination, 0, requiredSize);
+
+		sceneColumns.Write(destination);
+		WriteAligned<uint64_t>(destination, entityCount);
+		for (const SceneInfo::EntityInfo& eInfo : entityInfos)
+		{
+			if (!eInfo.DataBuffer)
+				continue;
+
+			const uint8_t* data = eInfo.DataBuffer.As<uint8_t>();
+			WritePackedArray<uint8_t>(destination, data, eInfo.DataBuffer.GetSize());
+		}
+
+		if (destination - outData.As<uint8_t>() != requiredSize)
+		{
+			GE_CORE_ASSERT(false, "Buffer overflow.");
+			outData.Release();
+			return false;
+		}
+		return true;
+	}
+
+	Ref<Scene> RuntimeAssetManager::DecodeScene(UUID handle, const uint8_t* data, uint64_t size)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!data || !size)
+			return nullptr;
+
+		// See EncodeScene()
+		const uint8_t* source = data;
+		const uint8_t* end = data + size;
+		Ref<Scene> scene = CreateRef<Scene>(handle);
+
+		uint64_t columnEntityCount = 0;
+		if (!SceneColumns::Read(scene, source, end, columnEntityCount))
+		{
+			GE_CORE_ERROR("RuntimeAssetManager::DecodeScene() Could not read Scene Columns.");
+			return nullptr;
+		}
+
+		// Entities with columns already exist, looked up once
+		std::unordered_map<uint64_t, Entity> entityMap = std::unordered_map<uint64_t, Entity>();
+		if (columnEntityCount)
+		{
+			std::vector<Entity> entities = scene->GetAllEntitiesWith<IDComponent>();
+			entityMap.reserve(entities.size());
+			for (Entity entity : entities)
+				entityMap.emplace(scene->GetComponent<IDComponent>(entity).ID, entity);
+		}
+
+		uint64_t eCount = 0;
+		if (!ReadAligned(source, end, eCount))
+			return nullptr;
+
+		BufferReader reader = BufferReader(source, end, true);
+		for (uint64_t i = 0; i < eCount; i++)
+		{
+			uint64_t eSize = 0;
+			Buffer eDataBuffer = Buffer();
+			if (!reader.ReadSize(eSize) || !reader.ReadView(eDataBuffer, eSize))
+				return nullptr;
+
+			// Component Type : IDComponent(1) expected
+			const uint8_t* entitySource = eDataBuffer.As<uint8_t>();
+			BufferReader entityReader = BufferReader(entitySource, entitySource + eDataBuffer.GetSize(), true);
+			uint16_t cType = 0;
+			uint64_t uuid = 0;
+			if (!entityReader.Read(cType) || cType != (uint16_t)ComponentType::ID || !entityReader.Read(uuid))
+				return nullptr;
+
+			Entity entity = Entity();
+			auto it = entityMap.find(uuid);
+			if (it != entityMap.end())
+				entity = it->second;
+			else
+				entity = scene->CreateEntityWithUUID(uuid, "Deserialized Entity", 0);
+
+			// Views data, no copy
+			SceneInfo::EntityInfo eInfo = SceneInfo::EntityInfo();
+			eInfo.InitializeView(eDataBuffer.GetSize(), eDataBuffer.As<uint8_t>());
+			if (!DeserializeEntity(scene, eInfo, entity))
+				scene->DestroyEntity(entity);
+		}
+		return scene;
+	}
+
+	Ref<Asset> RuntimeAssetManager::DeserializeScene(const AssetInfo& assetInfo)
+	{
+		if (!assetInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Scene from AssetPack.\n\tAssetInfo has no Data");
 			return nullptr;
 		}
 
-		// ScenePackFormat
+		// ScenePackFormat, Version 1. See SerializeScene() for Version 2
 		//      [84 + ?] SceneInfo  : Value, corresponding Key handled in SerializePack
 		//          [8] Packed Size : Size of whole Scene
 		//			[76 + ?] Data
@@ -1917,90 +2619,114 @@ namespace GE
 		// Assets
 		uint64_t assetCount = 0;
 		ReadAligned(source, end, assetCount);
-		for (int i = 0; i < assetCount; i++)
+		if (m_AssetPack->m_File.FileHeader.Version >= 2)
 		{
-			// Get Data from source. Will put source pointer at the end of assetData[i], don't use source again till next iteration
-			uint64_t size = 0;
-			// Read size of array first
-			if (!ReadAligned(source, end, size))
-				return nullptr;
-			uint8_t* data = new uint8_t[size];
-			if (!ReadAlignedArray<uint8_t>(source, end, data, size))
-				return nullptr;
-
-			Buffer cadBuffer = Buffer(data, size);
-			delete[] data;
-
-			// Overflow check
-			if (source > end)
-				GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeScene(AssetInfo&) Buffer Overflow");
-
-			// Set Data
+			// Referenced by handle, payloads are shared. See AssetPack::File::TableOfContents
+			const std::unordered_map<uint64_t, AssetInfo>& sharedAssets = m_AssetPack->m_File.Assets;
+			for (uint64_t i = 0; i < assetCount; i++)
 			{
-				const uint8_t* childSource = cadBuffer.As<uint8_t>();
-				const uint8_t* endCAD = childSource + cadBuffer.GetSize();
-
-				// UUID
 				uint64_t uuid = 0;
-				if (!ReadAligned(childSource, endCAD, uuid))
+				if (!ReadPacked(source, end, uuid))
 					return nullptr;
 
-				// Type
-				uint16_t type = 0;
-				if (!ReadAligned(childSource, endCAD, type))
+				auto it = sharedAssets.find(uuid);
+				if (it != sharedAssets.end())
+					((SceneInfo&)assetInfo).Assets.emplace(uuid, it->second);
+				else
+					GE_CORE_WARN("RuntimeAssetManager::DeserializeScene(AssetInfo&) Asset missing from Table of Contents.");
+			}
+			source += GetAligned(assetCount * sizeof(uint64_t)) - assetCount * sizeof(uint64_t);
+		}
+		else
+		{
+			for (int i = 0; i < assetCount; i++)
+			{
+				// Get Data from source. Will put source pointer at the end of assetData[i], don't use source again till next iteration
+				uint64_t size = 0;
+				// Read size of array first
+				if (!ReadAligned(source, end, size))
 					return nullptr;
+				// Views assetInfo, no copy
+				Buffer cadBuffer = Buffer();
+				if (!ReadAlignedView(source, end, cadBuffer, size))
+					return nullptr;
+
+				// Overflow check
+				if (source > end)
+					GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeScene(AssetInfo&) Buffer Overflow");
+
+				// Set Data
+				{
+					const uint8_t* childSource = cadBuffer.As<uint8_t>();
+					const uint8_t* endCAD = childSource + cadBuffer.GetSize();
+
+					// UUID
+					uint64_t uuid = 0;
+					if (!ReadAligned(childSource, endCAD, uuid))
+						return nullptr;
+
+					// Type
+					uint16_t type = 0;
+					if (!ReadAligned(childSource, endCAD, type))
+						return nullptr;
 
-				((SceneInfo&)assetInfo).Assets[uuid].Type = type;
-				((SceneInfo&)assetInfo).Assets.at(uuid).InitializeData(cadBuffer.GetSize(), cadBuffer.As<uint8_t>());
+					((SceneInfo&)assetInfo).Assets[uuid].Type = type;
+					((SceneInfo&)assetInfo).Assets.at(uuid).InitializeView(cadBuffer.GetSize(), cadBuffer.As<uint8_t>());
 
+				}
 			}
+		}
 
-			cadBuffer.Release();
+		// Version 5 creates Entities from columns, see SceneColumns
+		uint64_t columnEntityCount = 0;
+		if (m_AssetPack->m_File.FileHeader.Version >= 5 && !SceneColumns::Read(scene, source, end, columnEntityCount))
+		{
+			GE_CORE_ERROR("RuntimeAssetManager::DeserializeScene(AssetInfo&) Could not read Scene Columns.");
+			return nullptr;
 		}
+		((SceneInfo&)assetInfo).ColumnEntityCount = columnEntityCount;
 
 		// Entities
 		uint64_t eCount = 0;
 		ReadAligned(source, end, eCount);
+		// Version 3 packs Entities, see SerializeScene()
+		const bool packed = m_AssetPack->m_File.FileHeader.Version >= 3;
+		BufferReader reader = BufferReader(source, end, packed);
 		for (int i = 0; i < eCount; i++)
 		{
 			// Get
 			uint64_t size = 0;
 			// Read size of array first
-			if (!ReadAligned(source, end, size))
+			if (!reader.ReadSize(size))
 				return nullptr;
-			uint8_t* data = new uint8_t[size];
-			if (!ReadAlignedArray<uint8_t>(source, end, data, size))
+			// Views assetInfo, no copy
+			Buffer eDataBuffer = Buffer();
+			if (!reader.ReadView(eDataBuffer, size))
 				return nullptr;
 
-			Buffer eDataBuffer = Buffer(data, size);
-			delete[] data;
-
-			// Overflow check
-			if (source > end)
-				GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeScene(AssetInfo&) Buffer Overflow");
-
 			// Set
 			{
 				const uint8_t* entitySource = eDataBuffer.As<uint8_t>();
-				const uint8_t* endED = entitySource + eDataBuffer.GetSize();
+				BufferReader entityReader = BufferReader(entitySource, entitySource + eDataBuffer.GetSize(), packed);
 
 				// Component Type : IDComponent(1) expected
 				uint16_t cType = 0;
-				if (!ReadAligned(entitySource, endED, cType))
+				if (!entityReader.Read(cType))
 					return nullptr;
 
 				if (cType == (uint16_t)ComponentType::ID)
 				{
 					// UUID
 					uint64_t uuid = 0;
-					if (!ReadAligned(entitySource, endED, uuid))
+					if (!entityReader.Read(uuid))
 						return nullptr;
 
-					scene->CreateEntityWithUUID(uuid, "Deserialized Entity", 0);
-					((SceneInfo&)assetInfo).Entities[uuid].InitializeData(eDataBuffer.GetSize(), eDataBuffer.As<uint8_t>());
+					// Already created with its columnar Components
+					if (!columnEntityCount)
+						scene->CreateEntityWithUUID(uuid, "Deserialized Entity", 0);
+					((SceneInfo&)assetInfo).Entities[uuid].InitializeView(eDataBuffer.GetSize(), eDataBuffer.As<uint8_t>());
 				}
 			}
-			eDataBuffer.Release();
 		}
 
 		GE_CORE_INFO("RuntimeAssetManager::DeserializeScene(AssetInfo&) Successful");
@@ -2009,20 +2735,21 @@ namespace GE
 
 	bool RuntimeAssetManager::DeserializeEntity(Ref<Scene> scene, const SceneInfo::EntityInfo& eInfo, Entity& entity)
 	{
-		if (eInfo.DataBuffer)
+		if (!eInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Entity from AssetPack.\n\tEntityInfo has no Data");
 			return false;
 		}
 
 		// Read Data & Assign
+		// Version 3 packs Entities, see SerializeEntity()
 		const uint8_t* source = eInfo.DataBuffer.As<uint8_t>();
-		const uint8_t* end = source + eInfo.DataBuffer.GetSize();
+		BufferReader reader = BufferReader(source, source + eInfo.DataBuffer.GetSize(), m_AssetPack->m_File.FileHeader.Version >= 3);
 
-		while (source < end)
+		while (!reader.IsEnd())
 		{
 			uint16_t currentType = 0;
-			if (ReadAligned<uint16_t>(source, end, currentType))
+			if (reader.Read<uint16_t>(currentType))
 			{
 				ComponentType type = (ComponentType)currentType;
 				switch (type)
@@ -2035,24 +2762,24 @@ namespace GE
 				case ComponentType::ID: // ID
 				{
 					uint64_t uuid = 0;
-					if (ReadAligned<uint64_t>(source, end, uuid))
+					if (reader.Read<uint64_t>(uuid))
 						scene->GetOrAddComponent<IDComponent>(entity).ID = uuid;
 				}
 				break;
 				case ComponentType::Tag: // Tag
 				{
 					uint32_t tag = 0;
-					if (ReadAligned(source, end, tag))
+					if (reader.Read(tag))
 						scene->GetOrAddComponent<TagComponent>(entity).TagID = tag;
 				}
 				break;
 				case ComponentType::Name: // Name
 				{
 					uint64_t nameStringSize = 0;
-					if (!ReadAligned(source, end, nameStringSize))
+					if (!reader.ReadSize(nameStringSize))
 						break;
 					char* tagCStr = new char[nameStringSize];
-					if (ReadAlignedArray<char>(source, end, tagCStr, nameStringSize))
+					if (reader.ReadArray<char>(tagCStr, nameStringSize))
 						scene->GetOrAddComponent<NameComponent>(entity).Name.assign(tagCStr, nameStringSize);
 					delete[](tagCStr);
 				}
@@ -2061,11 +2788,11 @@ namespace GE
 				{
 					auto& ac = scene->GetOrAddComponent<ActiveComponent>(entity);
 					bool active = true;
-					if (ReadAligned<bool>(source, end, active))
+					if (reader.Read<bool>(active))
 						ac.Active = active;
 
 					bool hidden = false;
-					if (ReadAligned<bool>(source, end, hidden))
+					if (reader.Read<bool>(hidden))
 						ac.Hidden = hidden;
 				}
 					break;
@@ -2074,14 +2801,14 @@ namespace GE
 					auto& idc = scene->GetComponent<IDComponent>(entity);
 					auto& rsc = scene->GetOrAddComponent<RelationshipComponent>(entity);
 					uint64_t parentID = idc.ID;
-					if (ReadAligned<uint64_t>(source, end, parentID))
+					if (reader.Read<uint64_t>(parentID))
 						rsc.Parent = parentID;
 
 					uint64_t numChildren = 0;
-					if (!ReadAligned(source, end, numChildren))
+					if (!reader.ReadSize(numChildren))
 						break;
 					uint64_t* children = new uint64_t[numChildren];
-					if (ReadAlignedArray<uint64_t>(source, end, children, numChildren))
+					if (reader.ReadArray<uint64_t>(children, numChildren))
 					{
 						for (uint64_t i = 0; i < numChildren; i++)
 						{
@@ -2095,22 +2822,22 @@ namespace GE
 				{
 					TransformComponent& trsc = scene->GetOrAddComponent<TransformComponent>(entity);
 					glm::vec3& translation = trsc.Translation;
-					if (!ReadAlignedVec3<float>(source, end, translation.x, translation.y, translation.z))
+					if (!reader.ReadVec3<float>(translation.x, translation.y, translation.z))
 					{
 						GE_CORE_ERROR("Failed to read Entity TransformComponent Translation.");
 					}
 
-					if (!ReadAlignedVec3<float>(source, end, trsc.Rotation.x, trsc.Rotation.y, trsc.Rotation.z))
+					if (!reader.ReadVec3<float>(trsc.Rotation.x, trsc.Rotation.y, trsc.Rotation.z))
 					{
 						GE_CORE_ERROR("Failed to read Entity TransformComponent Rotation.");
 					}
 
-					if (!ReadAlignedVec3<float>(source, end, trsc.Scale.x, trsc.Scale.y, trsc.Scale.z))
+					if (!reader.ReadVec3<float>(trsc.Scale.x, trsc.Scale.y, trsc.Scale.z))
 					{
 						GE_CORE_ERROR("Failed to read Entity TransformComponent ChildSize.");
 					}
 					uint32_t pivotEnum = 0;
-					if (!ReadAligned<uint32_t>(source, end, pivotEnum))
+					if (!reader.Read<uint32_t>(pivotEnum))
 					{
 						GE_CORE_ERROR("Failed to read Entity TransformComponent ChildSize.");
 					}
@@ -2122,18 +2849,18 @@ namespace GE
 					AudioSourceComponent& asc = scene->GetOrAddComponent<AudioSourceComponent>(entity);
 
 					uint64_t uuid = 0;
-					if (ReadAligned<uint64_t>(source, end, uuid))
+					if (reader.Read<uint64_t>(uuid))
 						asc.AssetHandle = uuid;
 
 					bool loop = false;
-					if (ReadAligned<bool>(source, end, loop))
+					if (reader.Read<bool>(loop))
 						asc.Loop = loop;
 
 					float pitch = 0.0f;
-					if (ReadAligned<float>(source, end, pitch))
+					if (reader.Read<float>(pitch))
 						asc.Pitch = pitch;
 					float gain = 0.0f;
-					if (ReadAligned<float>(source, end, gain))
+					if (reader.Read<float>(gain))
 						asc.Gain = gain;
 				}
 				break;
@@ -2146,13 +2873,16 @@ namespace GE
 				{
 					RenderComponent& rc = scene->GetOrAddComponent<RenderComponent>(entity);
 					
-					uint64_t* ids = nullptr;
-					size_t size = 0;
-					if (ReadAlignedArray<uint64_t>(source, end, ids, size))
+					// Versions before 3 wrote IDs without a size
+					uint64_t size = 0;
+					std::vector<uint64_t> ids = std::vector<uint64_t>();
+					if (reader.IsPacked() && reader.ReadSize(size))
+						ids.resize(size);
+					if (reader.IsPacked() && reader.ReadArray<uint64_t>(ids.data(), ids.size()))
 					{
-						for (uint64_t i = 0; i < size; i++)
+						for (uint64_t id : ids)
 						{
-							rc.AddID(ids[i]);
+							rc.AddID(id);
 						}
 					}
 					else
@@ -2164,12 +2894,12 @@ namespace GE
 				case ComponentType::Camera: // Camera
 				{
 					CameraComponent& cc = scene->GetOrAddComponent<CameraComponent>(entity);
-					if (!ReadAligned<bool>(source, end, cc.Primary))
+					if (!reader.Read<bool>(cc.Primary))
 					{
 						GE_CORE_ERROR("Failed to read CameraComponent Primary.");
 					}
 
-					if (!ReadAligned<bool>(source, end, cc.FixedAspectRatio))
+					if (!reader.Read<bool>(cc.FixedAspectRatio))
 					{
 						GE_CORE_ERROR("Failed to read CameraComponent FixedAspectRatio.");
 					}
@@ -2178,7 +2908,7 @@ namespace GE
 					float fov = 0;
 					float nearClip = 0;
 					float farClip = 0;
-					if (ReadAligned<float>(source, end, fov) && ReadAligned<float>(source, end, nearClip) && ReadAligned<float>(source, end, farClip))
+					if (reader.Read<float>(fov) && reader.Read<float>(nearClip) && reader.Read<float>(farClip))
 					{
 						cc.SetFOV(fov);
 						cc.SetNearClip(nearClip);
@@ -2195,16 +2925,20 @@ namespace GE
 					SpriteRendererComponent& src = scene->GetOrAddComponent<SpriteRendererComponent>(entity);
 
 					uint64_t uuid = 0;
-					if (ReadAligned<uint64_t>(source, end, uuid))
+					if (reader.Read<uint64_t>(uuid))
 						src.AssetHandle = uuid;
 
 					float tilingFactor = 0;
-					if (ReadAligned<float>(source, end, tilingFactor))
+					if (reader.Read<float>(tilingFactor))
 						src.TilingFactor = tilingFactor;
 
 					float x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						src.Color = glm::vec4(x, y, z, w);
+
+					bool isStatic = false;
+					if (reader.Read<bool>(isStatic))
+						src.Static = isStatic;
 				}
 				break;
 				case ComponentType::CircleRenderer: // CircleRenderer
@@ -2212,27 +2946,27 @@ namespace GE
 					CircleRendererComponent& crc = scene->GetOrAddComponent<CircleRendererComponent>(entity);
 
 					uint64_t uuid = 0;
-					if (ReadAligned<uint64_t>(source, end, uuid))
+					if (reader.Read<uint64_t>(uuid))
 						crc.AssetHandle = uuid;
 
 					float tilingFactor = 0;
-					if (ReadAligned<float>(source, end, tilingFactor))
+					if (reader.Read<float>(tilingFactor))
 						crc.TilingFactor = tilingFactor;
 					
 					float radius = 0;
-					if (ReadAligned<float>(source, end, radius))
+					if (reader.Read<float>(radius))
 						crc.Radius = radius;
 
 					float thickness = 0;
-					if (ReadAligned<float>(source, end, thickness))
+					if (reader.Read<float>(thickness))
 						crc.Thickness = thickness;
 
 					float fade = 0;
-					if (ReadAligned<float>(source, end, fade))
+					if (reader.Read<float>(fade))
 						crc.Fade = fade;
 
 					float x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						crc.Color = glm::vec4(x, y, z, w);
 				}
 				break;
@@ -2241,39 +2975,39 @@ namespace GE
 					TextRendererComponent& trc = scene->GetOrAddComponent<TextRendererComponent>(entity);
 
 					uint64_t uuid = 0;
-					if (ReadAligned<uint64_t>(source, end, uuid))
+					if (reader.Read<uint64_t>(uuid))
 						trc.AssetHandle = uuid;
 
 					float kerningOffset = 0.0f;
-					if (ReadAligned<float>(source, end, kerningOffset))
+					if (reader.Read<float>(kerningOffset))
 						trc.KerningOffset = kerningOffset;
 
 					float lineHeightOffset = 0.0f;
-					if (ReadAligned<float>(source, end, lineHeightOffset))
+					if (reader.Read<float>(lineHeightOffset))
 						trc.LineHeightOffset = lineHeightOffset;
 
 					uint64_t textStringSize = 0;
-					if (!ReadAligned(source, end, textStringSize))
+					if (!reader.ReadSize(textStringSize))
 						return false;
 					char* textCStr = new char[textStringSize];
-					if (ReadAlignedArray(source, end, textCStr, textStringSize))
+					if (reader.ReadArray(textCStr, textStringSize))
 						trc.Text.assign(textCStr, textStringSize);
 					delete[](textCStr);
 
 					float x, y, z, w = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						trc.TextColor = glm::vec4(x, y, z, w);
 
 					x, y, z, w = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						trc.BGColor = glm::vec4(x, y, z, w);
 
 					float scalar = 0.0f;
-					if (ReadAligned<float>(source, end, scalar))
+					if (reader.Read<float>(scalar))
 						trc.TextScalar = scalar;
 
 					float offsetX, offsetY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, offsetX, offsetY))
+					if (reader.ReadVec2<float>(offsetX, offsetY))
 						trc.TextOffset = glm::vec2(offsetX, offsetY);
 
 				}
@@ -2282,8 +3016,15 @@ namespace GE
 				{
 					GUICanvasComponent& guiCC = scene->GetOrAddComponent<GUICanvasComponent>(entity);
 
+					bool controlMouse = false, showMouse = false;
+					if (reader.Read<bool>(controlMouse) && reader.Read<bool>(showMouse))
+					{
+						guiCC.ControlMouse = controlMouse;
+						guiCC.ShowMouse = showMouse;
+					}
+
 					uint32_t mode = 0;
-					if (ReadAligned<uint32_t>(source, end, mode))
+					if (reader.Read<uint32_t>(mode))
 						guiCC.Mode = (CanvasMode)mode;
 
 				}
@@ -2293,17 +3034,17 @@ namespace GE
 					GUILayoutComponent& guiLOC = scene->GetOrAddComponent<GUILayoutComponent>(entity);
 
 					uint32_t mode = 0;
-					if (ReadAligned<uint32_t>(source, end, mode))
+					if (reader.Read<uint32_t>(mode))
 						guiLOC.Mode = (LayoutMode)mode;
 
 					float offsetX, offsetY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, offsetX, offsetY))
+					if (reader.ReadVec2<float>(offsetX, offsetY))
 						guiLOC.StartingOffset = glm::vec2(offsetX, offsetY);
 					float sizeX, sizeY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, sizeX, sizeY))
+					if (reader.ReadVec2<float>(sizeX, sizeY))
 						guiLOC.ChildSize = glm::vec2(sizeX, sizeY);
 					float paddingX, paddingY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, paddingX, paddingY))
+					if (reader.ReadVec2<float>(paddingX, paddingY))
 						guiLOC.ChildPadding = glm::vec2(paddingX, paddingY);
 
 				}
@@ -2315,15 +3056,15 @@ namespace GE
 					GUIImageComponent& guiIC = scene->GetOrAddComponent<GUIImageComponent>(entity);
 
 					float r, g, b, a = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, r, g, b, a))
+					if (reader.ReadVec4<float>(r, g, b, a))
 						guiIC.Color = glm::vec4(r, g, b, a);
 
 					uint64_t handle = 0;
-					if (ReadAligned<uint64_t>(source, end, handle))
+					if (reader.Read<uint64_t>(handle))
 						guiIC.TextureHandle = handle;
 
 					float tilingFactor = 0.0f;
-					if (ReadAligned<float>(source, end, tilingFactor))
+					if (reader.Read<float>(tilingFactor))
 						guiIC.TilingFactor = tilingFactor;
 
 				}
@@ -2333,94 +3074,94 @@ namespace GE
 					GUIButtonComponent& guiBC = scene->GetOrAddComponent<GUIButtonComponent>(entity);
 
 					uint64_t buttonfontHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, buttonfontHandle))
+					if (reader.Read<uint64_t>(buttonfontHandle))
 						guiBC.FontAssetHandle = buttonfontHandle;
 
 					float kerningOffset = 0.0f;
-					if (ReadAligned<float>(source, end, kerningOffset))
+					if (reader.Read<float>(kerningOffset))
 						guiBC.KerningOffset = kerningOffset;
 
 					float lineHeightOffset = 0.0f;
-					if (ReadAligned<float>(source, end, lineHeightOffset))
+					if (reader.Read<float>(lineHeightOffset))
 						guiBC.LineHeightOffset = lineHeightOffset;
 
 					uint64_t textStringSize = 0;
-					if (!ReadAligned(source, end, textStringSize))
+					if (!reader.ReadSize(textStringSize))
 						return false;
 					char* textCStr = new char[textStringSize];
-					if (ReadAlignedArray(source, end, textCStr, textStringSize))
+					if (reader.ReadArray(textCStr, textStringSize))
 						guiBC.Text.assign(textCStr, textStringSize);
 					delete[](textCStr);
 
 					float x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						guiBC.TextColor = glm::vec4(x, y, z, w);
 
 					x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						guiBC.BGColor = glm::vec4(x, y, z, w);
 
 					float scalar = 0.0f;
-					if (ReadAligned<float>(source, end, scalar))
+					if (reader.Read<float>(scalar))
 						guiBC.TextScalar = scalar;
 
 					float offsetX, offsetY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, offsetX, offsetY))
+					if (reader.ReadVec2<float>(offsetX, offsetY))
 						guiBC.TextStartingOffset = glm::vec2(offsetX, offsetY);
 
 					float sizeX, sizeY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, sizeX, sizeY))
+					if (reader.ReadVec2<float>(sizeX, sizeY))
 						guiBC.TextSize = glm::vec2(sizeX, sizeY);
 
 					// BG
 					uint64_t fgTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, fgTextureHandle))
+					if (reader.Read<uint64_t>(fgTextureHandle))
 						guiBC.ForegroundTextureHandle = fgTextureHandle;
 
 					float fgr, fgg, fgb, fga = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, fgr, fgg, fgb, fga))
+					if (reader.ReadVec4<float>(fgr, fgg, fgb, fga))
 						guiBC.ForegroundColor = glm::vec4(fgr, fgg, fgb, fga);
 
 					// MG
 					uint64_t inactiveTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, inactiveTextureHandle))
+					if (reader.Read<uint64_t>(inactiveTextureHandle))
 						guiBC.DisabledTextureHandle = inactiveTextureHandle;
 
 					float iar, iag, iab, iaa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, iar, iag, iab, iaa))
+					if (reader.ReadVec4<float>(iar, iag, iab, iaa))
 						guiBC.DisabledColor = glm::vec4(iar, iag, iab, iaa);
 
 					uint64_t activeTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, activeTextureHandle))
+					if (reader.Read<uint64_t>(activeTextureHandle))
 						guiBC.EnabledTextureHandle = activeTextureHandle;
 
 					float ar, ag, ab, aa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, ar, ag, ab, aa))
+					if (reader.ReadVec4<float>(ar, ag, ab, aa))
 						guiBC.DisabledColor = glm::vec4(ar, ag, ab, aa);
 
 					uint64_t hoveredTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, hoveredTextureHandle))
+					if (reader.Read<uint64_t>(hoveredTextureHandle))
 						guiBC.HoveredTextureHandle = hoveredTextureHandle;
 
 					float hr, hg, hb, ha = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, hr, hg, hb, ha))
+					if (reader.ReadVec4<float>(hr, hg, hb, ha))
 						guiBC.HoveredColor = glm::vec4(hr, hg, hb, ha);
 
 					uint64_t selectedTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, selectedTextureHandle))
+					if (reader.Read<uint64_t>(selectedTextureHandle))
 						guiBC.SelectedTextureHandle = selectedTextureHandle;
 
 					float sr, sg, sb, sa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, sr, sg, sb, sa))
+					if (reader.ReadVec4<float>(sr, sg, sb, sa))
 						guiBC.SelectedColor = glm::vec4(sr, sg, sb, sa);
 
 					// FG
 					uint64_t buttonFGHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, buttonFGHandle))
+					if (reader.Read<uint64_t>(buttonFGHandle))
 						guiBC.ForegroundTextureHandle = buttonFGHandle;
 
 					float r, g, b, a = 0;
-					if (ReadAlignedVec4<float>(source, end, r, g, b, a))
+					if (reader.ReadVec4<float>(r, g, b, a))
 						guiBC.ForegroundColor = glm::vec4(r, g, b, a);
 
 				}
@@ -2430,59 +3171,59 @@ namespace GE
 					GUIInputFieldComponent& guiIFC = scene->GetOrAddComponent<GUIInputFieldComponent>(entity);
 
 					uint64_t bgHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, bgHandle))
+					if (reader.Read<uint64_t>(bgHandle))
 						guiIFC.BackgroundTextureHandle = bgHandle;
 
 					float r, g, b, a = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, r, g, b, a))
+					if (reader.ReadVec4<float>(r, g, b, a))
 						guiIFC.BackgroundColor = glm::vec4(r, g, b, a);
 
 					bool fillBG = false;
-					if (ReadAligned<bool>(source, end, fillBG))
+					if (reader.Read<bool>(fillBG))
 						guiIFC.FillBackground = fillBG;
 
 					uint64_t inputFieldFontHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, inputFieldFontHandle))
+					if (reader.Read<uint64_t>(inputFieldFontHandle))
 						guiIFC.FontAssetHandle = inputFieldFontHandle;
 
 					float kerningOffset = 0.0f;
-					if (ReadAligned<float>(source, end, kerningOffset))
+					if (reader.Read<float>(kerningOffset))
 						guiIFC.KerningOffset = kerningOffset;
 
 					float lineHeightOffset = 0.0f;
-					if (ReadAligned<float>(source, end, lineHeightOffset))
+					if (reader.Read<float>(lineHeightOffset))
 						guiIFC.LineHeightOffset = lineHeightOffset;
 
 					uint64_t textStringSize = 0;
-					if (!ReadAligned(source, end, textStringSize))
+					if (!reader.ReadSize(textStringSize))
 						return false;
 					char* textCStr = new char[textStringSize];
-					if (ReadAlignedArray(source, end, textCStr, textStringSize))
+					if (reader.ReadArray(textCStr, textStringSize))
 						guiIFC.Text.assign(textCStr, textStringSize);
 					delete[](textCStr);
 
 					float x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						guiIFC.TextColor = glm::vec4(x, y, z, w);
 
 					x, y, z, w = 0;
-					if (ReadAlignedVec4<float>(source, end, x, y, z, w))
+					if (reader.ReadVec4<float>(x, y, z, w))
 						guiIFC.BGColor = glm::vec4(x, y, z, w);
 
 					float scalar = 0.0f;
-					if (ReadAligned<float>(source, end, scalar))
+					if (reader.Read<float>(scalar))
 						guiIFC.TextScalar = scalar;
 
 					float offsetX, offsetY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, offsetX, offsetY))
+					if (reader.ReadVec2<float>(offsetX, offsetY))
 						guiIFC.TextStartingOffset = glm::vec2(offsetX, offsetY);
 
 					float sizeX, sizeY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, sizeX, sizeY))
+					if (reader.ReadVec2<float>(sizeX, sizeY))
 						guiIFC.TextSize = glm::vec2(sizeX, sizeY);
 
 					float paddingX, paddingY = 0.0f;
-					if (ReadAlignedVec2<float>(source, end, paddingX, paddingY))
+					if (reader.ReadVec2<float>(paddingX, paddingY))
 						guiIFC.Padding = glm::vec2(paddingX, paddingY);
 				}
 					break;
@@ -2491,58 +3232,58 @@ namespace GE
 					GUISliderComponent& guiSC = scene->GetOrAddComponent<GUISliderComponent>(entity);
 
 					uint32_t direction = 0;
-					if (ReadAligned<uint32_t>(source, end, direction))
+					if (reader.Read<uint32_t>(direction))
 						guiSC.Direction = (SliderDirection)direction;
 
 					float current = 0.0f;
-					if (ReadAligned<float>(source, end, current))
+					if (reader.Read<float>(current))
 						guiSC.Fill = current;
 
 					uint64_t bgHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, bgHandle))
+					if (reader.Read<uint64_t>(bgHandle))
 						guiSC.BackgroundTextureHandle = bgHandle;
 					float bgr, bgg, bgb, bga = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, bgr, bgg, bgb, bga))
+					if (reader.ReadVec4<float>(bgr, bgg, bgb, bga))
 						guiSC.BackgroundColor = glm::vec4(bgr, bgg, bgb, bga);
 
 					// MG
 					uint64_t inactiveTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, inactiveTextureHandle))
+					if (reader.Read<uint64_t>(inactiveTextureHandle))
 						guiSC.DisabledTextureHandle = inactiveTextureHandle;
 
 					float iar, iag, iab, iaa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, iar, iag, iab, iaa))
+					if (reader.ReadVec4<float>(iar, iag, iab, iaa))
 						guiSC.DisabledColor = glm::vec4(iar, iag, iab, iaa);
 
 					uint64_t activeTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, activeTextureHandle))
+					if (reader.Read<uint64_t>(activeTextureHandle))
 						guiSC.EnabledTextureHandle = activeTextureHandle;
 
 					float ar, ag, ab, aa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, ar, ag, ab, aa))
+					if (reader.ReadVec4<float>(ar, ag, ab, aa))
 						guiSC.DisabledColor = glm::vec4(ar, ag, ab, aa);
 
 					uint64_t hoveredTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, hoveredTextureHandle))
+					if (reader.Read<uint64_t>(hoveredTextureHandle))
 						guiSC.HoveredTextureHandle = hoveredTextureHandle;
 
 					float hr, hg, hb, ha = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, hr, hg, hb, ha))
+					if (reader.ReadVec4<float>(hr, hg, hb, ha))
 						guiSC.HoveredColor = glm::vec4(hr, hg, hb, ha);
 
 					uint64_t selectedTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, selectedTextureHandle))
+					if (reader.Read<uint64_t>(selectedTextureHandle))
 						guiSC.SelectedTextureHandle = selectedTextureHandle;
 
 					float sr, sg, sb, sa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, sr, sg, sb, sa))
+					if (reader.ReadVec4<float>(sr, sg, sb, sa))
 						guiSC.SelectedColor = glm::vec4(sr, sg, sb, sa);
 
 					uint64_t fgHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, fgHandle))
+					if (reader.Read<uint64_t>(fgHandle))
 						guiSC.ForegroundTextureHandle = fgHandle;
 					float fgr, fgg, fgb, fga = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, fgr, fgg, fgb, fga))
+					if (reader.ReadVec4<float>(fgr, fgg, fgb, fga))
 						guiSC.ForegroundColor = glm::vec4(fgr, fgg, fgb, fga);
 
 				}
@@ -2552,50 +3293,50 @@ namespace GE
 					GUICheckboxComponent& guiCBC = scene->GetOrAddComponent<GUICheckboxComponent>(entity);
 
 					uint64_t bgHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, bgHandle))
+					if (reader.Read<uint64_t>(bgHandle))
 						guiCBC.BackgroundTextureHandle = bgHandle;
 					float bgr, bgg, bgb, bga = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, bgr, bgg, bgb, bga))
+					if (reader.ReadVec4<float>(bgr, bgg, bgb, bga))
 						guiCBC.BackgroundColor = glm::vec4(bgr, bgg, bgb, bga);
 
 					// MG
 					uint64_t inactiveTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, inactiveTextureHandle))
+					if (reader.Read<uint64_t>(inactiveTextureHandle))
 						guiCBC.DisabledTextureHandle = inactiveTextureHandle;
 
 					float iar, iag, iab, iaa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, iar, iag, iab, iaa))
+					if (reader.ReadVec4<float>(iar, iag, iab, iaa))
 						guiCBC.DisabledColor = glm::vec4(iar, iag, iab, iaa);
 
 					uint64_t activeTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, activeTextureHandle))
+					if (reader.Read<uint64_t>(activeTextureHandle))
 						guiCBC.EnabledTextureHandle = activeTextureHandle;
 
 					float ar, ag, ab, aa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, ar, ag, ab, aa))
+					if (reader.ReadVec4<float>(ar, ag, ab, aa))
 						guiCBC.DisabledColor = glm::vec4(ar, ag, ab, aa);
 
 					uint64_t hoveredTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, hoveredTextureHandle))
+					if (reader.Read<uint64_t>(hoveredTextureHandle))
 						guiCBC.HoveredTextureHandle = hoveredTextureHandle;
 
 					float hr, hg, hb, ha = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, hr, hg, hb, ha))
+					if (reader.ReadVec4<float>(hr, hg, hb, ha))
 						guiCBC.HoveredColor = glm::vec4(hr, hg, hb, ha);
 
 					uint64_t selectedTextureHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, selectedTextureHandle))
+					if (reader.Read<uint64_t>(selectedTextureHandle))
 						guiCBC.SelectedTextureHandle = selectedTextureHandle;
 
 					float sr, sg, sb, sa = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, sr, sg, sb, sa))
+					if (reader.ReadVec4<float>(sr, sg, sb, sa))
 						guiCBC.SelectedColor = glm::vec4(sr, sg, sb, sa);
 
 					uint64_t fgHandle = 0;
-					if (ReadAligned<uint64_t>(source, end, fgHandle))
+					if (reader.Read<uint64_t>(fgHandle))
 						guiCBC.ForegroundTextureHandle = fgHandle;
 					float fgr, fgg, fgb, fga = 0.0f;
-					if (ReadAlignedVec4<float>(source, end, fgr, fgg, fgb, fga))
+					if (reader.ReadVec4<float>(fgr, fgg, fgb, fga))
 						guiCBC.ForegroundColor = glm::vec4(fgr, fgg, fgb, fga);
 				}
 					break;
@@ -2605,11 +3346,11 @@ namespace GE
 					Rigidbody2DComponent& rb2dc = scene->GetOrAddComponent<Rigidbody2DComponent>(entity);
 
 					uint32_t type = 0;
-					if (ReadAligned<uint32_t>(source, end, type))
+					if (reader.Read<uint32_t>(type))
 						rb2dc.Type = (Rigidbody2DComponent::BodyType)type;
 
 					bool fixedRotation = false;
-					if (ReadAligned<bool>(source, end, fixedRotation))
+					if (reader.Read<bool>(fixedRotation))
 						rb2dc.FixedRotation = fixedRotation;
 				}
 				break;
@@ -2618,31 +3359,31 @@ namespace GE
 					BoxCollider2DComponent& bc2dc = scene->GetOrAddComponent<BoxCollider2DComponent>(entity);
 
 					bool show = false;
-					if (ReadAligned<bool>(source, end, show))
+					if (reader.Read<bool>(show))
 						bc2dc.Show = show;
 
 					float density = 0.0f;
-					if (ReadAligned<float>(source, end, density))
+					if (reader.Read<float>(density))
 						bc2dc.Density = density;
 
 					float friction = 0.0f;
-					if (ReadAligned<float>(source, end, friction))
+					if (reader.Read<float>(friction))
 						bc2dc.Friction = friction;
 
 					float restitution = 0.0f;
-					if (ReadAligned<float>(source, end, restitution))
+					if (reader.Read<float>(restitution))
 						bc2dc.Restitution = restitution;
 
 					float restitutionThreshold = 0.0f;
-					if (ReadAligned<float>(source, end, restitutionThreshold))
+					if (reader.Read<float>(restitutionThreshold))
 						bc2dc.RestitutionThreshold = restitutionThreshold;
 
 					float x, y = 0;
-					if (ReadAlignedVec2<float>(source, end, x, y))
+					if (reader.ReadVec2<float>(x, y))
 						bc2dc.Offset = glm::vec2(x, y);
 
 					x, y = 0;
-					if (ReadAlignedVec2<float>(source, end, x, y))
+					if (reader.ReadVec2<float>(x, y))
 						bc2dc.Size = glm::vec2(x, y);
 				}
 				break;
@@ -2651,30 +3392,30 @@ namespace GE
 					CircleCollider2DComponent& cc2dc = scene->GetOrAddComponent<CircleCollider2DComponent>(entity);
 
 					bool show = false;
-					if (ReadAligned<bool>(source, end, show))
+					if (reader.Read<bool>(show))
 						cc2dc.Show = show;
 
 					float density = 0.0f;
-					if (ReadAligned<float>(source, end, density))
+					if (reader.Read<float>(density))
 						cc2dc.Density = density;
 
 					float friction = 0.0f;
-					if (ReadAligned<float>(source, end, friction))
+					if (reader.Read<float>(friction))
 						cc2dc.Friction = friction;
 
 					float restitution = 0.0f;
-					if (ReadAligned<float>(source, end, restitution))
+					if (reader.Read<float>(restitution))
 						cc2dc.Restitution = restitution;
 
 					float restitutionThreshold = 0.0f;
-					if (ReadAligned<float>(source, end, restitutionThreshold))
+					if (reader.Read<float>(restitutionThreshold))
 						cc2dc.RestitutionThreshold = restitutionThreshold;
 
 					float radius = 0.0f;
-					if (ReadAligned<float>(source, end, radius))
+					if (reader.Read<float>(radius))
 						cc2dc.Radius = radius;
 					float x, y = 0;
-					if (ReadAlignedVec2<float>(source, end, x, y))
+					if (reader.ReadVec2<float>(x, y))
 						cc2dc.Offset = glm::vec2(x, y);
 
 				}
@@ -2690,26 +3431,26 @@ namespace GE
 					ScriptComponent& sc = scene->GetOrAddComponent<ScriptComponent>(entity);
 
 					uint64_t scriptHandle = 0;
-					if (!ReadAligned<uint64_t>(source, end, scriptHandle))
+					if (!reader.Read<uint64_t>(scriptHandle))
 						break;
 
 					// Field Name, Type & Data
 					uint64_t fieldsSize = 0;
-					if (!ReadAligned(source, end, fieldsSize))
+					if (!reader.ReadSize(fieldsSize))
 						return false;
 					for (int i = 0; i < fieldsSize; i++)
 					{
 						uint64_t fieldNameSize = 0;
-						if (!ReadAligned(source, end, fieldNameSize))
+						if (!reader.ReadSize(fieldNameSize))
 							return false;
 						char* fieldNameCStr = new char[fieldNameSize];
 						std::string fieldName;
-						if (ReadAlignedArray(source, end, fieldNameCStr, fieldNameSize))
+						if (reader.ReadArray(fieldNameCStr, fieldNameSize))
 							fieldName.assign(fieldNameCStr, fieldNameSize);
 						delete[](fieldNameCStr);
 
 						uint32_t fieldType = 0;
-						if (!ReadAligned(source, end, fieldType))
+						if (!reader.Read(fieldType))
 							return false;
 
 						ScriptFieldMap& fields = Scripting::GetEntityFields(scene->GetComponent<IDComponent>(entity).ID);
@@ -2719,7 +3460,7 @@ namespace GE
 						case ScriptField::Type::Char:
 						{
 							char c = 0;
-							if (!ReadAligned(source, end, c))
+							if (!reader.Read(c))
 								return false;
 							instanceField.SetValue<char>(c);
 						}
@@ -2727,7 +3468,7 @@ namespace GE
 						case ScriptField::Type::Int:
 						{
 							int data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<int>(data);
 						}
@@ -2735,7 +3476,7 @@ namespace GE
 						case ScriptField::Type::UInt:
 						{
 							uint32_t data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<uint32_t>(data);
 						}
@@ -2743,7 +3484,7 @@ namespace GE
 						case ScriptField::Type::Float:
 						{
 							float data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<float>(data);
 						}
@@ -2751,7 +3492,7 @@ namespace GE
 						case ScriptField::Type::Byte:
 						{
 							uint8_t data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<uint8_t>(data);
 						}
@@ -2759,7 +3500,7 @@ namespace GE
 						case ScriptField::Type::Bool:
 						{
 							bool data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<bool>(data);
 						}
@@ -2767,7 +3508,7 @@ namespace GE
 						case ScriptField::Type::Vector2:
 						{
 							float x, y = 0;
-							if (!ReadAlignedVec2<float>(source, end, x, y))
+							if (!reader.ReadVec2<float>(x, y))
 								return false;
 							glm::vec2 data = { x, y };
 							instanceField.SetValue<glm::vec2>(data);
@@ -2776,7 +3517,7 @@ namespace GE
 						case ScriptField::Type::Vector3:
 						{
 							float x, y, z = 0;
-							if (!ReadAlignedVec3<float>(source, end, x, y, z))
+							if (!reader.ReadVec3<float>(x, y, z))
 								return false;
 							glm::vec3 data = { x, y, z };
 							instanceField.SetValue<glm::vec3>(data);
@@ -2785,7 +3526,7 @@ namespace GE
 						case ScriptField::Type::Vector4:
 						{
 							float x, y, z, w  = 0;
-							if (!ReadAlignedVec4<float>(source, end, x, y, z, w))
+							if (!reader.ReadVec4<float>(x, y, z, w))
 								return false;
 							glm::vec4 data = { x, y, z, w };
 							instanceField.SetValue<glm::vec4>(data);
@@ -2794,7 +3535,7 @@ namespace GE
 						case ScriptField::Type::Entity:
 						{
 							uint64_t data = 0;
-							if (!ReadAligned(source, end, data))
+							if (!reader.Read(data))
 								return false;
 							instanceField.SetValue<uint64_t>(data);
 						}
@@ -2808,13 +3549,6 @@ namespace GE
 					return false;
 					break;
 				}
-
-				// Overflow check
-				if (source > end)
-				{
-					GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeEntity(const EntityInfo&, Entity&) Overflow");
-					return false;
-				}
 			}
 			else
 			{
@@ -2829,7 +3563,13 @@ namespace GE
 
 	Ref<Asset> RuntimeAssetManager::DeserializeTexture2D(const AssetInfo& assetInfo)
 	{
-		if (assetInfo.DataBuffer)
+		std::function<Ref<Asset>()> create = DecodeTexture2D(assetInfo);
+		return create ? create() : nullptr;
+	}
+
+	std::function<Ref<Asset>()> RuntimeAssetManager::DecodeTexture2D(const AssetInfo& assetInfo)
+	{
+		if (!assetInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Texture2D from AssetPack.\n\tAssetInfo has no Data");
 			return nullptr;
@@ -2871,13 +3611,10 @@ namespace GE
 		uint64_t textureDataSize = 0;
 		if (!ReadAligned(source, end, textureDataSize))
 			return nullptr;
-		uint8_t* data = new uint8_t[textureDataSize];
-		if (!ReadAlignedArray<uint8_t>(source, end, data, textureDataSize))
+		Buffer textureBuffer = Buffer();
+		if (!ReadAlignedView(source, end, textureBuffer, textureDataSize))
 			return nullptr;
 
-		Buffer textureBuffer = Buffer(data, textureDataSize);
-		delete[] data;
-
 		Texture::Config config = Texture::Config(width, height, 0, mips);
 		config.InternalFormat = (Texture::ImageFormat)internalFormat;
 		config.Format = (Texture::DataFormat)format;
@@ -2886,16 +3623,26 @@ namespace GE
 		if (source > end)
 			GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeTexture2D(AssetInfo&) Buffer Overflow");
 
-		// Set
-		Ref<Texture2D> texture = Texture2D::Create(handle, config, textureBuffer);
-		textureBuffer.Release();
-		GE_CORE_INFO("RuntimeAssetManager::DeserializeTexture2D(AssetInfo&) Successful");
-		return texture;
+		// Copied by decoding thread, creating thread uploads it & Texture keeps it
+		Ref<ScopedBuffer> texels = CreateRef<ScopedBuffer>(ScopedBuffer::Copy(textureBuffer.As<void>(), textureBuffer.GetSize()));
+		return [handle, config, texels]() -> Ref<Asset>
+			{
+				Ref<Texture2D> texture = Texture2D::Create(handle, config, std::move(*texels));
+				GE_CORE_INFO("RuntimeAssetManager::DeserializeTexture2D(AssetInfo&) Successful");
+				return texture;
+			};
 	}
 
 	Ref<Asset> RuntimeAssetManager::DeserializeFont(const AssetInfo& assetInfo)
 	{
-		if (assetInfo.DataBuffer)
+		std::function<Ref<Asset>()> create = DecodeFont(assetInfo);
+		return create ? create() : nullptr;
+	}
+
+	std::function<Ref<Asset>()> RuntimeAssetManager::DecodeFont(const AssetInfo& assetInfo)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+		if (!assetInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Font from AssetPack.\n\tAssetInfo has no Data");
 			return nullptr;
@@ -2914,6 +3661,13 @@ namespace GE
 		* * ~ FontAtlasBuffer : Texture2D Buffer
 		* * * - FontAtlasSize
 		* * * - FontAtlasBuffer
+		* ~ GlyphTable
+		* * - AscenderY : float
+		* * - DescenderY : float
+		* * - LineHeight : float
+		* * ~ Glyphs
+		* * ~ Kerning
+		* ~ Source
 		*/
 
 		Font::AtlasConfig config;
@@ -2950,30 +3704,77 @@ namespace GE
 		size_t size = 0;
 		if (!ReadAligned(source, end, size))
 			return nullptr;
-		uint8_t* data = new uint8_t[size];
-		if (!ReadAlignedArray<uint8_t>(source, end, data, size))
+		Buffer atlasBuffer = Buffer();
+		if (!ReadAlignedView(source, end, atlasBuffer, size))
+			return nullptr;
+
+		// Glyph Table
+		Font::GlyphTable glyphTable = Font::GlyphTable();
+		if (!ReadAligned<float>(source, end, glyphTable.FontMetrics.AscenderY))
+			return nullptr;
+		if (!ReadAligned<float>(source, end, glyphTable.FontMetrics.DescenderY))
+			return nullptr;
+		if (!ReadAligned<float>(source, end, glyphTable.FontMetrics.LineHeight))
+			return nullptr;
+
+		size_t glyphCount = 0;
+		if (!ReadAligned(source, end, glyphCount))
+			return nullptr;
+		glyphTable.Glyphs.resize(glyphCount);
+		Font::Glyph* glyphs = glyphTable.Glyphs.data();
+		if (!ReadAlignedArray<Font::Glyph>(source, end, glyphs, glyphCount))
+			return nullptr;
+
+		size_t kerningCount = 0;
+		if (!ReadAligned(source, end, kerningCount))
 			return nullptr;
+		if (kerningCount > 0)
+		{
+			glyphTable.Kerning.resize(kerningCount);
+			Font::KerningPair* kerning = glyphTable.Kerning.data();
+			if (!ReadAlignedArray<Font::KerningPair>(source, end, kerning, kerningCount))
+				return nullptr;
+		}
 
-		Buffer textBuffer = Buffer(data, size);
-		delete[] data;
+		// Font file data, copied by GlyphCache on creation
+		size_t sourceSize = 0;
+		if (!ReadAligned(source, end, sourceSize))
+			return nullptr;
+		Buffer sourceBuffer = Buffer();
+		if (sourceSize > 0 && !ReadAlignedView(source, end, sourceBuffer, sourceSize))
+			return nullptr;
 
 		// Overflow check
 		if (source > end)
-			GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeFont2D(AssetInfo&) Buffer Overflow");
+			GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeFont(AssetInfo&) Buffer Overflow");
 
-		// Create & Assign Data
-		Ref<Font::MSDFData> msdfData = CreateRef<Font::MSDFData>();
-		config.Texture = LoadFontAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(textBuffer, width, height, config, msdfData);
-		Ref<Font> font = CreateRef<Font>(handle, config, msdfData);
+		Texture::Config textureConfig = Texture::Config(width, height, 0, false);
+		textureConfig.InternalFormat = Texture::ImageFormat::RGB8;
+		textureConfig.Format = Texture::DataFormat::RGB;
 
-		textBuffer.Release();
-
-		return font;
+		// Copied by decoding thread, creating thread uploads it & Texture keeps it
+		Ref<ScopedBuffer> atlas = CreateRef<ScopedBuffer>(ScopedBuffer::Copy(atlasBuffer.As<void>(), atlasBuffer.GetSize()));
+		FontStats::AddBaked((uint64_t)std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+		return [handle, config, textureConfig, atlas, glyphTable, sourceBuffer]() -> Ref<Asset>
+			{
+				Font::AtlasConfig atlasConfig = config;
+				atlasConfig.Texture = Texture2D::Create(0, textureConfig, std::move(*atlas));
+				Ref<Font> font = CreateRef<Font>(handle, atlasConfig, glyphTable);
+				font->SetSource(sourceBuffer);
+				GE_CORE_INFO("RuntimeAssetManager::DeserializeFont(AssetInfo&) Successful");
+				return font;
+			};
 	}
 
 	Ref<Asset> RuntimeAssetManager::DeserializeAudio(const AssetInfo& assetInfo)
 	{
-		if (assetInfo.DataBuffer)
+		std::function<Ref<Asset>()> create = DecodeAudio(assetInfo);
+		return create ? create() : nullptr;
+	}
+
+	std::function<Ref<Asset>()> RuntimeAssetManager::DecodeAudio(const AssetInfo& assetInfo)
+	{
+		if (!assetInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Audio from AssetPack.\n\tAssetInfo has no Data");
 			return nullptr;
@@ -3035,26 +3836,27 @@ namespace GE
 		size_t size = 0;
 		if (!ReadAligned(source, end, size))
 			return nullptr;
-		uint8_t* data = new uint8_t[size];
-		if (!ReadAlignedArray<uint8_t>(source, end, data, size))
+		Buffer buffer = Buffer();
+		if (!ReadAlignedView(source, end, buffer, size))
 			return nullptr;
 
-		Buffer buffer = Buffer(data, size);
-		delete[] data;
-
 		// Overflow check
 		if (source > end)
 			GE_CORE_ASSERT(false, "RuntimeAssetManager::DeserializeAudio(AssetInfo&) Buffer Overflow");
 
-		Ref<Audio> audio = Audio::Create(handle, Audio::Config(channels, sampleRate, bps, buffer));
-		buffer.Release();
-		GE_CORE_INFO("RuntimeAssetManager::DeserializeAudio(AssetInfo&) Successful");
-		return audio;
+		// Copied by decoding thread, creating thread buffers it & Audio keeps it
+		Ref<ScopedBuffer> samples = CreateRef<ScopedBuffer>(ScopedBuffer::Copy(buffer.As<void>(), buffer.GetSize()));
+		return [handle, channels, sampleRate, bps, samples]() -> Ref<Asset>
+			{
+				Ref<Audio> audio = Audio::Create(handle, Audio::Config(channels, sampleRate, bps, std::move(*samples)));
+				GE_CORE_INFO("RuntimeAssetManager::DeserializeAudio(AssetInfo&) Successful");
+				return audio;
+			};
 	}
 
 	Ref<Asset> RuntimeAssetManager::DeserializeScript(const AssetInfo& assetInfo)
 	{
-		if (assetInfo.DataBuffer)
+		if (!assetInfo.DataBuffer)
 		{
 			GE_CORE_ERROR("Cannot import Script from AssetPack.\n\tAssetInfo has no Data");
 			return nullptr;
@@ -3080,7 +3882,7 @@ namespace GE
 
 		// Script FullName
 		uint64_t sizeOfFullName = 0;
-		if (ReadAligned(source, end, sizeOfFullName))
+		if (!ReadAligned(source, end, sizeOfFullName))
 			return nullptr;
 		char* fullName = new char[sizeOfFullName];
 		if (!ReadAlignedArray<char>(source, end, fullName, sizeOfFullName))
@@ -3098,6 +3900,61 @@ namespace GE
 		return script;
 	}
 
+	Ref<Asset> RuntimeAssetManager::DeserializePrefab(const AssetInfo& assetInfo)
+	{
+		if (!assetInfo.DataBuffer)
+		{
+			GE_CORE_ERROR("Cannot import Prefab from AssetPack.\n\tAssetInfo has no Data");
+			return nullptr;
+		}
+
+		// See SerializePrefab()
+		const uint8_t* source = assetInfo.DataBuffer.As<uint8_t>();
+		const uint8_t* end = source + assetInfo.DataBuffer.GetSize();
+
+		// Handle
+		uint64_t handle = 0;
+		if (!ReadAligned<uint64_t>(source, end, handle))
+			return nullptr;
+
+		// Type has already been read, skip
+		source += GetAligned(sizeof(uint16_t));
+
+		uint64_t eCount = 0;
+		if (!ReadAligned(source, end, eCount))
+			return nullptr;
+
+		Ref<Prefab> prefab = CreateRef<Prefab>(handle);
+		Ref<Scene> prefabTemplate = prefab->GetTemplate();
+		// Prefabs are only written by Version 5, Entities are packed
+		BufferReader reader = BufferReader(source, end, true);
+		for (uint64_t i = 0; i < eCount; i++)
+		{
+			uint64_t size = 0;
+			SceneInfo::EntityInfo eInfo = SceneInfo::EntityInfo();
+			if (!reader.ReadSize(size) || !reader.ReadView(eInfo.DataBuffer, size))
+				return nullptr;
+
+			// Component Type : IDComponent(1) expected
+			const uint8_t* entitySource = eInfo.DataBuffer.As<uint8_t>();
+			BufferReader entityReader = BufferReader(entitySource, entitySource + size, true);
+			uint16_t cType = 0;
+			uint64_t uuid = 0;
+			if (!entityReader.Read(cType) || cType != (uint16_t)ComponentType::ID || !entityReader.Read(uuid))
+				return nullptr;
+
+			Entity entity = prefabTemplate->CreateEntityWithUUID(uuid, "Deserialized Entity", 0);
+			if (!DeserializeEntity(prefabTemplate, eInfo, entity))
+				return nullptr;
+		}
+
+		if (!prefab->Resolve())
+			return nullptr;
+
+		GE_CORE_INFO("RuntimeAssetManager::DeserializePrefab(AssetInfo&) Successful");
+		return prefab;
+	}
+
 #pragma endregion
 
 }
\ No newline at end of file
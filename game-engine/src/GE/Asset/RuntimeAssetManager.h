@@ -3,7 +3,12 @@
 #include "AssetManager.h"
 
 #include "Pack/AssetPack.h"
+#include "Pack/CookCache.h"
 
+#include "GE/Core/Memory/Compression.h"
+
+#include <atomic>
+#include <chrono>
 #include <map>
 
 namespace GE
@@ -47,6 +52,42 @@ namespace GE
 			Script
 		};
 
+		/*
+		* Time from GetAssetAsync() to ready, in log2 millisecond buckets
+		* Bucket i counts loads under 2^i ms, last bucket counts everything slower
+		*/
+		struct LoadHistogram
+		{
+			static const uint32_t BucketCount = 12;
+
+			std::array<uint32_t, BucketCount> Buckets = {};
+			uint32_t Count = 0;
+			float MaxMilliseconds = 0.0f;
+
+			void Add(float milliseconds);
+		};
+
+		/*
+		* Last DeserializeAssets()
+		* Resident sizes are of the whole process, see ProcessMemory
+		*/
+		struct LoadStatistics
+		{
+			// Milliseconds
+			float Duration = 0.0f;
+			uint64_t Mapped = 0;
+			// Bytes copied out of the mapping, see BufferStats
+			uint64_t Copied = 0;
+			uint32_t Registered = 0;
+			uint32_t Decoded = 0;
+			// Non-Scene payloads, stored may be compressed. See SetCompression()
+			uint64_t AssetsRaw = 0;
+			uint64_t AssetsStored = 0;
+			// Resident bytes gained while loading, negative if pages were trimmed meanwhile
+			int64_t ResidentGrowth = 0;
+			uint64_t PeakResident = 0;
+		};
+
 		RuntimeAssetManager(const AssetMap& assetMap = AssetMap());
 		virtual ~RuntimeAssetManager() override;
 
@@ -58,6 +99,14 @@ namespace GE
 		*	if handle does not exist or cannot be loaded, returns nullptr asset
 		*/
 		virtual Ref<Asset> GetAsset(UUID handle) override;
+		/*
+		* Returns loaded asset, otherwise placeholder with Asset::Status::Loading
+		*	Decodes on a worker thread, then creates GL/AL objects on the main thread
+		*	Placeholder becomes Asset::Status::Invalid if loading fails
+		*	if handle does not exist, returns nullptr asset
+		*/
+		virtual Ref<Asset> GetAssetAsync(UUID handle) override;
+		const std::map<Asset::Type, LoadHistogram>& GetLoadHistograms() const { return m_LoadHistograms; }
 
 		virtual const AssetMap& GetLoadedAssets() override;
 		/*
@@ -84,6 +133,7 @@ namespace GE
 
 		/*
 		* Uses loaded assets to fill AssetPack & write to .gap(Game Asset Pack) file
+		* Payloads unchanged since the previous build are copied from the previous .gap, see CookCache
 		*/
 		virtual bool SerializeAssets() override;
 		/*
@@ -92,35 +142,145 @@ namespace GE
 		* 1. Scene Size & Data was read
 		* 2. Data was parsed into SceneInfo, filling all appropiate AssetInfo & EntityInfo Buffers.
 		* * - See DeserializeAsset(AssetInfo&) for Scene Asset Type
-		* 3. Those Assets & Entities were also deserialized whole.
-		* * - See Type matched DeserializeAsset(AssetInfo&) & DeserializeEntityFromPack(const EntityInfo&, Entity&)
+		* 3. Those Entities were also deserialized whole.
+		* * - See DeserializeEntityFromPack(const EntityInfo&, Entity&)
+		* Other Assets are only registered, decoded by GetAsset() or GetAssetAsync() on first use.
+		* The .gap file is memory mapped, Pack Buffers view it until AssetPack::ReleaseMapping()
 		*/
 		virtual bool DeserializeAssets() override;
+		const LoadStatistics& GetLoadStats() const { return m_LoadStats; }
+
+		/*
+		* Evicts & trims only while the pack is mapped, assets are reloaded from it
+		*/
+		virtual void UpdateResidency(const std::unordered_set<UUID>& referencedHandles) override;
+		virtual const AssetResidency& GetResidency() override { return m_Residency; }
 
 		Ref<AssetPack> GetPack() { return m_AssetPack; }
 
+		/*
+		* Compress non-Scene payloads on SerializeAssets(), stored uncompressed if it doesn't pay off
+		*/
+		void SetCompression(Compression::Codec codec) { m_Compression = codec; }
+		Compression::Codec GetCompression() const { return m_Compression; }
+		/*
+		* Store Scene Components as columns on SerializeAssets(), see SceneColumns
+		* Otherwise every Component is stored per Entity
+		*/
+		void SetColumnarScenes(bool columnar) { m_ColumnarScenes = columnar; }
+		bool GetColumnarScenes() const { return m_ColumnarScenes; }
+		const CookCache::Statistics& GetCookStats() { return m_CookCache.GetStats(); }
+		/*
+		* Keys of files Assets were imported from, by handle. See CookCache::Entry::SourceKey
+		* On SerializeAssets(), Assets with an unchanged key are copied from the previous pack without serializing them.
+		* Assets without a key, ex. Scenes edited in memory, are serialized & compared by content hash.
+		*/
+		void SetSourceKeys(const std::unordered_map<UUID, uint64_t>& sourceKeys) { m_SourceKeys = sourceKeys; }
+
+		/*
+		* Encodes Entities of scene with the pack Component encoding, without its handle, type or Assets.
+		* Used by the editor's scene cache. Returns false if scene is nullptr
+		*
+		* @param outData : replaced with encoded Entities, see DecodeScene()
+		*/
+		bool EncodeScene(Ref<Scene> scene, ScopedBuffer& outData);
+		/*
+		* Returns new Scene from EncodeScene() data, nullptr if data is invalid.
+		* Script fields are set on Scripting, same as loading a pack
+		*
+		* @param handle : of new Scene
+		*/
+		Ref<Scene> DecodeScene(UUID handle, const uint8_t* data, uint64_t size);
+
 	private:
 		bool SerializeAsset(Ref<Asset> asset, AssetInfo& assetInfo);
+		/*
+		* Returns owned, uncompressed copy of a compressed assetInfo. Releases its data on destruction
+		* Returns nullptr if decompression fails
+		*/
+		static Ref<AssetInfo> InflateAsset(const AssetInfo& assetInfo);
 		Ref<Asset> DeserializeAsset(const AssetInfo& assetInfo);
+		/*
+		* Worker thread safe part of DeserializeAsset(AssetInfo&)
+		* Returns function creating the Asset, run it on the main thread. nullptr if assetInfo is invalid.
+		*/
+		std::function<Ref<Asset>()> DecodeAsset(const AssetInfo& assetInfo);
+		/*
+		* Waits for worker decodes & drops pending loads, they may view the mapping being released
+		*/
+		void CancelAsyncLoads();
+
+		/*
+		* Reads Version 1 Scene Index, packed after the header
+		*/
+		bool DeserializeIndex(const uint8_t*& source, const uint8_t* end);
+		/*
+		* Reads Version 2 - 5 Table of Contents & shared Assets, then all Scenes
+		* See AssetPack::File::TableOfContents
+		*/
+		bool DeserializeContents(const uint8_t* end);
+		/*
+		* Deserializes Scene & its Entities, adds it to Pack & Loaded. Its Assets are registered with the Pack only
+		*/
+		bool DeserializeSceneInfo(SceneInfo& sceneInfo);
 
 		bool SerializeScene(Ref<Asset> asset, AssetInfo& assetInfo);
-		bool SerializeEntity(Ref<Scene>, SceneInfo::EntityInfo& eInfo, const Entity& e);
+		/*
+		* @param arena : backs eInfo data if set, eInfo views it
+		* @param columns : skips Components stored in SceneColumns, eInfo is left empty if only the ID remains
+		*/
+		bool SerializeEntity(Ref<Scene>, SceneInfo::EntityInfo& eInfo, const Entity& e, BufferArena* arena = nullptr, bool columns = false);
 		bool SerializeTexture2D(Ref<Asset> asset, AssetInfo& assetInfo);
 		bool SerializeFont(Ref<Asset> asset, AssetInfo& assetInfo);
 		bool SerializeAudio(Ref<Asset> asset, AssetInfo& assetInfo);
 		bool SerializeScript(Ref<Asset> asset, AssetInfo& assetInfo);
+		bool SerializePrefab(Ref<Asset> asset, AssetInfo& assetInfo);
 
+		/*
+		* Fills SceneInfo Assets & Entities with views into assetInfo data, which must outlive them
+		*/
 		Ref<Asset> DeserializeScene(const AssetInfo& assetInfo);
 		bool DeserializeEntity(Ref<Scene> scene, const SceneInfo::EntityInfo& eInfo, Entity& e);
 		Ref<Asset> DeserializeTexture2D(const AssetInfo& assetInfo);
+		std::function<Ref<Asset>()> DecodeTexture2D(const AssetInfo& assetInfo);
 		Ref<Asset> DeserializeFont(const AssetInfo& assetInfo);
+		std::function<Ref<Asset>()> DecodeFont(const AssetInfo& assetInfo);
 		Ref<Asset> DeserializeAudio(const AssetInfo& assetInfo);
+		std::function<Ref<Asset>()> DecodeAudio(const AssetInfo& assetInfo);
 		Ref<Asset> DeserializeScript(const AssetInfo& assetInfo);
+		Ref<Asset> DeserializePrefab(const AssetInfo& assetInfo);
 
 	private:
 		Ref<AssetPack> m_AssetPack = nullptr;
 		// <uint64_t, Ref<Asset>>
 		AssetMap m_LoadedAssets;
+		AssetResidency m_Residency = AssetResidency();
+		Compression::Codec m_Compression = Compression::Codec::None;
+		bool m_ColumnarScenes = true;
+		CookCache m_CookCache = CookCache();
+		std::unordered_map<UUID, uint64_t> m_SourceKeys = std::unordered_map<UUID, uint64_t>();
+
+		/*
+		* Shared with queued async work, which may outlive this manager
+		* Manager is cleared on destruction, Generation changes when pending loads are cancelled
+		*/
+		struct AsyncState
+		{
+			RuntimeAssetManager* Manager = nullptr;
+			uint64_t Generation = 0;
+			std::atomic<uint32_t> Decoding = 0;
+		};
+		Ref<AsyncState> m_AsyncState = nullptr;
+
+		struct PendingLoad
+		{
+			Ref<Asset> Placeholder = nullptr;
+			std::chrono::steady_clock::time_point Start;
+		};
+		// Main thread only
+		std::unordered_map<UUID, PendingLoad> m_PendingLoads = std::unordered_map<UUID, PendingLoad>();
+		std::map<Asset::Type, LoadHistogram> m_LoadHistograms = std::map<Asset::Type, LoadHistogram>();
+		LoadStatistics m_LoadStats = LoadStatistics();
 	};
 
 }
\ No newline at end of file
@@ -12,13 +12,19 @@ namespace GE
     AudioManager::IDBuffer AudioManager::s_Sources = AudioManager::IDBuffer();
     Ref<AudioDevice> AudioManager::s_Device = nullptr;
 
-    void AudioManager::Init()
+    void AudioManager::Init(API api /*= API::OpenAL*/)
     {
+        AudioManager::s_API = api;
+        if (api == API::None)
+            return;
         AudioManager::s_Device = AudioDevice::Create();
     }
 
     void AudioManager::Shutdown()
     {
+        if (s_API == API::None)
+            return;
+
         for (const auto& id : s_Sources.m_IDBuffer)
             Stop(id);
 
@@ -73,7 +73,10 @@ namespace GE
 		
 		static const std::size_t BUFFER_SIZE = 65536; // 32kb of data in each buffer
 
-		static void Init();
+		/*
+		* @param api : API::None opens no device, Audio Assets keep CPU data only
+		*/
+		static void Init(API api = API::OpenAL);
 		static void Shutdown();
 
 		static void Stop(const uint32_t& sourceID);
@@ -81,14 +81,23 @@ namespace GE
 		if (!LoadProject())
 		{
 			GE_CORE_ERROR("Could not Load Application Project.");
+			p_ExitCode = 1;
 			Close();
 			return;
 		}
 
-		AudioManager::Init();
+		AudioManager::Init(p_Config.Headless ? AudioManager::API::None : AudioManager::API::OpenAL);
 		Scripting::Init();
+		p_WorkerThreads = CreateScope<ThreadPool>();
 		Project::NewAssetManager<RuntimeAssetManager>();
 
+		if (p_Config.Headless)
+		{
+			p_LayerStack = CreateRef<LayerStack>();
+			GE_CORE_INFO("Core Application Constructor Complete. Headless.");
+			return;
+		}
+
 		// Creates Window, Context & Renderer, then Binds Events
 		p_Window = Window::Create(Window::Config(p_Config.Name, Project::GetWidth(), Project::GetHeight(), true, nullptr));
 		p_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
@@ -114,6 +123,8 @@ namespace GE
 	{
 		GE_CORE_INFO("Core Application Destructor Start.");
 		
+		// Finishes queued work before anything it uses shuts down
+		p_WorkerThreads.reset();
 		Scripting::Shutdown();
 		AudioManager::Shutdown();
 		Project::Shutdown();
@@ -125,6 +136,9 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
+		if (p_Config.Headless)
+			return;
+
 		while (p_Running)
 		{
 			{
@@ -135,6 +149,8 @@ namespace GE
 			}
 
 			ExecuteMainThread();
+			// Evicts after async loads have landed
+			Project::UpdateAssets();
 
 			if (!p_Minimized)
 			{
@@ -286,8 +302,13 @@ namespace GE
 #pragma region Project Handling
 	bool Application::LoadProject() const
 	{
-		if (p_Config.Args.Count < 1)
+		if (p_Config.Args.Count < 2)
 		{
+			if (p_Config.Headless)
+			{
+				GE_CORE_ERROR("Application::LoadProject - Project file path not found at index 1.");
+				return false;
+			}
 			GE_CORE_WARN("Application::LoadProject - Project file path not found at index 1. \n\tTrying Load from File Dialog.");
 			return LoadProjectFileDialog();
 		}
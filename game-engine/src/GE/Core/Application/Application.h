@@ -9,6 +9,7 @@
 #include "GE/Core/Events/ApplicationEvent.h"
 #include "GE/Core/Input/Input.h"
 #include "GE/Core/Memory/Thread.h"
+#include "GE/Core/Memory/ThreadPool.h"
 
 #include "GE/Rendering/Framebuffers/Framebuffer.h"
 
@@ -33,6 +34,11 @@ namespace GE
 		{
 			std::string Name = "Game Engine";
 			std::string WorkingDirectory;
+			/*
+			* No Window, Framebuffer, Renderer or Audio device. Run() does nothing
+			* Textures & Audio keep CPU data only, example tools building Asset Packs
+			*/
+			bool Headless = false;
 
 			// Args[1]: project path
 			CommandLineArgs Args;
@@ -46,6 +52,10 @@ namespace GE
 		inline static void LoadAppProjectFileDialog() { s_Instance->LoadProjectFileDialog(); }
 
 		inline static void SubmitToMainAppThread(const std::function<void()>& func) { s_Instance->AddToMainThread(func); }
+		/*
+		* Runs func on a worker thread. No GL/AL calls, submit those back to the main thread
+		*/
+		inline static void SubmitToWorkerThread(const std::function<void()>& func) { s_Instance->p_WorkerThreads->Add(func); }
 
 		static const Timestep& GetTimestep() { return s_Instance->p_TS; }
 		inline static Ref<LayerStack> GetLayerStack() { return s_Instance->p_LayerStack; }
@@ -98,14 +108,17 @@ namespace GE
 	public:
 		/*
 		* Creates Window, debug Layer and Project with RuntimeAssetManager
+		* Headless creates Project, Scripting & worker threads only
 		*/
 		Application(const Config& config);
 		virtual ~Application();
 
 		inline const Config& GetConfig() const { return p_Config; };
+		// Returned from main, non-zero on failure
+		inline int GetExitCode() const { return p_ExitCode; }
 
 		// Updates Timestep and Layers 
-		void Run();
+		virtual void Run();
 		void Close();
 
 	protected:
@@ -159,6 +172,7 @@ namespace GE
 
 		bool p_Running = true;
 		bool p_Minimized = false;
+		int p_ExitCode = 0;
 
 		Timestep p_TS;
 		float p_LastFrameTime = 0.0f;
@@ -166,6 +180,7 @@ namespace GE
 		Ref<Framebuffer> p_Framebuffer = nullptr;
 
 		Thread p_MainThread;
+		Scope<ThreadPool> p_WorkerThreads = nullptr;
 	private:
 		static Application* s_Instance;
 	};
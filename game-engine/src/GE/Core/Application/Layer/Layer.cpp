@@ -24,6 +24,103 @@ namespace GE
 		GE_PROFILE_FUNCTION();
 	}
 
+	/*
+	* Adds static sprites of entity & its children that would be rendered to batches, by texture handle & world Z.
+	* Mirrors Layer::RenderEntity, so inactive/hidden parents hide static children.
+	* 
+	* @param loadingHandles : textures still loading, baked untextured until loaded
+	*/
+	static void CollectStatic(Ref<Scene> scene, Entity entity, uint64_t layerID, const glm::vec3& translationOffset, const glm::vec3& rotationOffset,
+		std::map<std::pair<uint64_t, float>, Ref<StaticBatch>>& batches, std::unordered_set<UUID>& loadingHandles)
+	{
+		if (!entity)
+			return;
+
+		auto& ac = scene->GetComponent<ActiveComponent>(entity);
+		auto& rc = scene->GetComponent<RenderComponent>(entity);
+		if ((!ac.Active || ac.Hidden) || !rc.IDHandled(layerID))
+			return;
+
+		auto& trsc = scene->GetComponent<TransformComponent>(entity);
+		if (scene->IsStatic(entity))
+		{
+			auto& src = scene->GetComponent<SpriteRendererComponent>(entity);
+			// Split by Z, so each batch is depth sorted with dynamic quads as one
+			const glm::mat4 transform = trsc.GetTransform(translationOffset, rotationOffset);
+			const float z = transform[3].z;
+			Ref<StaticBatch>& batch = batches[{ (uint64_t)src.AssetHandle, z }];
+			if (!batch)
+			{
+				// Untextured placeholder while texture loads, like Renderer::Draw
+				Ref<Texture2D> texture = src.AssetHandle ? Project::GetAssetAsync<Texture2D>(src.AssetHandle) : nullptr;
+				if (!texture && Project::IsAssetLoading(src.AssetHandle))
+					loadingHandles.insert(src.AssetHandle);
+				batch = Renderer::CreateStaticBatch(texture, z);
+			}
+			Renderer::AddStatic(batch, transform, trsc.GetPivot(), src, entity);
+		}
+
+		auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
+		const glm::vec3 childTranslationOffset = translationOffset + trsc.Translation;
+		const glm::vec3 childRotationOffset = rotationOffset + trsc.Rotation;
+		for (const UUID& childID : rsc.GetChildren())
+			CollectStatic(scene, scene->GetEntityByUUID(childID), layerID, childTranslationOffset, childRotationOffset, batches, loadingHandles);
+	}
+
+	bool Layer::InView(const std::pair<glm::vec2, glm::vec2>& bounds) const
+	{
+		return bounds.first.x <= p_ViewBounds.second.x && bounds.second.x >= p_ViewBounds.first.x
+			&& bounds.first.y <= p_ViewBounds.second.y && bounds.second.y >= p_ViewBounds.first.y;
+	}
+
+	void Layer::MarkVisibleSubtree(Ref<Scene> scene, Entity entity)
+	{
+		// Stops at first ancestor already marked, its own ancestors are too
+		while (entity && p_VisibleSubtrees.insert((uint32_t)entity).second)
+		{
+			auto& idc = scene->GetComponent<IDComponent>(entity);
+			auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
+			if (idc.ID == rsc.GetParent()) // Is Parent
+				break;
+			entity = scene->GetEntityByUUID(rsc.GetParent());
+		}
+	}
+
+	bool Layer::StaticTextureLoaded() const
+	{
+		for (const UUID& handle : p_StaticLoadingHandles)
+		{
+			if (!Project::IsAssetLoading(handle))
+				return true;
+		}
+		return false;
+	}
+
+	void Layer::BakeStatic(Ref<Scene> scene)
+	{
+		GE_PROFILE_FUNCTION();
+
+		p_StaticBatches.clear();
+		p_StaticLoadingHandles.clear();
+		p_StaticRevision = scene->GetStaticRevision();
+
+		std::map<std::pair<uint64_t, float>, Ref<StaticBatch>> batches = std::map<std::pair<uint64_t, float>, Ref<StaticBatch>>();
+		std::vector<Entity> entities = scene->GetAllRenderEntities(p_Config.ID);
+		for (Entity entity : entities)
+		{
+			auto& idc = scene->GetComponent<IDComponent>(entity);
+			auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
+			if (idc.ID == rsc.GetParent()) // Is Parent
+				CollectStatic(scene, entity, p_Config.ID, glm::vec3(0.0f), glm::vec3(0.0f), batches, p_StaticLoadingHandles);
+		}
+
+		for (auto& [handle, batch] : batches)
+		{
+			Renderer::BakeStatic(batch);
+			p_StaticBatches.push_back(batch);
+		}
+	}
+
 	void Layer::RenderEntity(Ref<Scene> scene, Entity entity, glm::vec3& translationOffset, glm::vec3& rotationOffset)
 	{
 		GE_PROFILE_FUNCTION();
@@ -37,39 +134,55 @@ namespace GE
 			return; // Entity; 1: Shouldn't be rendered. 2: Should be active && visible. 3: Should handle current LayerID
 
 		auto& trsc = scene->GetComponent<TransformComponent>(entity);
+		auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
+
+		// Skip self & children when nothing in subtree is inside of camera
+		if (p_VisibleSubtrees.find((uint32_t)entity) == p_VisibleSubtrees.end())
+			return;
 
 		// First, render self/parent
-		if (scene->HasComponent<SpriteRendererComponent>(entity))
+		// Static sprites are drawn from p_StaticBatches
+		const bool isStatic = scene->IsStatic(entity);
+		if ((scene->HasComponent<SpriteRendererComponent>(entity) && !isStatic) || scene->HasComponent<CircleRendererComponent>(entity))
 		{
-			auto& src = scene->GetComponent<SpriteRendererComponent>(entity);
-			Renderer::Draw(trsc.GetTransform(translationOffset, rotationOffset), trsc.GetPivot(), src, entity);
-			rc.Rendered = true;
-		}
+			if (p_VisibleEntities.find((uint32_t)entity) != p_VisibleEntities.end())
+			{
+				if (scene->HasComponent<SpriteRendererComponent>(entity) && !isStatic)
+				{
+					auto& src = scene->GetComponent<SpriteRendererComponent>(entity);
+					Renderer::Draw(trsc.GetTransform(translationOffset, rotationOffset), trsc.GetPivot(), src, entity);
+				}
 
-		if (scene->HasComponent<CircleRendererComponent>(entity))
-		{
-			auto& crc = scene->GetComponent<CircleRendererComponent>(entity);
-			Renderer::Draw(trsc.GetTransform(translationOffset, rotationOffset), trsc.GetPivot(), crc, entity);
+				if (scene->HasComponent<CircleRendererComponent>(entity))
+				{
+					auto& crc = scene->GetComponent<CircleRendererComponent>(entity);
+					Renderer::Draw(trsc.GetTransform(translationOffset, rotationOffset), trsc.GetPivot(), crc, entity);
+				}
+				Renderer::CountEntities(1, 0);
+			}
 			rc.Rendered = true;
 		}
+		else if (isStatic)
+			rc.Rendered = true;
 
 		if (scene->HasComponent<TextRendererComponent>(entity))
 		{
 			auto& trc = scene->GetComponent<TextRendererComponent>(entity);
 			Renderer::Draw(trsc.GetTransform(translationOffset, rotationOffset), trc, entity);
+			Renderer::CountEntities(1, 0);
 			rc.Rendered = true;
 		}
 
 		// Then, render children offset from self/parent
-		auto& rsc = scene->GetComponent<RelationshipComponent>(entity);
+		// Copies offsets, siblings shouldn't inherit each others offsets
 		if (!rsc.GetChildren().empty())
 		{
-			translationOffset += trsc.Translation;
-			rotationOffset += trsc.Rotation;
+			glm::vec3 childTranslationOffset = translationOffset + trsc.Translation;
+			glm::vec3 childRotationOffset = rotationOffset + trsc.Rotation;
 			for (const UUID& childID : rsc.GetChildren())
 			{
 				Entity childEntity = scene->GetEntityByUUID(childID);
-				RenderEntity(scene, childEntity, translationOffset, rotationOffset);
+				RenderEntity(scene, childEntity, childTranslationOffset, childRotationOffset);
 			}
 		}
 
@@ -109,9 +222,45 @@ namespace GE
 
 		if (scene && camera)
 		{
+			p_ViewBounds = camera->GetBounds();
+			if (p_StaticRevision != scene->GetStaticRevision() || StaticTextureLoaded())
+				BakeStatic(scene);
+
 			Renderer::Open(camera);
 
+			// Static batches are depth sorted with dynamic sprites at Renderer::Close(), under sprites of equal depth
+			for (Ref<StaticBatch> batch : p_StaticBatches)
+			{
+				if (InView(batch->Bounds))
+				{
+					Renderer::DrawStatic(batch);
+					Renderer::CountEntities(batch->SpawnCount, 0);
+				}
+				else
+					Renderer::CountEntities(0, batch->SpawnCount);
+			}
+
 			std::vector<Entity> entities = scene->GetAllRenderEntities(p_Config.ID);
+
+			// Entities inside of camera are found by Scene::GetSpatialIndex(),
+			// then subtrees containing them are marked once, bottom-up, before rendering
+			p_VisibleEntities.clear();
+			p_VisibleSubtrees.clear();
+			const SceneSpatialIndex& spatialIndex = scene->GetSpatialIndex();
+			std::vector<Entity> inView = std::vector<Entity>();
+			spatialIndex.QueryAABB(p_ViewBounds, inView);
+			for (Entity entity : inView)
+			{
+				if (!scene->EntityExists(entity))
+					continue;
+				p_VisibleEntities.insert((uint32_t)entity);
+				MarkVisibleSubtree(scene, entity);
+			}
+			// Text can't be bounded, always rendered
+			for (Entity entity : scene->GetAllEntitiesWith<TextRendererComponent>())
+				MarkVisibleSubtree(scene, entity);
+
+			uint32_t culledCount = 0;
 			for (Entity entity : entities)
 			{
 				auto& idc = scene->GetComponent<IDComponent>(entity);
@@ -120,7 +269,17 @@ namespace GE
 				{
 					Layer::RenderEntity(scene, entity, glm::vec3(0.0f), glm::vec3(0.0f));
 				}
+
+				// Only dynamic Sprites & Circles this Layer would draw, static sprites are counted by batch
+				if (p_VisibleEntities.find((uint32_t)entity) != p_VisibleEntities.end())
+					continue;
+				auto& ac = scene->GetComponent<ActiveComponent>(entity);
+				if (!ac.Active || ac.Hidden)
+					continue;
+				if ((scene->HasComponent<SpriteRendererComponent>(entity) && !scene->IsStatic(entity)) || scene->HasComponent<CircleRendererComponent>(entity))
+					culledCount++;
 			}
+			Renderer::CountEntities(0, culledCount);
 
 			entities.clear();
 			entities = std::vector<Entity>();
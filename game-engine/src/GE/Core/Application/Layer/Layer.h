@@ -4,6 +4,7 @@
 #include "GE/Core/Events/MouseEvent.h"
 
 #include "GE/Rendering/Camera/Camera.h"
+#include "GE/Rendering/Renderer/StaticBatch.h"
 
 namespace GE
 {
@@ -54,6 +55,32 @@ namespace GE
 		* @param rotationOffset : offset from entity to parent
 		*/
 		virtual void RenderEntity(Ref<Scene> scene, Entity entity, glm::vec3& translationOffset, glm::vec3& rotationOffset);
+		
+		/*
+		* Returns true if world bounds intersect camera bounds from the last OnRender(Ref<Scene>, const Camera*&).
+		*
+		* @param bounds : world min & max bounds
+		*/
+		bool InView(const std::pair<glm::vec2, glm::vec2>& bounds) const;
+		/*
+		* Adds entity & its ancestors to p_VisibleSubtrees, so RenderEntity(Ref<Scene>, Entity, glm::vec3&, glm::vec3&) walks down to it.
+		*
+		* @param scene : runtime scene
+		* @param entity : entity inside camera bounds, or one that can't be bounded, ex. Text
+		*/
+		void MarkVisibleSubtree(Ref<Scene> scene, Entity entity);
+		/*
+		* Rebuilds p_StaticBatches from static sprites this Layer handles, one batch per texture & world Z.
+		* Called by OnRender(Ref<Scene>, const Camera*&) when Scene::GetStaticRevision() changes.
+		*
+		* @param scene : runtime scene
+		*/
+		void BakeStatic(Ref<Scene> scene);
+		/*
+		* Returns true if a texture p_StaticBatches were baked without has finished loading.
+		* Checked by OnRender(Ref<Scene>, const Camera*&), rebakes so it's used.
+		*/
+		bool StaticTextureLoaded() const;
 		virtual void OnAttach(Ref<Scene> scene);
 		virtual void OnDetach();
 
@@ -76,6 +103,17 @@ namespace GE
 		virtual bool OnMouseScrolled(MouseScrolledEvent& e);
 	protected:
 		Config p_Config = Config();
+		// World min & max bounds of camera, set in OnRender(Ref<Scene>, const Camera*&)
+		std::pair<glm::vec2, glm::vec2> p_ViewBounds = std::pair<glm::vec2, glm::vec2>(glm::vec2(-FLT_MAX), glm::vec2(FLT_MAX));
+		// Entities & subtrees with one inside p_ViewBounds, set in OnRender(Ref<Scene>, const Camera*&)
+		std::unordered_set<uint32_t> p_VisibleEntities = std::unordered_set<uint32_t>();
+		std::unordered_set<uint32_t> p_VisibleSubtrees = std::unordered_set<uint32_t>();
+
+		std::vector<Ref<StaticBatch>> p_StaticBatches = std::vector<Ref<StaticBatch>>();
+		// Scene::GetStaticRevision() p_StaticBatches were baked at
+		uint64_t p_StaticRevision = 0;
+		// Textures still loading when p_StaticBatches were baked, see StaticTextureLoaded()
+		std::unordered_set<UUID> p_StaticLoadingHandles = std::unordered_set<UUID>();
 	};
 
 }
\ No newline at end of file
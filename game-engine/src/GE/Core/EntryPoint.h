@@ -21,9 +21,11 @@
 		app->Run();
 		GE_PROFILE_END_SESSION();
 
+		const int exitCode = app->GetExitCode();
 		GE_PROFILE_BEGIN_SESSION("Shutdown", "GE_PROFILE_SHUTDOWN.json");
 		delete app;
 		GE_PROFILE_END_SESSION();
+		return exitCode;
 
 	}
 #endif // GE_PLATFORM_WINDOWS
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GE/Core/Memory/Buffer.h"
+
+#include <filesystem>
+
+namespace GE
+{
+	/*
+	* Read-only memory mapping of a whole file.
+	* Pages are loaded by the OS on first access, nothing is copied on Open.
+	* Views from GetView() are invalid after Close()
+	*/
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+		/*
+		* Maps file at path, closing any previous mapping.
+		* Returns false if file could not be opened or is empty.
+		*/
+		bool Open(const std::filesystem::path& path);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+		const uint8_t* GetData() const { return m_Data; }
+		const uint64_t& GetSize() const { return m_Size; }
+		Buffer GetView() const { return Buffer::View(m_Data, m_Size); }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+
+		// Platform handles
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+	};
+}
@@ -1,6 +1,10 @@
 #pragma once
 #include <stdint.h>
 #include <memory.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
 
 namespace GE
 {
@@ -217,20 +221,254 @@ namespace GE
 		return false;
 	}
 
-	// Non-owning Raw Buffer
+	/*
+	* Returns number of bytes value takes as a varint, see WriteVarint()
+	*/
+	static inline size_t GetVarintSize(uint64_t value)
+	{
+		size_t size = 1;
+		while (value >= 0x80)
+		{
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+
+	/*
+	* Returns packed size equal to a varint length + (dataSize * sizeof(T)).
+	* 
+	* @param dataSize : example vector.size()
+	*/
+	template<typename T>
+	static inline size_t GetPackedOfArray(size_t dataSize)
+	{
+		return GetVarintSize(dataSize) + dataSize * sizeof(T);
+	}
+
+	template<typename T>
+	static inline size_t GetPackedOfVec2() { return sizeof(T) * 2; }
+	template<typename T>
+	static inline size_t GetPackedOfVec3() { return sizeof(T) * 3; }
+	template<typename T>
+	static inline size_t GetPackedOfVec4() { return sizeof(T) * 4; }
+
+	/*
+	* Write unsigned value 7 bits at a time, low bits first. High bit marks another byte follows.
+	* Sizes & counts under 128 take 1 byte
+	*
+	* @param p : write pointer
+	* @param value : value to write
+	*/
+	static inline void WriteVarint(uint8_t*& p, uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			*p++ = (uint8_t)(value | 0x80);
+			value >>= 7;
+		}
+		*p++ = (uint8_t)value;
+	}
+
+	/*
+	* Write primitive type to pointer without padding.
+	* Host byte order, little-endian on supported platforms
+	*
+	* @param p : write pointer
+	* @param var : variable to write
+	*/
+	template<class T>
+	static inline void WritePacked(uint8_t*& p, const T& var)
+	{
+		memcpy(p, &var, sizeof(T));
+		p += sizeof(T);
+	}
+
+	/*
+	*  Write varint array size & data to pointer without padding
+	*
+	* @param p : write pointer
+	* @param var : array to write
+	* @param size : size of var
+	*/
+	template<class T>
+	static inline void WritePackedArray(uint8_t*& p, const T*& var, size_t size)
+	{
+		WriteVarint(p, size);
+		if (size)
+			memcpy(p, var, size * sizeof(T));
+		p += size * sizeof(T);
+	}
+
+	template<class T>
+	static inline void WritePackedVec2(uint8_t*& p, const T& x, const T& y)
+	{
+		WritePacked<T>(p, x);
+		WritePacked<T>(p, y);
+	}
+
+	template<class T>
+	static inline void WritePackedVec3(uint8_t*& p, const T& x, const T& y, const T& z)
+	{
+		WritePacked<T>(p, x);
+		WritePacked<T>(p, y);
+		WritePacked<T>(p, z);
+	}
+
+	template<class T>
+	static inline void WritePackedVec4(uint8_t*& p, const T& x, const T& y, const T& z, const T& w)
+	{
+		WritePacked<T>(p, x);
+		WritePacked<T>(p, y);
+		WritePacked<T>(p, z);
+		WritePacked<T>(p, w);
+	}
+
+	/*
+	* Reads varint from pointer until end-of-pointer, see WriteVarint()
+	*
+	* @param p : read pointer
+	* @param pEnd : end of pointer
+	* @param value : variable to fill
+	*/
+	static inline bool ReadVarint(const uint8_t*& p, const uint8_t* pEnd, uint64_t& value)
+	{
+		value = 0;
+		const uint8_t* cursor = p;
+		for (uint32_t shift = 0; shift < 64; shift += 7)
+		{
+			// Overrun
+			if (cursor >= pEnd)
+				return false;
+
+			const uint8_t byte = *cursor++;
+			value |= (uint64_t)(byte & 0x7F) << shift;
+			if (!(byte & 0x80))
+			{
+				p = cursor;
+				return true;
+			}
+		}
+		// Too long, corrupt
+		return false;
+	}
+
+	/*
+	* Reads unpadded primitive data from pointer until end-of-pointer for type, see WritePacked()
+	*
+	* @param p : read pointer
+	* @param pEnd : end of pointer
+	* @param var : variable to fill
+	*/
+	template<typename T>
+	static inline bool ReadPacked(const uint8_t*& p, const uint8_t* pEnd, T& var)
+	{
+		// Overrun
+		if (p + sizeof(T) > pEnd)
+			return false;
+
+		memcpy(&var, p, sizeof(T));
+		p += sizeof(T);
+		return true;
+	}
+
+	/*
+	* Reads unpadded array data from pointer(p) until end-of-pointer(pEnd), see WritePackedArray()
+	* Use ReadVarint() for size
+	*
+	* @param p : read pointer
+	* @param pEnd : end of pointer
+	* @param var : array to fill, at least size long
+	* @param size : size of data
+	*/
+	template<class T>
+	static inline bool ReadPackedArray(const uint8_t*& p, const uint8_t* pEnd, T* var, const size_t& size)
+	{
+		if (size > (size_t)(pEnd - p) / sizeof(T))
+			return false;
+
+		if (size)
+			memcpy((void*)var, p, size * sizeof(T));
+		p += size * sizeof(T);
+		return true;
+	}
+
+	/*
+	* Bytes copied into owned memory since start, debug stat. See Buffer(const void*, size_t) & ScopedBuffer::Copy()
+	*/
+	struct BufferStats
+	{
+		inline static std::atomic<uint64_t> CopiedBytes = 0;
+		inline static std::atomic<uint64_t> Copies = 0;
+
+		static void AddCopy(size_t size)
+		{
+			CopiedBytes += size;
+			Copies++;
+		}
+	};
+
+	/*
+	* Raw Buffer, owner must Release() it. Copies are shallow & share data.
+	* Moving leaves the source empty. Prefer ScopedBuffer for data with a single owner.
+	*/
 	struct Buffer
 	{
+		friend class ScopedBuffer;
 	private:
 		size_t m_Size = 0;
 		uint8_t* m_Data = nullptr;
+		// Data belongs to someone else, see View()
+		bool m_View = false;
 	
 	public:
 		operator bool() const { return (bool)m_Data; }
+
+		/*
+		* Returns Buffer pointing at data without copying it.
+		* Release() will not free data, it must outlive the view. Treat as read-only.
+		* 
+		* @param data : memory to view, example mapped file
+		* @param size : size of data
+		*/
+		static Buffer View(const void* data, size_t size)
+		{
+			Buffer buffer = Buffer();
+			buffer.m_Data = (uint8_t*)data;
+			buffer.m_Size = size;
+			buffer.m_View = true;
+			return buffer;
+		}
 		
 		template<typename T>
 		T* As() const { return (T*)m_Data; }
 
 		Buffer() = default;
+		Buffer(const Buffer&) = default;
+		Buffer& operator=(const Buffer&) = default;
+
+		Buffer(Buffer&& other) noexcept
+			: m_Size(other.m_Size), m_Data(other.m_Data), m_View(other.m_View)
+		{
+			other.m_Size = 0;
+			other.m_Data = nullptr;
+			other.m_View = false;
+		}
+
+		// Like copy assignment, previous data is not released
+		Buffer& operator=(Buffer&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_Size = other.m_Size;
+				m_Data = other.m_Data;
+				m_View = other.m_View;
+				other.m_Size = 0;
+				other.m_Data = nullptr;
+				other.m_View = false;
+			}
+			return *this;
+		}
 		
 		Buffer(size_t size)
 		{
@@ -238,32 +476,338 @@ namespace GE
 		}
 
 		Buffer(const void* data, size_t size)
-			: Buffer(size)
 		{
-			if(data != nullptr && m_Size >= size)
+			// Zero-filled only if there's nothing to copy
+			Allocate(size, data == nullptr);
+			if (data != nullptr && m_Data)
+			{
 				memcpy(m_Data, data, m_Size);
+				BufferStats::AddCopy(m_Size);
+			}
 		}
 
-		void Allocate(size_t size)
+		/*
+		* @param size : bytes to allocate
+		* @param zero : false leaves data uninitialized, use when it's about to be overwritten
+		*/
+		void Allocate(size_t size, bool zero = true)
 		{
 			Release();
+			// Stays empty, Buffer DataBuffer = 0 shouldn't allocate
+			if (!size)
+				return;
 
 			m_Data = (uint8_t*)malloc(size * sizeof(uint8_t));
 			m_Size = size;
-			memset(As<void>(), 0, size);
+			if (zero && m_Data)
+				memset(As<void>(), 0, size);
 		}
 
 		void Release()
 		{
 			if (m_Data)
 			{
-				free((void*)m_Data);
+				if (!m_View)
+					free((void*)m_Data);
 				m_Data = nullptr;
 				m_Size = 0;
+				m_View = false;
 			}
 		}
 
+		/*
+		* Copies viewed data into an allocation owned by this Buffer.
+		* Does nothing if Buffer already owns its data.
+		*/
+		void Detach()
+		{
+			if (m_View)
+				*this = Buffer(m_Data, m_Size);
+		}
+
 		const std::size_t& GetSize() const { return m_Size; }
+		bool IsView() const { return m_View; }
+
+	};
+
+	/*
+	* Bump allocator for short-lived buffers that are freed together, example Entity data while building a pack.
+	* Allocations are uninitialized & aligned to BYTE_ALIGNMENT, memory is only freed by Reset() or destruction.
+	*/
+	class BufferArena
+	{
+	public:
+		BufferArena(size_t blockSize = 64 * 1024) : m_BlockSize(blockSize) {}
+		~BufferArena() { Reset(); }
+
+		BufferArena(const BufferArena&) = delete;
+		BufferArena& operator=(const BufferArena&) = delete;
+
+		uint8_t* Allocate(size_t size)
+		{
+			size = GetAligned(size);
+			if (m_Blocks.empty() || size > m_Capacity - m_Offset)
+			{
+				// Larger requests get a block of their own
+				m_Capacity = std::max(m_BlockSize, size);
+				m_Blocks.push_back((uint8_t*)malloc(m_Capacity));
+				m_Offset = 0;
+			}
+
+			uint8_t* data = m_Blocks.back() + m_Offset;
+			m_Offset += size;
+			m_Used += size;
+			return data;
+		}
+
+		void Reset()
+		{
+			for (uint8_t* block : m_Blocks)
+				free(block);
+			m_Blocks.clear();
+			m_Capacity = 0;
+			m_Offset = 0;
+			m_Used = 0;
+		}
+
+		size_t GetUsed() const { return m_Used; }
+		size_t GetBlockCount() const { return m_Blocks.size(); }
+
+	private:
+		std::vector<uint8_t*> m_Blocks = std::vector<uint8_t*>();
+		size_t m_BlockSize = 0;
+		size_t m_Capacity = 0;
+		size_t m_Offset = 0;
+		size_t m_Used = 0;
+	};
+
+	/*
+	* Owning, move-only Buffer. Data is freed on destruction, copies are explicit & counted in BufferStats.
+	* Allocations are uninitialized. If backed by a BufferArena, the arena owns the memory & must outlive it.
+	*/
+	class ScopedBuffer
+	{
+	public:
+		ScopedBuffer() = default;
+
+		explicit ScopedBuffer(size_t size, BufferArena* arena = nullptr)
+		{
+			Allocate(size, arena);
+		}
+
+		ScopedBuffer(const ScopedBuffer&) = delete;
+		ScopedBuffer& operator=(const ScopedBuffer&) = delete;
+
+		ScopedBuffer(ScopedBuffer&& other) noexcept
+			: m_Size(other.m_Size), m_Data(other.m_Data), m_Arena(other.m_Arena)
+		{
+			other.m_Size = 0;
+			other.m_Data = nullptr;
+			other.m_Arena = nullptr;
+		}
+
+		ScopedBuffer& operator=(ScopedBuffer&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				m_Size = other.m_Size;
+				m_Data = other.m_Data;
+				m_Arena = other.m_Arena;
+				other.m_Size = 0;
+				other.m_Data = nullptr;
+				other.m_Arena = nullptr;
+			}
+			return *this;
+		}
+
+		~ScopedBuffer() { Release(); }
+
+		/*
+		* Returns owned copy of data
+		*
+		* @param data : memory to copy, example view of a mapped file
+		* @param size : size of data
+		*/
+		static ScopedBuffer Copy(const void* data, size_t size)
+		{
+			ScopedBuffer buffer = ScopedBuffer(size);
+			if (data && buffer.m_Data)
+			{
+				memcpy(buffer.m_Data, data, size);
+				BufferStats::AddCopy(size);
+			}
+			return buffer;
+		}
+
+		/*
+		* Takes ownership of data without copying
+		*
+		* @param data : allocated with malloc(), example stbi_load()
+		* @param size : size of data
+		*/
+		static ScopedBuffer Adopt(void* data, size_t size)
+		{
+			ScopedBuffer buffer = ScopedBuffer();
+			buffer.m_Data = (uint8_t*)data;
+			buffer.m_Size = data ? size : 0;
+			return buffer;
+		}
+
+		void Allocate(size_t size, BufferArena* arena = nullptr)
+		{
+			Release();
+			if (!size)
+				return;
+
+			m_Data = arena ? arena->Allocate(size) : (uint8_t*)malloc(size);
+			m_Size = m_Data ? size : 0;
+			m_Arena = arena;
+		}
+
+		void Release()
+		{
+			if (m_Data && !m_Arena)
+				free((void*)m_Data);
+			m_Data = nullptr;
+			m_Size = 0;
+			m_Arena = nullptr;
+		}
+
+		/*
+		* Returns Buffer owning the data, leaving this empty.
+		* Arena backed data is copied, the arena still owns it.
+		*/
+		Buffer Detach()
+		{
+			Buffer buffer = Buffer();
+			if (m_Arena)
+				buffer = Buffer(m_Data, m_Size);
+			else
+			{
+				buffer.m_Data = m_Data;
+				buffer.m_Size = m_Size;
+				m_Data = nullptr;
+			}
+			Release();
+			return buffer;
+		}
+
+		/*
+		* Returns Buffer viewing the data, valid until this is released
+		*/
+		Buffer GetView() const { return Buffer::View(m_Data, m_Size); }
+
+		template<typename T>
+		T* As() const { return (T*)m_Data; }
+
+		size_t GetSize() const { return m_Size; }
+		explicit operator bool() const { return (bool)m_Data; }
+
+	private:
+		size_t m_Size = 0;
+		uint8_t* m_Data = nullptr;
+		BufferArena* m_Arena = nullptr;
+	};
+
+	/*
+	* Views Aligned byte array data from pointer(p) until end-of-pointer(pEnd) without copying
+	* Use ReadAligned() for size
+	* Viewed data must outlive var, see Buffer::View()
+	*
+	* @param p : read pointer
+	* @param pEnd : end of pointer
+	* @param var : buffer to point at data
+	* @param size : size of data
+	*/
+	static inline bool ReadAlignedView(const uint8_t*& p, const uint8_t* pEnd, Buffer& var, const size_t& size)
+	{
+		// Checks if valid
+		if ((intptr_t)size <= 0 ||
+			(p + size) > pEnd)
+			return false;
+
+		var = Buffer::View(p, size);
+		p += GetAligned(size);
+
+		return true;
+	}
+
+	/*
+	* Bounds-checked reader over packed or aligned data, every read fails instead of overrunning.
+	* Packed : fields unpadded, sizes as varints. See WritePacked() & WriteVarint()
+	* Aligned : fields padded to BYTE_ALIGNMENT, sizes as uint64_t. See WriteAligned()
+	*/
+	class BufferReader
+	{
+	public:
+		BufferReader(const uint8_t* data, const uint8_t* end, bool packed)
+			: m_Position(data), m_End(end), m_Packed(packed)
+		{
+
+		}
+
+		inline bool IsPacked() const { return m_Packed; }
+		inline bool IsEnd() const { return m_Position >= m_End; }
+		inline const uint8_t* GetPosition() const { return m_Position; }
+		inline size_t GetRemaining() const { return IsEnd() ? 0 : (size_t)(m_End - m_Position); }
 
+		template<typename T>
+		bool Read(T& var)
+		{
+			return m_Packed ? ReadPacked<T>(m_Position, m_End, var) : ReadAligned<T>(m_Position, m_End, var);
+		}
+
+		/*
+		* Reads array size or count.
+		* Fails if larger than remaining bytes, guards allocations from corrupt data
+		*/
+		bool ReadSize(uint64_t& size)
+		{
+			const uint8_t* position = m_Position;
+			bool success = m_Packed ? ReadVarint(position, m_End, size) : ReadAligned<uint64_t>(position, m_End, size);
+			if (!success || size > (uint64_t)(m_End - position))
+				return false;
+
+			m_Position = position;
+			return true;
+		}
+
+		/*
+		* @param var : array to fill, at least size long
+		* @param size : from ReadSize()
+		*/
+		template<typename T>
+		bool ReadArray(T* var, size_t size)
+		{
+			return m_Packed ? ReadPackedArray<T>(m_Position, m_End, var, size) : ReadAlignedArray<T>(m_Position, m_End, var, size);
+		}
+
+		/*
+		* Views size bytes without copying, see Buffer::View()
+		*/
+		bool ReadView(Buffer& var, size_t size)
+		{
+			if (!m_Packed)
+				return ReadAlignedView(m_Position, m_End, var, size);
+
+			if (size > GetRemaining())
+				return false;
+			var = Buffer::View(m_Position, size);
+			m_Position += size;
+			return true;
+		}
+
+		template<typename T>
+		bool ReadVec2(T& x, T& y) { return Read<T>(x) && Read<T>(y); }
+		template<typename T>
+		bool ReadVec3(T& x, T& y, T& z) { return Read<T>(x) && Read<T>(y) && Read<T>(z); }
+		template<typename T>
+		bool ReadVec4(T& x, T& y, T& z, T& w) { return Read<T>(x) && Read<T>(y) && Read<T>(z) && Read<T>(w); }
+
+	private:
+		const uint8_t* m_Position = nullptr;
+		const uint8_t* m_End = nullptr;
+		bool m_Packed = true;
 	};
 }
\ No newline at end of file
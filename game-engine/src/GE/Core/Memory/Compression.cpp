@@ -0,0 +1,337 @@
+#include "GE/GEpch.h"
+
+#include "Compression.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace GE
+{
+	static constexpr uint32_t s_RawBlockFlag = 0x80000000;
+	static constexpr size_t s_MinMatch = 4;
+	static constexpr size_t s_MaxOffset = 0xFFFF;
+	static constexpr uint32_t s_HashBits = 14;
+
+	static inline uint32_t Read32(const uint8_t* p)
+	{
+		uint32_t value = 0;
+		memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	static inline uint32_t Hash(uint32_t sequence)
+	{
+		return (sequence * 2654435761u) >> (32 - s_HashBits);
+	}
+
+	/*
+	* Writes 15 + 255 * n + remainder length extension
+	*/
+	static inline void WriteLength(uint8_t*& op, size_t length)
+	{
+		length -= 15;
+		while (length >= 255)
+		{
+			*op++ = 255;
+			length -= 255;
+		}
+		*op++ = (uint8_t)length;
+	}
+
+	static inline bool ReadLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+	{
+		uint8_t byte = 0;
+		do
+		{
+			if (ip >= iend)
+				return false;
+			byte = *ip++;
+			length += byte;
+		} while (byte == 255);
+		return true;
+	}
+
+	/*
+	* Writes one sequence, literals followed by a match. matchLength of 0 ends the block
+	*/
+	static inline bool WriteSequence(uint8_t*& op, const uint8_t* oend, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+	{
+		// Token, length extensions, literals & offset, conservative
+		const size_t worstSize = 1 + (literalLength / 255 + 1) + literalLength + 2 + (matchLength / 255 + 1);
+		if (worstSize > (size_t)(oend - op))
+			return false;
+
+		uint8_t* token = op++;
+		*token = (uint8_t)(std::min<size_t>(literalLength, 15) << 4);
+		if (literalLength >= 15)
+			WriteLength(op, literalLength);
+		memcpy(op, literals, literalLength);
+		op += literalLength;
+
+		if (matchLength)
+		{
+			*op++ = (uint8_t)(offset & 0xFF);
+			*op++ = (uint8_t)(offset >> 8);
+
+			const size_t length = matchLength - s_MinMatch;
+			*token |= (uint8_t)std::min<size_t>(length, 15);
+			if (length >= 15)
+				WriteLength(op, length);
+		}
+		return true;
+	}
+
+	size_t Compression::CompressBlock(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity)
+	{
+		// Position + 1 of last sequence per hash, 0 is empty
+		std::vector<uint32_t> table = std::vector<uint32_t>((size_t)1 << s_HashBits, 0);
+
+		uint8_t* op = destination;
+		const uint8_t* oend = destination + capacity;
+		size_t anchor = 0;
+		size_t ip = 0;
+		while (ip + s_MinMatch <= size)
+		{
+			const uint32_t sequence = Read32(source + ip);
+			uint32_t& entry = table[Hash(sequence)];
+			const size_t candidate = entry;
+			entry = (uint32_t)ip + 1;
+
+			if (!candidate || ip - (candidate - 1) > s_MaxOffset || Read32(source + candidate - 1) != sequence)
+			{
+				ip++;
+				continue;
+			}
+
+			const size_t match = candidate - 1;
+			size_t length = s_MinMatch;
+			while (ip + length < size && source[match + length] == source[ip + length])
+				length++;
+
+			if (!WriteSequence(op, oend, source + anchor, ip - anchor, ip - match, length))
+				return 0;
+
+			ip += length;
+			anchor = ip;
+		}
+
+		if (!WriteSequence(op, oend, source + anchor, size - anchor, 0, 0))
+			return 0;
+		return op - destination;
+	}
+
+	bool Compression::DecompressBlock(const uint8_t* source, size_t size, uint8_t* destination, size_t rawSize)
+	{
+		const uint8_t* ip = source;
+		const uint8_t* iend = source + size;
+		uint8_t* op = destination;
+		const uint8_t* oend = destination + rawSize;
+
+		while (ip < iend)
+		{
+			const uint8_t token = *ip++;
+
+			size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(ip, iend, literalLength))
+				return false;
+			if (literalLength > (size_t)(iend - ip) || literalLength > (size_t)(oend - op))
+				return false;
+			memcpy(op, ip, literalLength);
+			ip += literalLength;
+			op += literalLength;
+
+			// Last sequence has no match
+			if (ip == iend)
+				break;
+
+			if (iend - ip < 2)
+				return false;
+			const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+			ip += 2;
+			if (offset == 0 || offset > (size_t)(op - destination))
+				return false;
+
+			size_t matchLength = token & 0x0F;
+			if (matchLength == 15 && !ReadLength(ip, iend, matchLength))
+				return false;
+			matchLength += s_MinMatch;
+			if (matchLength > (size_t)(oend - op))
+				return false;
+
+			// May overlap, repeats the last offset bytes
+			const uint8_t* match = op - offset;
+			for (size_t i = 0; i < matchLength; i++)
+				op[i] = match[i];
+			op += matchLength;
+		}
+		return op == oend;
+	}
+
+	Buffer Compression::Compress(const Buffer& source, Codec codec /*= Codec::LZ*/)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const size_t size = source.GetSize();
+		if (codec != Codec::LZ || !size)
+			return Buffer();
+
+		const uint64_t blockCount = (size + BlockSize - 1) / BlockSize;
+		// Every block can fall back to raw, never larger than this
+		std::vector<uint8_t> stream = std::vector<uint8_t>(size + blockCount * sizeof(uint32_t));
+		std::vector<uint8_t> block = std::vector<uint8_t>(BlockSize);
+
+		size_t streamSize = 0;
+		for (uint64_t i = 0; i < blockCount; i++)
+		{
+			const uint8_t* blockSource = source.As<uint8_t>() + i * BlockSize;
+			const size_t blockSize = std::min<size_t>(BlockSize, size - i * BlockSize);
+
+			uint32_t header = 0;
+			size_t compressedSize = CompressBlock(blockSource, blockSize, block.data(), blockSize);
+			if (compressedSize && compressedSize < blockSize)
+				header = (uint32_t)compressedSize;
+			else
+				header = (uint32_t)blockSize | s_RawBlockFlag;
+
+			memcpy(stream.data() + streamSize, &header, sizeof(header));
+			streamSize += sizeof(header);
+			if (header & s_RawBlockFlag)
+			{
+				memcpy(stream.data() + streamSize, blockSource, blockSize);
+				streamSize += blockSize;
+			}
+			else
+			{
+				memcpy(stream.data() + streamSize, block.data(), compressedSize);
+				streamSize += compressedSize;
+			}
+		}
+
+		if (streamSize > size - size / 8)
+			return Buffer();
+		return Buffer(stream.data(), streamSize);
+	}
+
+	bool Compression::Decompress(const Buffer& source, Codec codec, Buffer& destination, const Submit& submit /*= nullptr*/)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const size_t rawSize = destination.GetSize();
+		if (codec == Codec::None)
+		{
+			if (source.GetSize() != rawSize)
+				return false;
+			memcpy(destination.As<void>(), source.As<void>(), rawSize);
+			return true;
+		}
+		if (codec != Codec::LZ)
+			return false;
+		const auto startTime = std::chrono::steady_clock::now();
+
+		struct Block
+		{
+			const uint8_t* Source = nullptr;
+			size_t Size = 0;
+			uint8_t* Destination = nullptr;
+			size_t RawSize = 0;
+			bool Raw = false;
+		};
+
+		// Block locations first, headers are all that's read
+		std::vector<Block> blocks = std::vector<Block>();
+		blocks.reserve((rawSize + BlockSize - 1) / BlockSize);
+		{
+			const uint8_t* ip = source.As<uint8_t>();
+			const uint8_t* iend = ip + source.GetSize();
+			size_t written = 0;
+			while (written < rawSize)
+			{
+				uint32_t header = 0;
+				if (!ReadPacked(ip, iend, header))
+					return false;
+
+				Block block = Block();
+				block.Raw = header & s_RawBlockFlag;
+				block.Size = header & ~s_RawBlockFlag;
+				block.RawSize = std::min<size_t>(BlockSize, rawSize - written);
+				if (block.Size > (size_t)(iend - ip) || (block.Raw && block.Size != block.RawSize))
+					return false;
+
+				block.Source = ip;
+				block.Destination = destination.As<uint8_t>() + written;
+				blocks.push_back(block);
+
+				ip += block.Size;
+				written += block.RawSize;
+			}
+			if (ip != iend)
+				return false;
+		}
+
+		auto decode = [](const Block& block) -> bool
+			{
+				if (block.Raw)
+				{
+					memcpy(block.Destination, block.Source, block.Size);
+					return true;
+				}
+				return DecompressBlock(block.Source, block.Size, block.Destination, block.RawSize);
+			};
+
+		if (!submit || blocks.size() < 2)
+		{
+			for (const Block& block : blocks)
+			{
+				if (!decode(block))
+					return false;
+			}
+			CompressionStats::AddStream(source.GetSize(), rawSize, (uint64_t)std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+			return true;
+		}
+
+		// Outlives this call, helpers may start after every block is claimed
+		struct Shared
+		{
+			std::vector<Block> Blocks;
+			std::atomic<size_t> Next = 0;
+			std::atomic<size_t> Done = 0;
+			std::atomic<bool> Failed = false;
+			std::mutex Mutex;
+			std::condition_variable Condition;
+		};
+		Ref<Shared> shared = CreateRef<Shared>();
+		shared->Blocks = std::move(blocks);
+
+		auto work = [shared, decode]()
+			{
+				const size_t count = shared->Blocks.size();
+				for (size_t i = shared->Next++; i < count; i = shared->Next++)
+				{
+					if (!decode(shared->Blocks[i]))
+						shared->Failed = true;
+
+					if (++shared->Done == count)
+					{
+						std::lock_guard<std::mutex> lock(shared->Mutex);
+						shared->Condition.notify_all();
+					}
+				}
+			};
+
+		const size_t helpers = std::min<size_t>(shared->Blocks.size() - 1, std::max(1u, std::thread::hardware_concurrency()) - 1);
+		for (size_t i = 0; i < helpers; i++)
+			submit(work);
+		work();
+
+		// Only blocks already being decoded by helpers are left
+		std::unique_lock<std::mutex> lock(shared->Mutex);
+		shared->Condition.wait(lock, [&shared]() { return shared->Done == shared->Blocks.size(); });
+		if (shared->Failed)
+			return false;
+		CompressionStats::AddStream(source.GetSize(), rawSize, (uint64_t)std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - startTime).count());
+		return true;
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Buffer.h"
+
+#include <atomic>
+#include <functional>
+
+namespace GE
+{
+	/*
+	* In-tree LZ77 block codec for pack payloads, LZ4-like sequences of literals & back references.
+	* Streams are split into BlockSize blocks that decode independently, see Decompress().
+	*
+	* Stream
+	*	[4 + ?] Block	// Per BlockSize of uncompressed data, last may be shorter
+	*		[4] Header	// Stored size, high bit set if stored uncompressed
+	*		[?] Data
+	*/
+	class Compression
+	{
+	public:
+		enum class Codec : uint16_t
+		{
+			None = 0,
+			LZ = 1
+		};
+
+		// Uncompressed bytes per block
+		static constexpr uint32_t BlockSize = 256 * 1024;
+
+		/*
+		* Runs a function on another thread, example Application::SubmitToWorkerThread
+		*/
+		using Submit = std::function<void(const std::function<void()>&)>;
+
+		/*
+		* Returns owned compressed stream of source.
+		* Returns an empty Buffer if it wouldn't save at least an eighth, store source uncompressed instead
+		*/
+		static Buffer Compress(const Buffer& source, Codec codec = Codec::LZ);
+
+		/*
+		* Decompresses source into destination block by block.
+		* Blocks are shared with submitted helpers, the calling thread decodes too so it never waits on queued work.
+		*
+		* @param source : compressed stream, may view a mapped file
+		* @param codec : codec source was compressed with
+		* @param destination : allocated to the uncompressed size
+		* @param submit : runs helpers, nullptr decodes on calling thread only
+		*/
+		static bool Decompress(const Buffer& source, Codec codec, Buffer& destination, const Submit& submit = nullptr);
+
+	private:
+		/*
+		* Returns compressed size, 0 if it doesn't fit capacity
+		*/
+		static size_t CompressBlock(const uint8_t* source, size_t size, uint8_t* destination, size_t capacity);
+		static bool DecompressBlock(const uint8_t* source, size_t size, uint8_t* destination, size_t rawSize);
+	};
+
+	/*
+	* Compressed streams inflated since start, debug stat. See Compression::Decompress()
+	*/
+	struct CompressionStats
+	{
+		inline static std::atomic<uint64_t> Streams = 0;
+		inline static std::atomic<uint64_t> StoredBytes = 0;
+		inline static std::atomic<uint64_t> RawBytes = 0;
+		// Calling thread, including time waiting on helpers
+		inline static std::atomic<uint64_t> Microseconds = 0;
+
+		static void AddStream(size_t storedSize, size_t rawSize, uint64_t microseconds)
+		{
+			StoredBytes += storedSize;
+			RawBytes += rawSize;
+			Microseconds += microseconds;
+			Streams++;
+		}
+	};
+}
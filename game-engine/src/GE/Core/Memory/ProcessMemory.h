@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace GE
+{
+	/*
+	* Physical memory of the running process, as reported by the OS.
+	* Used to measure loads, ex. RuntimeAssetManager::LoadStatistics
+	*/
+	class ProcessMemory
+	{
+	public:
+		// Bytes currently resident, 0 if unavailable
+		static uint64_t GetResidentSize();
+		// Highest resident bytes since process start, 0 if unavailable
+		static uint64_t GetPeakResidentSize();
+	};
+}
@@ -0,0 +1,65 @@
+#include "GE/GEpch.h"
+
+#include "ThreadPool.h"
+
+namespace GE
+{
+	ThreadPool::ThreadPool(uint32_t count /*= 0*/)
+	{
+		if (count == 0)
+			count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		m_Workers.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+			m_Workers.emplace_back(&ThreadPool::Work, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_QueueMutex);
+			m_Stopping = true;
+		}
+		m_QueueCondition.notify_all();
+
+		// Queued functions are finished first
+		for (std::thread& worker : m_Workers)
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+		m_Workers.clear();
+	}
+
+	void ThreadPool::Add(const std::function<void()>& func)
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_QueueMutex);
+			m_Queue.emplace_back(func);
+		}
+		m_QueueCondition.notify_one();
+	}
+
+	void ThreadPool::Work()
+	{
+		while (true)
+		{
+			std::function<void()> func;
+			{
+				std::unique_lock<std::mutex> lock(m_QueueMutex);
+				m_QueueCondition.wait(lock, [this]() { return m_Stopping || m_QueueFront < m_Queue.size(); });
+				if (m_QueueFront >= m_Queue.size())
+					return;
+
+				func = std::move(m_Queue[m_QueueFront++]);
+				// Reuse storage once drained
+				if (m_QueueFront == m_Queue.size())
+				{
+					m_Queue.clear();
+					m_QueueFront = 0;
+				}
+			}
+			func();
+		}
+	}
+}
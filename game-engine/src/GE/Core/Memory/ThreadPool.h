@@ -0,0 +1,35 @@
+#pragma once
+
+#include <condition_variable>
+#include <thread>
+
+namespace GE
+{
+	/*
+	* Fixed set of worker threads running queued functions in submission order.
+	* Functions must not touch GL/AL state, use Application::SubmitToMainAppThread() for that.
+	*/
+	class ThreadPool
+	{
+	public:
+		/*
+		* @param count : worker threads, 0 uses hardware concurrency - 1
+		*/
+		ThreadPool(uint32_t count = 0);
+		~ThreadPool();
+
+		void Add(const std::function<void()>& func);
+		inline uint32_t GetCount() const { return (uint32_t)m_Workers.size(); }
+
+	private:
+		void Work();
+	private:
+		std::vector<std::thread> m_Workers = std::vector<std::thread>();
+		std::vector<std::function<void()>> m_Queue = std::vector<std::function<void()>>();
+		size_t m_QueueFront = 0;
+
+		std::mutex m_QueueMutex;
+		std::condition_variable m_QueueCondition;
+		bool m_Stopping = false;
+	};
+}
@@ -2,15 +2,45 @@
 
 #include "UUID.h"
 
+#include <mutex>
 #include <random>
+#include <thread>
 
 namespace GE
 {
-	static std::random_device s_RandomDevice;
-	static std::mt19937_64 s_Engine(s_RandomDevice());
-	static std::uniform_int_distribution<uint64_t> s_UniformDistribution;
+	/*
+	* Seeds each thread once, std::random_device isn't safe to share between threads
+	*/
+	static uint64_t GetThreadSeed()
+	{
+		static std::mutex s_SeedMutex;
+		static std::random_device s_RandomDevice;
+
+		std::lock_guard<std::mutex> lock(s_SeedMutex);
+		const uint64_t seed = ((uint64_t)s_RandomDevice() << 32) | (uint64_t)s_RandomDevice();
+		return seed ^ (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+	}
+
+	/*
+	* SplitMix64 on thread_local state. Lock free, UUIDs are created on worker threads & in bulk, see Scene::CreateEntities()
+	*/
+	static uint64_t GenerateUUID()
+	{
+		static thread_local uint64_t s_State = GetThreadSeed();
+
+		uint64_t uuid = 0;
+		// 0 is reserved for no UUID
+		while (!uuid)
+		{
+			uint64_t z = (s_State += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			uuid = z ^ (z >> 31);
+		}
+		return uuid;
+	}
 
-	UUID::UUID() : m_UUID(s_UniformDistribution(s_Engine))
+	UUID::UUID() : m_UUID(GenerateUUID())
 	{
 
 	}
@@ -4,6 +4,7 @@
 #include "GE/Asset/Assets/Asset.h"
 #include "GE/Asset/Assets/Audio/Audio.h"
 #include "GE/Asset/Assets/Font/Font.h"
+#include "GE/Asset/Assets/Prefab/Prefab.h"
 #include "GE/Asset/Assets/Scene/Scene.h"
 #include "GE/Asset/Assets/Script/Script.h"
 #include "GE/Asset/Assets/Textures/Texture.h"
@@ -57,16 +57,151 @@ namespace GE
 
 	void Project::SetSceneHandle(UUID handle)
 	{
+		s_ActiveProject->m_ScenePrefetch = ScenePrefetch();
 		if (s_ActiveProject->m_Config.RuntimeScene && !s_ActiveProject->m_Config.RuntimeScene->IsStopped())
 			s_ActiveProject->SceneStop();
 
-		s_ActiveProject->m_Config.RuntimeScene = GetAssetCopy<Scene>(handle);
+		s_ActiveProject->m_Config.RuntimeScene = s_ActiveProject->SceneInstantiate(handle);
 		if (s_ActiveProject->m_Config.RuntimeScene)
 			s_ActiveProject->m_Config.SceneHandle = handle;
 	}
 
-	void Project::SceneStart(const Scene::State& state)
+	std::pair<uint64_t, uint64_t> Project::GetSceneLoadProgress()
 	{
+		if (const Scope<SceneInstantiation>& instantiation = s_ActiveProject->m_SceneLoad.Instantiation)
+			return { instantiation->GetLoadedCount(), instantiation->GetTotalCount() };
+		return { 0, 0 };
+	}
+
+	Ref<Scene> Project::SceneInstantiate(UUID handle)
+	{
+		// Replaces any Scene still loading, keeps Budget
+		const float budget = m_SceneLoad.Budget;
+		m_SceneLoad = SceneLoad();
+		m_SceneLoad.Budget = budget;
+
+		if (budget <= 0.0f)
+			return GetAssetCopy<Scene>(handle);
+
+		Ref<Scene> source = GetAsset<Scene>(handle);
+		if (!source)
+			return nullptr;
+
+		m_SceneLoad.Instantiation = CreateScope<SceneInstantiation>(source);
+		m_SceneLoad.Start = std::chrono::steady_clock::now();
+		return m_SceneLoad.Instantiation->GetScene();
+	}
+
+	void Project::SceneLoadUpdate()
+	{
+		if (!m_SceneLoad.Instantiation)
+			return;
+
+		const auto stepStart = std::chrono::steady_clock::now();
+		const bool complete = m_SceneLoad.Instantiation->Step(m_SceneLoad.Budget);
+		const auto stepEnd = std::chrono::steady_clock::now();
+		m_SceneLoad.WorstStep = std::max(m_SceneLoad.WorstStep, std::chrono::duration<float, std::milli>(stepEnd - stepStart).count());
+		m_SceneLoad.FrameCount++;
+		if (!complete)
+			return;
+
+		const float duration = std::chrono::duration<float, std::milli>(stepEnd - m_SceneLoad.Start).count();
+		GE_CORE_INFO("Scene Load Complete.\n\tEntities : {0}\n\tFrames : {1}\n\tBudget : {2}ms\n\tWorst Step : {3}ms\n\tDuration : {4}ms",
+			m_SceneLoad.Instantiation->GetTotalCount(), m_SceneLoad.FrameCount, m_SceneLoad.Budget, m_SceneLoad.WorstStep, duration);
+
+		const bool startPending = m_SceneLoad.StartPending;
+		const Scene::State state = m_SceneLoad.StartState;
+		const PrefetchProgress progress = m_SceneLoad.StartProgress;
+		const float budget = m_SceneLoad.Budget;
+		m_SceneLoad = SceneLoad();
+		m_SceneLoad.Budget = budget;
+
+		if (startPending)
+			SceneStart(state, progress);
+	}
+
+	void Project::SceneStart(const Scene::State& state, const PrefetchProgress& progress)
+	{
+		if (!m_Config.RuntimeScene)
+			return;
+
+		m_Config.RuntimeScene->SetPartitionConfig(m_WorldPartition);
+
+		// Started once every Entity is copied, see SceneLoadUpdate()
+		if (m_SceneLoad.Instantiation)
+		{
+			m_SceneLoad.StartPending = state != Scene::State::Stop;
+			m_SceneLoad.StartState = state;
+			m_SceneLoad.StartProgress = progress;
+			return;
+		}
+
+		// Pause & Resume keep their Assets loaded
+		if (!m_AssetManager || state == Scene::State::Stop || !m_Config.RuntimeScene->IsStopped())
+		{
+			m_ScenePrefetch = ScenePrefetch();
+			m_Config.RuntimeScene->OnStart(state, Application::GetFramebuffer()->GetWidth(), Application::GetFramebuffer()->GetHeight());
+			return;
+		}
+
+		GE_PROFILE_FUNCTION();
+
+		std::unordered_set<UUID> handles = std::unordered_set<UUID>();
+		m_Config.RuntimeScene->GetAssetHandles(handles);
+
+		m_ScenePrefetch = ScenePrefetch();
+		m_ScenePrefetch.Active = true;
+		m_ScenePrefetch.State = state;
+		m_ScenePrefetch.Progress = progress;
+		m_ScenePrefetch.Start = std::chrono::steady_clock::now();
+		// All requested before any is waited on, RuntimeAssetManager decodes them on worker threads
+		for (const UUID& handle : handles)
+		{
+			if (!m_AssetManager->HandleExists(handle))
+				continue;
+
+			m_ScenePrefetch.TotalCount++;
+			Ref<Asset> asset = m_AssetManager->GetAssetAsync(handle);
+			if (asset && asset->GetStatus() == Asset::Status::Loading)
+				m_ScenePrefetch.Pending.push_back({ handle, asset });
+			else
+				m_ScenePrefetch.LoadedCount++;
+		}
+
+		if (m_ScenePrefetch.Progress)
+			m_ScenePrefetch.Progress(m_ScenePrefetch.LoadedCount, m_ScenePrefetch.TotalCount);
+		ScenePrefetchUpdate();
+	}
+
+	void Project::ScenePrefetchUpdate()
+	{
+		if (!m_ScenePrefetch.Active)
+			return;
+
+		// Placeholders stay Loading once replaced, loaded Assets are found by handle instead
+		std::vector<std::pair<UUID, Ref<Asset>>>& pending = m_ScenePrefetch.Pending;
+		const uint32_t previousCount = m_ScenePrefetch.LoadedCount;
+		for (auto it = pending.begin(); it != pending.end();)
+		{
+			if (m_AssetManager->AssetLoaded(it->first) || it->second->GetStatus() != Asset::Status::Loading)
+			{
+				it = pending.erase(it);
+				m_ScenePrefetch.LoadedCount++;
+			}
+			else
+				it++;
+		}
+
+		if (m_ScenePrefetch.Progress && m_ScenePrefetch.LoadedCount != previousCount)
+			m_ScenePrefetch.Progress(m_ScenePrefetch.LoadedCount, m_ScenePrefetch.TotalCount);
+		if (!pending.empty())
+			return;
+
+		const float duration = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_ScenePrefetch.Start).count();
+		GE_CORE_INFO("Scene Prefetch Complete.\n\tAssets : {0}\n\tDuration : {1}ms", m_ScenePrefetch.TotalCount, duration);
+
+		const Scene::State state = m_ScenePrefetch.State;
+		m_ScenePrefetch = ScenePrefetch();
 		if (m_Config.RuntimeScene)
 			m_Config.RuntimeScene->OnStart(state, Application::GetFramebuffer()->GetWidth(), Application::GetFramebuffer()->GetHeight());
 	}
@@ -79,6 +214,8 @@ namespace GE
 
 	void Project::SceneStop()
 	{
+		m_ScenePrefetch = ScenePrefetch();
+		m_SceneLoad.StartPending = false;
 		if (m_Config.RuntimeScene)
 			m_Config.RuntimeScene->OnStop();
 	}
@@ -101,15 +238,43 @@ namespace GE
 
 	Ref<Scene> Project::SceneReset()
 	{
-		if (Ref<Scene> newRuntimeScene = GetAssetCopy<Scene>(m_Config.SceneHandle))
+		if (Ref<Scene> newRuntimeScene = SceneInstantiate(m_Config.SceneHandle))
 		{
 			if (m_Config.RuntimeScene && !m_Config.RuntimeScene->IsStopped())
 				m_Config.RuntimeScene->OnStop();
+			m_ScenePrefetch = ScenePrefetch();
 			return m_Config.RuntimeScene = newRuntimeScene;
 		}
 		return nullptr;
 	}
 
+	void Project::AssetsUpdate()
+	{
+		if (!m_AssetManager)
+			return;
+
+		// Walks every loaded Asset & Scene Component, only loads can push a type over budget
+		m_Residency.FrameCount++;
+		if (m_Residency.FrameCount >= Residency::Interval || m_AssetManager->GetLoadedAssets().size() > m_Residency.LoadedCount)
+		{
+			std::unordered_set<UUID> referencedHandles = std::unordered_set<UUID>();
+			if (m_Config.RuntimeScene)
+			{
+				referencedHandles.insert(m_Config.SceneHandle);
+				m_Config.RuntimeScene->GetAssetHandles(referencedHandles);
+			}
+			m_AssetManager->UpdateResidency(referencedHandles);
+
+			m_Residency.FrameCount = 0;
+			m_Residency.LoadedCount = m_AssetManager->GetLoadedAssets().size();
+		}
+
+		SceneLoadUpdate();
+
+		// Async loads landed in Application::ExecuteMainThread() this frame
+		ScenePrefetchUpdate();
+	}
+
 #pragma region Tag Control
 
 	bool Project::EventScene(Event& e, Entity entity)
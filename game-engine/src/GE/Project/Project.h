@@ -1,13 +1,16 @@
 #pragma once
 
 #include "GE/Asset/Assets/Scene/Scene.h"
+#include "GE/Asset/Assets/Scene/SceneInstantiation.h"
 #include "GE/Asset/AssetManager.h"
 
 #include "GE/Core/Core.h"
 #include "GE/Core/Events/Event.h"
 #include "GE/Core/Time/Timestep.h"
 
+#include <chrono>
 #include <filesystem>
+#include <functional>
 
 namespace GE
 {
@@ -15,6 +18,12 @@ namespace GE
 	{
 		friend class ProjectSerializer;
 	public:
+		/*
+		* Called as Assets referenced by RuntimeScene finish loading, see StartScene()
+		* @param loadedCount : Assets loaded or failed, equals totalCount once done
+		*/
+		using PrefetchProgress = std::function<void(uint32_t loadedCount, uint32_t totalCount)>;
+
 		struct Config
 		{
 			friend class Project;
@@ -148,6 +157,34 @@ namespace GE
 			return static_ref_cast<T, Asset>(asset);
 		}
 
+		/*
+		* Returns asset if ready, otherwise nullptr while it loads in the background
+		* Use a placeholder until then. See AssetManager::GetAssetAsync()
+		*/
+		template<typename T>
+		inline static Ref<T> GetAssetAsync(UUID handle)
+		{
+			if (!handle)
+				return nullptr;
+
+			Ref<Asset> asset = Project::GetAssetManager()->GetAssetAsync(handle);
+			if (!asset || asset->GetStatus() == Asset::Status::Loading || asset->GetStatus() == Asset::Status::Invalid)
+				return nullptr;
+			return GetAssetAs<T>(asset);
+		}
+
+		/*
+		* Returns true while GetAssetAsync(handle) returns nullptr because asset is still loading
+		*/
+		inline static bool IsAssetLoading(UUID handle)
+		{
+			if (!handle)
+				return false;
+
+			Ref<Asset> asset = Project::GetAssetManager()->GetAssetAsync(handle);
+			return asset && asset->GetStatus() == Asset::Status::Loading;
+		}
+
 		template<typename T>
 		inline static Ref<T> GetAsset(UUID handle)
 		{
@@ -178,19 +215,57 @@ namespace GE
 
 		/*
 		* Stops current Scene if handle is set, then gets Scene Copy and sets new Scene handle
+		* With a load budget, RuntimeScene fills over the following frames, see SetSceneLoadBudget()
 		*/
 		static void SetSceneHandle(UUID handle);
 
 		/*
+		* Milliseconds per frame spent copying Entities into a new RuntimeScene, see SceneInstantiation.
+		* Copy is done in UpdateAssets(), RuntimeScene won't start until every Entity exists.
+		* 0 copies the whole Scene at once
+		*/
+		static void SetSceneLoadBudget(float milliseconds) { s_ActiveProject->m_SceneLoad.Budget = milliseconds; }
+		static float GetSceneLoadBudget() { return s_ActiveProject->m_SceneLoad.Budget; }
+		/*
+		* Applied to RuntimeScene on StartScene(), see ScenePartition
+		*/
+		static void SetWorldPartition(const ScenePartition::Config& config) { s_ActiveProject->m_WorldPartition = config; }
+		static const ScenePartition::Config& GetWorldPartition() { return s_ActiveProject->m_WorldPartition; }
+		/*
+		* Returns true while RuntimeScene is partially instantiated
+		*/
+		static bool IsSceneLoading() { return s_ActiveProject->m_SceneLoad.Instantiation != nullptr; }
+		/*
+		* Entities copied into RuntimeScene & Entities in Scene Asset, equal once loaded
+		*/
+		static std::pair<uint64_t, uint64_t> GetSceneLoadProgress();
+
+		/*
+		* Starting a stopped Scene first loads every Asset it references in parallel, see Scene::GetAssetHandles().
+		* Start is deferred to UpdateAssets() until all are loaded, so none loads lazily on first use.
+		* Also deferred while RuntimeScene is loading, see IsSceneLoading()
 		* 
 		* @param state : Scene State enum. 0 = Stop, 1 = Run, 2 = Pause
+		* @param progress : optional, called once per change until loadedCount equals totalCount
 		*/
-		static void StartScene(const Scene::State& state) { s_ActiveProject->SceneStart(state); }
+		static void StartScene(const Scene::State& state, const PrefetchProgress& progress = nullptr) { s_ActiveProject->SceneStart(state, progress); }
+		/*
+		* Returns true while StartScene() waits on Assets to load
+		*/
+		static bool IsScenePrefetching() { return s_ActiveProject->m_ScenePrefetch.Active; }
 		static void UpdateScene(Timestep ts) { s_ActiveProject->SceneUpdate(ts); }
 		static void StopScene() { s_ActiveProject->SceneStop(); }
 		static void StepScene(int steps) { s_ActiveProject->SceneStep(steps); }
 		static bool EventScene(Event& e, Entity entity);
 		static Ref<Scene> ResetScene() { return s_ActiveProject->SceneReset(); }
+		/*
+		* Evicts unused assets from types over budget, see AssetManager::UpdateResidency().
+		* Assets referenced by RuntimeScene stay resident.
+		* Runs every Residency::Interval frames, or the frame after an Asset loads.
+		* Instantiates RuntimeScene within load budget, see SetSceneLoadBudget().
+		* Starts RuntimeScene once its prefetch is done, see StartScene()
+		*/
+		static void UpdateAssets() { s_ActiveProject->AssetsUpdate(); }
 
 		static const std::map<uint32_t, std::string>& GetTags() { return s_ActiveProject->m_Config.AllTags; }
 		/*
@@ -210,7 +285,20 @@ namespace GE
 		static bool RemoveTag(uint32_t id);
 	
 	private:
-		void SceneStart(const Scene::State& state);
+		void SceneStart(const Scene::State& state, const PrefetchProgress& progress);
+		/*
+		* Reports progress & starts RuntimeScene once every prefetched Asset is loaded or failed
+		*/
+		void ScenePrefetchUpdate();
+		/*
+		* Copies Scene Asset using handle, sliced across frames if there is a load budget
+		* Returns RuntimeScene to set, may be partially filled
+		*/
+		Ref<Scene> SceneInstantiate(UUID handle);
+		/*
+		* Continues partial RuntimeScene, runs a deferred StartScene() once complete
+		*/
+		void SceneLoadUpdate();
 		void SceneUpdate(Timestep ts);
 		void SceneStop();
 		void SceneStep(int steps);
@@ -229,9 +317,57 @@ namespace GE
 		* * returns false
 		*/
 		Ref<Scene> SceneReset();
+		void AssetsUpdate();
 	private: 
+		/*
+		* Scene Start waiting on Assets, see StartScene()
+		*/
+		struct ScenePrefetch
+		{
+			bool Active = false;
+			Scene::State State = Scene::State::Stop;
+			PrefetchProgress Progress = nullptr;
+			// Handle & placeholder of Assets still loading
+			std::vector<std::pair<UUID, Ref<Asset>>> Pending = std::vector<std::pair<UUID, Ref<Asset>>>();
+			uint32_t TotalCount = 0;
+			uint32_t LoadedCount = 0;
+			std::chrono::steady_clock::time_point Start;
+		};
+
+		/*
+		* RuntimeScene being instantiated, see SetSceneLoadBudget()
+		*/
+		struct SceneLoad
+		{
+			float Budget = 0.0f;
+			Scope<SceneInstantiation> Instantiation = nullptr;
+			// StartScene() called before RuntimeScene finished loading
+			bool StartPending = false;
+			Scene::State StartState = Scene::State::Stop;
+			PrefetchProgress StartProgress = nullptr;
+			uint32_t FrameCount = 0;
+			float WorstStep = 0.0f;
+			std::chrono::steady_clock::time_point Start;
+		};
+
+		/*
+		* When AssetsUpdate() next updates residency, see UpdateAssets()
+		*/
+		struct Residency
+		{
+			// Frames between updates while no Asset is loaded
+			static constexpr uint32_t Interval = 60;
+			uint32_t FrameCount = 0;
+			// AssetManager::GetLoadedAssets() size after last update
+			uint64_t LoadedCount = 0;
+		};
+
 		Config m_Config = Config();
 		Ref<AssetManager> m_AssetManager;
+		ScenePrefetch m_ScenePrefetch = ScenePrefetch();
+		SceneLoad m_SceneLoad = SceneLoad();
+		Residency m_Residency = Residency();
+		ScenePartition::Config m_WorldPartition = ScenePartition::Config();
 
 		static Ref<Project> s_ActiveProject;
 	};
@@ -5,6 +5,9 @@
 
 #include <glm/glm.hpp>
 
+#include <cfloat>
+#include <utility>
+
 namespace GE
 {
 	class Camera
@@ -33,6 +36,27 @@ namespace GE
 		
 		virtual const glm::vec3& GetPosition() const = 0;
 		virtual const glm::vec3 GetRotation() const = 0;
+
+		/*
+		* Returns world space min & max bounds visible to camera.
+		* Unprojects clip space corners of near & far planes using inverse view projection.
+		*/
+		const std::pair<glm::vec2, glm::vec2> GetBounds() const
+		{
+			const glm::mat4 inverseViewProjection = glm::inverse(GetViewProjection());
+
+			std::pair<glm::vec2, glm::vec2> ret = std::pair<glm::vec2, glm::vec2>(glm::vec2(FLT_MAX), glm::vec2(-FLT_MAX));
+			for (int i = 0; i < 8; i++)
+			{
+				glm::vec4 corner = inverseViewProjection * glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f, 1.0f);
+				if (corner.w != 0.0f)
+					corner /= corner.w;
+
+				ret.first = glm::min(ret.first, glm::vec2(corner));
+				ret.second = glm::max(ret.second, glm::vec2(corner));
+			}
+			return ret;
+		}
 	protected:
 		inline void SetProjectionType(const ProjectionType& type) { p_ProjectionType = type; }
 
@@ -11,6 +11,7 @@
 #include "GE/Project/Project.h"
 
 #include "GE/Rendering/Camera/Camera.h"
+#include "GE/Rendering/Renderer/StaticBatch.h"
 #include "GE/Rendering/VertexArray/Vertex.h"
 #include "GE/Rendering/VertexArray/VertexArray.h"
 
@@ -31,11 +32,57 @@ namespace GE
 		{
 			uint32_t DrawCalls = 0;
 			uint32_t SpawnCount = 0;
+			// Entities submitted by a Layer after view culling
+			uint32_t DrawnCount = 0;
+			// Sprites & Circles a Layer would draw, rejected for being outside of camera bounds. Static sprites are counted per batch
+			uint32_t CulledCount = 0;
+
+			// Current batch capacities, in spawns
+			uint32_t QuadCapacity = 0;
+			uint32_t CircleCapacity = 0;
+			uint32_t LineCapacity = 0;
+			uint32_t TextCapacity = 0;
+			// Flushes forced by a batch reaching Data::MaxSpawns
+			uint32_t CapacityFlushes = 0;
+
+			// Spawns drawn from StaticBatches, not included in SpawnCount
+			uint32_t StaticSpawnCount = 0;
+			// StaticBatches baked this frame
+			uint32_t StaticBakes = 0;
+
+			// Quads drawn front-to-back with depth writes & no blending
+			uint32_t OpaqueCount = 0;
+			// Quads blended back-to-front
+			uint32_t TranslucentCount = 0;
+			/*
+			* Estimated screen coverage of all quads, from their clipped screen bounds.
+			* 1 is the whole viewport covered once. Ignores depth rejection.
+			*/
+			float Overdraw = 0.0f;
+
+			// Text glyphs found in, missing from & evicted from Font GlyphCaches
+			uint32_t GlyphCacheHits = 0;
+			uint32_t GlyphCacheMisses = 0;
+			uint32_t GlyphCacheEvictions = 0;
 
 			uint32_t GetTotalVertexCount() const { return SpawnCount * 4; }
 			uint32_t GetTotalIndexCount() const { return SpawnCount * 6; }
 		};
 
+		/*
+		* Tracks spawns a batch can hold & its recent usage.
+		* Grows when full, shrinks after sustained low usage.
+		*/
+		struct BatchCapacity
+		{
+			// Current capacity, in spawns
+			uint32_t Spawns = 0;
+			// Most spawns flushed at once this frame
+			uint32_t Peak = 0;
+			// Consecutive frames Peak stayed below a quarter of Spawns
+			uint32_t LowFrames = 0;
+		};
+
 		struct QuadData
 		{
 			/*
@@ -46,12 +93,41 @@ namespace GE
 			std::map<Pivot, Vertices> PivotPoints = std::map<Pivot, Vertices>();
 
 			uint32_t IndexCount = 0;
+			BatchCapacity Capacity;
 			QuadVertex* VertexBufferBase = nullptr;
 			QuadVertex* VertexBufferPtr = nullptr;
 
 			Ref<VertexArray> VertexArray = nullptr;
 			Ref<VertexBuffer> VertexBuffer = nullptr;
 			Ref<Shader> Shader = nullptr;
+			// Shader without discard, lets depth tests run before shading
+			Ref<Shader> OpaqueShader = nullptr;
+
+			/*
+			* Spawn in VertexBufferBase & its NDC depth.
+			* Sorted at Flush, opaque front-to-back & translucent back-to-front.
+			*/
+			struct Spawn
+			{
+				float Depth = 0.0f;
+				uint32_t Index = 0;
+			};
+			std::vector<Spawn> OpaqueSpawns = std::vector<Spawn>();
+			std::vector<Spawn> TranslucentSpawns = std::vector<Spawn>();
+			/*
+			* StaticBatch queued by DrawStaticBatch & its NDC depth.
+			* Drawn back-to-front between translucent spawns at Flush, under spawns of equal depth.
+			*/
+			struct StaticSpawn
+			{
+				float Depth = 0.0f;
+				Ref<StaticBatch> Batch = nullptr;
+			};
+			std::vector<StaticSpawn> StaticSpawns = std::vector<StaticSpawn>();
+			// Vertices reordered by sorted spawns, uploaded instead of VertexBufferBase
+			std::vector<QuadVertex> SortedVertices = std::vector<QuadVertex>();
+			// Set in Start, used to find spawn depth
+			glm::mat4 ViewProjection = glm::mat4(1.0f);
 		};
 
 		struct SpriteData
@@ -70,6 +146,7 @@ namespace GE
 			Ref<Shader> Shader;
 
 			uint32_t IndexCount = 0;
+			BatchCapacity Capacity;
 			CircleVertex* VertexBufferBase = nullptr;
 			CircleVertex* VertexBufferPtr = nullptr;
 		};
@@ -80,7 +157,9 @@ namespace GE
 			Ref<VertexBuffer> VertexBuffer;
 			Ref<Shader> Shader;
 
+			// Vertex count, lines aren't indexed
 			uint32_t IndexCount = 0;
+			BatchCapacity Capacity;
 			LineVertex* VertexBufferBase = nullptr;
 			LineVertex* VertexBufferPtr = nullptr;
 			float Width = 2.0f;
@@ -93,17 +172,30 @@ namespace GE
 			Ref<Shader> Shader;
 
 			uint32_t IndexCount = 0;
+			BatchCapacity Capacity;
 			TextVertex* VertexBufferBase = nullptr;
 			TextVertex* VertexBufferPtr = nullptr;
 
-			Ref<Texture2D> AtlasTexture;
+			// Font atlases & GlyphCache pages, bound together so switching between them doesn't flush
+			static const uint32_t MaxAtlasSlots = 8;
+			std::array<Ref<Texture2D>, MaxAtlasSlots> AtlasSlots;
+			uint32_t AtlasSlotIndex = 0;
+			// Slot of atlas glyphs are currently added from
+			uint32_t AtlasIndex = 0;
 		};
 
 		struct Data
 		{
-			static const uint32_t MaxSpawns = 10000;
-			static const uint32_t MaxVertices = MaxSpawns * 4;
-			static const uint32_t MaxIndices = MaxSpawns * 6;
+			// Starting batch capacity, in spawns. Batches never shrink below this
+			static const uint32_t MinSpawns = 256;
+			// Frames of low usage before a batch halves its capacity
+			static const uint32_t ShrinkFrames = 120;
+			// Batch capacity cap, in spawns. Batches flush when full at this capacity
+			uint32_t MaxSpawns = 100000;
+
+			// Index buffer shared by Quad, Circle & Text. Sized for the largest batch, in spawns
+			Ref<IndexBuffer> SharedIndexBuffer = nullptr;
+			uint32_t IndexCapacity = 0;
 
 			// Default OpenGL
 			static API RenderAPI;
@@ -126,11 +218,20 @@ namespace GE
 		* @param api : render API. Default OpenGL.
 		*/
 		static void Create(API api = API::OpenGL);
-		inline static const API& InstanceAPI() { return s_Instance->GetAPI(); }
+		/*
+		* Returns API::None if no Renderer was created, example a headless Application
+		*/
+		inline static API InstanceAPI() { return s_Instance ? s_Instance->GetAPI() : API::None; }
 		inline static void ClearColor(const glm::vec4& color) { s_Instance->SetClearColor(color); }
 		inline static void CleanBuffers() { s_Instance->ClearBuffers(); }
 		inline static void ResetStats() { s_Instance->ClearStats(); }
 		inline static const Statistics& GetStatistics() { return s_Instance->GetStats(); }
+		inline static void CountEntities(uint32_t drawn, uint32_t culled) { s_Instance->AddEntityStats(drawn, culled); }
+		/*
+		* Sets batch capacity cap, in spawns.
+		* Batches larger than the cap shrink once their usage drops.
+		*/
+		inline static void SetMaxBatchSpawns(uint32_t spawns) { s_Instance->SetMaxSpawns(spawns); }
 		inline static void ResizeViewport(uint32_t xOff, uint32_t yOff, uint32_t w, uint32_t h) { s_Instance->SetViewport(xOff, yOff, w, h); }
 		inline static const glm::mat4& IdentityMat4() { return s_Instance->GetIdentityMat4();}
 
@@ -143,10 +244,26 @@ namespace GE
 		inline static void DrawSphere(const glm::mat4& transform, const Pivot& pivot, const float& radius, const float& thickness, const float& fade, const glm::vec4& color, const uint32_t& entityID) { s_Instance->DrawCircle(transform, pivot, radius, thickness, fade, color, entityID); }
 
 		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src, const uint32_t& entityID) { s_Instance->DrawSprite(transform, pivot, src, entityID); }
+
+		// Static
+		inline static Ref<StaticBatch> CreateStaticBatch(Ref<Texture2D> texture, float z) { return CreateRef<StaticBatch>(texture, z); }
+		// Call before BakeStatic
+		inline static void AddStatic(Ref<StaticBatch> batch, const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src, const uint32_t& entityID) { s_Instance->AddStaticSprite(batch, transform, pivot, src, entityID); }
+		// Uploads & clears staging vertices. Batch can't be added to after
+		inline static void BakeStatic(Ref<StaticBatch> batch) { s_Instance->UploadStaticBatch(batch); }
+		// Call between Open & Close. Flushes pending spawns first, to keep draw order
+		inline static void DrawStatic(Ref<StaticBatch> batch) { s_Instance->DrawStaticBatch(batch); }
 		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const CircleRendererComponent& crc, const uint32_t& entityID) { s_Instance->DrawCircle(transform, pivot, crc, entityID); }
 		inline static void Draw(const glm::mat4& transform, const TextRendererComponent& trc, const uint32_t& entityID) { s_Instance->DrawString(transform, trc, entityID); }
 
-		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const GUIImageComponent& guiIC, const uint32_t& entityID) { s_Instance->DrawQuadTexture(transform, pivot, Project::GetAsset<Texture2D>(guiIC.TextureHandle), guiIC.TilingFactor, guiIC.Color, entityID); }
+		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const GUIImageComponent& guiIC, const uint32_t& entityID)
+		{
+			// Untextured placeholder while texture loads
+			if (Ref<Texture2D> texture = Project::GetAssetAsync<Texture2D>(guiIC.TextureHandle))
+				s_Instance->DrawQuadTexture(transform, pivot, texture, guiIC.TilingFactor, guiIC.Color, entityID);
+			else
+				s_Instance->DrawQuadColor(transform, pivot, guiIC.Color, entityID);
+		}
 		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const GUIButtonComponent& guiBC, const GUIState& state, const uint32_t& entityID) { s_Instance->DrawButton(transform, pivot, guiBC, state, entityID); }
 		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const GUIInputFieldComponent& guiIFC, const GUIState& state, const uint32_t& entityID) { s_Instance->DrawInputField(transform, pivot, guiIFC, state, entityID); }
 		inline static void Draw(const glm::mat4& transform, const Pivot& pivot, const GUISliderComponent& guiSC, const GUIState& state, const uint32_t& entityID) { s_Instance->DrawSlider(transform, pivot, guiSC, state, entityID); }
@@ -168,6 +285,8 @@ public:
 
 		virtual const Statistics& GetStats() = 0;
 		virtual void ClearStats() = 0;
+		virtual void AddEntityStats(uint32_t drawn, uint32_t culled) = 0;
+		virtual void SetMaxSpawns(uint32_t spawns) = 0;
 
 protected:
 		virtual void CreateData() = 0;
@@ -183,7 +302,7 @@ protected:
 		virtual void SetLineWidth(float thickness) = 0;
 
 		virtual void DrawLines(Ref<VertexArray> vertexArray, uint32_t vertexCount) = 0;
-		virtual void DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount = 0) = 0;
+		virtual void DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount = 0, uint32_t firstIndex = 0) = 0;
 
 		// Sprite/Quad
 		virtual void DrawQuadColor(const glm::mat4& transform, const Pivot& pivot, const glm::vec4& color,  const uint32_t& entityID = -1) = 0;
@@ -194,6 +313,11 @@ protected:
 
 		virtual void DrawSprite(const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src,  const uint32_t& entityID) = 0;
 
+		// Static
+		virtual void AddStaticSprite(Ref<StaticBatch> batch, const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src, const uint32_t& entityID) = 0;
+		virtual void UploadStaticBatch(Ref<StaticBatch> batch) = 0;
+		virtual void DrawStaticBatch(Ref<StaticBatch> batch) = 0;
+
 		// Circle
 		virtual void DrawCircle(const glm::mat4& transform, const Pivot& pivot, const float& radius, const float& thickness, const float& fade,
 			const glm::vec4& color,  const uint32_t& entityID = -1) = 0;
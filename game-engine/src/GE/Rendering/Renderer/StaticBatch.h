@@ -0,0 +1,39 @@
+#pragma once
+
+#include "GE/Asset/Assets/Textures/Texture.h"
+
+#include "GE/Rendering/VertexArray/Vertex.h"
+#include "GE/Rendering/VertexArray/VertexArray.h"
+
+#include <cfloat>
+
+namespace GE
+{
+	/*
+	* Sprites sharing a texture & world Z, baked once into their own GPU buffers.
+	* Drawn without per-frame transforms or uploads, depth sorted with dynamic quads.
+	* See Renderer::CreateStaticBatch, Renderer::AddStatic & Renderer::BakeStatic
+	*/
+	struct StaticBatch
+	{
+		Ref<VertexArray> VertexArray = nullptr;
+		// Null for untextured sprites
+		Ref<Texture2D> Texture = nullptr;
+
+		// Staging vertices, cleared once baked
+		std::vector<QuadVertex> Vertices = std::vector<QuadVertex>();
+		uint32_t SpawnCount = 0;
+		// World Z of all spawns, sorts batch against dynamic quads
+		float Z = 0.0f;
+		// World min & max bounds of all spawns
+		std::pair<glm::vec2, glm::vec2> Bounds = std::pair<glm::vec2, glm::vec2>(glm::vec2(FLT_MAX), glm::vec2(-FLT_MAX));
+
+		StaticBatch() = default;
+		StaticBatch(Ref<Texture2D> texture, float z) : Texture(texture), Z(z)
+		{
+
+		}
+
+		bool IsBaked() const { return VertexArray != nullptr; }
+	};
+}
@@ -11,6 +11,13 @@ namespace GE
 		virtual ~IndexBuffer() = default;
 
 		virtual const uint32_t& GetCount() const = 0;
+		/*
+		* Reallocates & regenerates quad indices.
+		* Attached VertexArrays remain valid.
+		*
+		* @param count : new index count
+		*/
+		virtual void Resize(uint32_t count) = 0;
 
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
@@ -100,6 +100,14 @@ namespace GE
 		virtual inline void SetLayout(const Layout& layout) = 0;
 		
 		virtual void SetData(const void* data, uint32_t size) = 0;
+		/*
+		* Reallocates buffer storage, discarding its data.
+		* Attached VertexArrays remain valid.
+		*
+		* @param size : new size in bytes
+		*/
+		virtual void Resize(uint32_t size) = 0;
+		virtual const uint32_t& GetSize() const = 0;
 		
 		// Binds buffer
 		virtual void Bind() const = 0;
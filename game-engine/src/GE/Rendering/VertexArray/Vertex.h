@@ -50,6 +50,8 @@ namespace GE
 		glm::vec4 TextColor = glm::vec4(1.0f);
 		glm::vec4 BGColor = glm::vec4(1.0f);
 		glm::vec2 TextureCoord = glm::vec2(0.0f);
+		// Slot in TextData::AtlasSlots
+		int AtlasIndex = 0;
 
 		int EntityID = -1;
 	};
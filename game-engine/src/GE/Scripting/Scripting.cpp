@@ -92,6 +92,78 @@ namespace GE
 	}
 #pragma endregion
 
+#pragma region Scene Internal Calls
+
+	/*
+	* Returns managed ulong[] of entity UUIDs.
+	* Skips entities destroyed since the spatial index was last updated.
+	*/
+	static MonoArray* EntitiesToMonoArray(Ref<Scene> scene, const std::vector<Entity>& entities)
+	{
+		std::vector<uint64_t> uuids = std::vector<uint64_t>();
+		uuids.reserve(entities.size());
+		for (Entity entity : entities)
+		{
+			if (scene->EntityExists(entity) && scene->HasComponent<IDComponent>(entity))
+				uuids.push_back(scene->GetComponent<IDComponent>(entity).ID);
+		}
+
+		MonoArray* array = mono_array_new(mono_domain_get(), mono_get_uint64_class(), uuids.size());
+		for (size_t i = 0; i < uuids.size(); i++)
+			mono_array_set(array, uint64_t, i, uuids[i]);
+		return array;
+	}
+
+	static MonoArray* Scene_QueryAABB(glm::vec2* min, glm::vec2* max)
+	{
+		std::vector<Entity> entities = std::vector<Entity>();
+		if (Ref<Scene> scene = Project::GetRuntimeScene())
+		{
+			scene->GetSpatialIndex().QueryAABB(SceneSpatialIndex::Bounds(*min, *max), entities);
+			return EntitiesToMonoArray(scene, entities);
+		}
+		return nullptr;
+	}
+
+	static MonoArray* Scene_QueryPoint(glm::vec2* point)
+	{
+		std::vector<Entity> entities = std::vector<Entity>();
+		if (Ref<Scene> scene = Project::GetRuntimeScene())
+		{
+			scene->GetSpatialIndex().QueryPoint(*point, entities);
+			return EntitiesToMonoArray(scene, entities);
+		}
+		return nullptr;
+	}
+
+	static MonoArray* Scene_QueryNearest(glm::vec2* point, uint32_t count)
+	{
+		std::vector<Entity> entities = std::vector<Entity>();
+		if (Ref<Scene> scene = Project::GetRuntimeScene())
+		{
+			scene->GetSpatialIndex().QueryNearest(*point, count, entities);
+			return EntitiesToMonoArray(scene, entities);
+		}
+		return nullptr;
+	}
+
+	static uint64_t Scene_Raycast(glm::vec2* origin, glm::vec2* direction, float maxDistance, float* outDistance)
+	{
+		if (Ref<Scene> scene = Project::GetRuntimeScene())
+		{
+			SceneSpatialIndex::RaycastHit hit = SceneSpatialIndex::RaycastHit();
+			if (scene->GetSpatialIndex().Raycast(*origin, *direction, maxDistance, hit) && scene->EntityExists(hit.HitEntity))
+			{
+				*outDistance = hit.Distance;
+				return hit.ID;
+			}
+		}
+		*outDistance = 0.0f;
+		return 0;
+	}
+
+#pragma endregion
+
 #pragma region Entity & Component Internal Calls
 
 	static bool Entity_IsHovered(UUID uuid)
@@ -136,6 +208,16 @@ namespace GE
 			return instance->GetMonoObject();
 		return nullptr;
 	}
+	/*
+	* Static sprites are baked, see SpriteRendererComponent::Static.
+	* Rebakes if entity, or any of its children, may be static.
+	*/
+	static void MarkStaticDirty(Ref<Scene> scene, Entity entity)
+	{
+		if (scene->IsStatic(entity) || !scene->GetComponent<RelationshipComponent>(entity).GetChildren().empty())
+			scene->MarkStaticDirty();
+	}
+
 #pragma region TransformComponent
 
 	static void TransformComponent_GetTranslation(UUID uuid, glm::vec3* translation)
@@ -160,6 +242,7 @@ namespace GE
 			{
 				auto& trsc = scene->GetComponent<TransformComponent>(entity);
 				trsc.Translation = *translation;
+				MarkStaticDirty(scene, entity);
 
 				// Special case if Entity has Camera
 				// Ensures SceneCamera moves with parent
@@ -204,6 +287,7 @@ namespace GE
 			{
 				auto& ac = scene->GetComponent<ActiveComponent>(entity);
 				ac.Active = *active;
+				MarkStaticDirty(scene, entity);
 
 			}
 		}
@@ -231,6 +315,7 @@ namespace GE
 			{
 				auto& ac = scene->GetComponent<ActiveComponent>(entity);
 				ac.Hidden = *hidden;
+				MarkStaticDirty(scene, entity);
 
 			}
 		}
@@ -456,6 +541,7 @@ namespace GE
 			{
 				auto& src = scene->GetComponent<SpriteRendererComponent>(entity);
 				src.Color = *color;
+				MarkStaticDirty(scene, entity);
 			}
 		}
 	}
@@ -1171,6 +1257,15 @@ namespace GE
 		}
 	}
 
+	void Scripting::OnDestroyScript(Scene* scene, Entity entity)
+	{
+		if (!scene || !entity)
+			return;
+
+		UUID uuid = scene->GetComponent<IDComponent>(entity).ID;
+		s_Data.RemoveEntityInstance(uuid);
+	}
+
 	void Scripting::OnUpdateScript(Scene* scene, Entity entity, float timestep)
 	{
 		if (!scene || !entity)
@@ -1351,6 +1446,11 @@ namespace GE
 		GE_ADD_INTERNAL_CALL(Input_IsKeyDown);
 		GE_ADD_INTERNAL_CALL(Input_IsMouseDown);
 
+		GE_ADD_INTERNAL_CALL(Scene_QueryAABB);
+		GE_ADD_INTERNAL_CALL(Scene_QueryPoint);
+		GE_ADD_INTERNAL_CALL(Scene_QueryNearest);
+		GE_ADD_INTERNAL_CALL(Scene_Raycast);
+
 #pragma region Entity
 
 		GE_ADD_INTERNAL_CALL(Entity_IsHovered);
@@ -271,6 +271,11 @@ namespace GE
 				return true;
 			}
 			
+			bool RemoveEntityInstance(UUID uuid)
+			{
+				return s_Data.EntityScriptInstances.erase(uuid) > 0;
+			}
+
 			bool ClearInstances()
 			{
 				if (!s_Data.EntityScriptInstances.empty())
@@ -548,6 +553,11 @@ namespace GE
 		*/
 		static void OnCreateScript(Scene* scene, Entity entity);
 		/*
+		* Removes ScriptInstance of Entity, if any. Instance state is not kept, see ScenePartition
+		* @param entity : entity with ScriptComponent
+		*/
+		static void OnDestroyScript(Scene* scene, Entity entity);
+		/*
 		* Updates ScriptInstance if corresponding Entity UUID exists.
 		* @param entity : entity with ScriptComponent
 		* @param timestep : change in time
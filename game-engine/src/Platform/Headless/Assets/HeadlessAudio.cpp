@@ -0,0 +1,41 @@
+#include "GE/GEpch.h"
+
+#include "HeadlessAudio.h"
+
+#include "GE/Audio/AudioManager.h"
+
+namespace GE
+{
+	HeadlessAudio::HeadlessAudio(UUID handle, const Config& config) : Audio(handle, Asset::Type::Audio)
+	{
+		m_Config = Config(config);
+	}
+
+	HeadlessAudio::HeadlessAudio(UUID handle, Config&& config) : Audio(handle, Asset::Type::Audio), m_Config(std::move(config))
+	{
+
+	}
+
+	HeadlessAudio::~HeadlessAudio()
+	{
+		m_Config.ReleaseData();
+	}
+
+	Asset::MemoryUsage HeadlessAudio::GetMemoryUsage() const
+	{
+		MemoryUsage usage = MemoryUsage();
+		usage.CPU = m_Config.DataBuffer.GetSize();
+		return usage;
+	}
+
+	const uint64_t HeadlessAudio::GetBufferCount() const
+	{
+		return m_Config.DataBuffer.GetSize() > AudioManager::BUFFER_SIZE ? (m_Config.DataBuffer.GetSize() / AudioManager::BUFFER_SIZE) + 1 : 1;
+	}
+
+	const float HeadlessAudio::GetDurationInSeconds()
+	{
+		const uint64_t bytesPerSecond = (uint64_t)m_Config.SampleRate * m_Config.Channels * (m_Config.BPS / 8);
+		return bytesPerSecond ? (float)m_Config.DataBuffer.GetSize() / (float)bytesPerSecond : 0.0f;
+	}
+}
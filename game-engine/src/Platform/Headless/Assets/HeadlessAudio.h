@@ -0,0 +1,36 @@
+#pragma once
+
+#include "GE/Asset/Assets/Audio/Audio.h"
+
+namespace GE
+{
+	/*
+	* CPU-only Audio, used when AudioManager::API is None. See Application::Config::Headless
+	* Keeps data for serialization, has no buffers to play
+	*/
+	class HeadlessAudio : public Audio
+	{
+	public:
+		HeadlessAudio(UUID handle, const Config& config);
+		HeadlessAudio(UUID handle, Config&& config);
+		~HeadlessAudio() override;
+
+		Ref<Asset> GetCopy() override { return nullptr; }
+		MemoryUsage GetMemoryUsage() const override;
+		bool ReleaseCPUData() override { return false; }
+
+		const uint32_t& GetID() const override { return m_ID; }
+		const Config& GetConfig() const override { return m_Config; }
+		const uint64_t GetBufferCount() const override;
+
+		const float GetDurationInSeconds() override;
+		const std::vector<uint32_t>& GenerateBuffers(const uint32_t& count = 1) override { return m_Config.BufferIDs; }
+		void SetBufferData() override {}
+		void ClearBuffers() override {}
+	private:
+		void AddID(const uint32_t& id) override {}
+	private:
+		Config m_Config;
+		const uint32_t m_ID = 0;
+	};
+}
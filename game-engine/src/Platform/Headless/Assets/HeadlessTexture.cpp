@@ -0,0 +1,67 @@
+#include "GE/GEpch.h"
+
+#include "HeadlessTexture.h"
+
+namespace GE
+{
+	HeadlessTexture2D::HeadlessTexture2D(UUID handle, const Config& textureConfig, Buffer data /* = Buffer() */)
+	{
+		p_Handle = handle;
+		p_Type = Asset::Type::Texture2D;
+		m_Config = Config(textureConfig.Width, textureConfig.Height, 0, textureConfig.GenerateMips);
+		m_Config.InternalFormat = textureConfig.InternalFormat;
+		m_Config.Format = textureConfig.Format;
+
+		if (data)
+			SetData(data);
+	}
+
+	HeadlessTexture2D::HeadlessTexture2D(UUID handle, const Config& textureConfig, ScopedBuffer&& data)
+		: HeadlessTexture2D(handle, textureConfig)
+	{
+		if (data)
+		{
+			CheckOpacity(data.GetView());
+			m_Config.TextureBuffer = data.Detach();
+		}
+	}
+
+	HeadlessTexture2D::~HeadlessTexture2D()
+	{
+		m_Config.TextureBuffer.Release();
+	}
+
+	Asset::MemoryUsage HeadlessTexture2D::GetMemoryUsage() const
+	{
+		MemoryUsage usage = MemoryUsage();
+		usage.CPU = m_Config.TextureBuffer.GetSize();
+		return usage;
+	}
+
+	void HeadlessTexture2D::SetData(Buffer data)
+	{
+		CheckOpacity(data);
+
+		if (m_Config.TextureBuffer)
+			m_Config.TextureBuffer.Release();
+		m_Config.TextureBuffer = Buffer(data.As<void>(), data.GetSize());
+	}
+
+	void HeadlessTexture2D::CheckOpacity(const Buffer& data)
+	{
+		// Same as OpenGLTexture2D, pack readers expect it
+		m_Opaque = true;
+		if (m_Config.Format == DataFormat::RGBA)
+		{
+			const uint8_t* texels = data.As<uint8_t>();
+			for (uint64_t i = 3; i < data.GetSize(); i += 4)
+			{
+				if (texels[i] != 0xFF)
+				{
+					m_Opaque = false;
+					break;
+				}
+			}
+		}
+	}
+}
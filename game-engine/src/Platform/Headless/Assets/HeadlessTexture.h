@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GE/Asset/Assets/Textures/Texture.h"
+
+namespace GE
+{
+	/*
+	* CPU-only Texture2D, used when no Renderer exists. See Application::Config::Headless
+	* Keeps data for serialization, never bound
+	*/
+	class HeadlessTexture2D : public Texture2D
+	{
+	public:
+		bool operator==(const Texture& other) const override { return this == &other; };
+
+		HeadlessTexture2D(UUID handle, const Config& textureConfig, Buffer data = Buffer());
+		HeadlessTexture2D(UUID handle, const Config& textureConfig, ScopedBuffer&& data);
+		~HeadlessTexture2D() override;
+
+		// Asset overrides
+		Ref<Asset> GetCopy() override { return nullptr; }
+		MemoryUsage GetMemoryUsage() const override;
+		bool ReleaseCPUData() override { return false; }
+
+		// Texture2D overrides
+		const Config& GetConfig() const override { return m_Config; }
+		const uint32_t& GetWidth() const override { return m_Config.Width; }
+		const uint32_t& GetHeight() const override { return m_Config.Height; }
+		const uint32_t& GetID() const override { return m_Config.RendererID; }
+		bool IsOpaque() const override { return m_Opaque; }
+
+		void Bind(uint32_t slot = 0) const override {}
+		void Unbind() const override {}
+	private:
+		void SetData(Buffer data) override;
+		void CheckOpacity(const Buffer& data);
+
+	private:
+		Config m_Config;
+		bool m_Opaque = true;
+	};
+}
@@ -16,12 +16,37 @@ namespace GE
         SetBufferData();
     }
 
+    OpenALAudio::OpenALAudio(UUID handle, Config&& config, const uint32_t& bufferCount) : Audio(handle, Asset::Type::Audio), m_Config(std::move(config))
+    {
+        GenerateBuffers(bufferCount);
+        SetBufferData();
+    }
+
     OpenALAudio::~OpenALAudio()
     {
         ClearBuffers();
         m_Config.ReleaseData();
     }
 
+    Asset::MemoryUsage OpenALAudio::GetMemoryUsage() const
+    {
+        MemoryUsage usage = MemoryUsage();
+        usage.CPU = m_Config.DataBuffer.GetSize();
+        // Each AL buffer is filled with AudioManager::BUFFER_SIZE, see SetBufferData()
+        usage.GPU = (uint64_t)m_Config.BufferIDs.size() * AudioManager::BUFFER_SIZE;
+        return usage;
+    }
+
+    bool OpenALAudio::ReleaseCPUData()
+    {
+        if (!m_Config.DataBuffer)
+            return false;
+
+        // AL keeps its own copy after alBufferData()
+        m_Config.ReleaseData();
+        return true;
+    }
+
     const float OpenALAudio::GetDurationInSeconds()
     {
         float totalDuration = 0.0f;
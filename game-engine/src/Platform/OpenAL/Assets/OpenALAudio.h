@@ -6,9 +6,12 @@ namespace GE
 	{
 	public:
 		OpenALAudio(UUID handle, const Config& config, const uint32_t& bufferCount = 1);
+		OpenALAudio(UUID handle, Config&& config, const uint32_t& bufferCount = 1);
 		~OpenALAudio() override;
 
 		Ref<Asset> GetCopy() override { return nullptr; }
+		MemoryUsage GetMemoryUsage() const override;
+		bool ReleaseCPUData() override;
 
 		/*
 		* returns front of BufferIDs
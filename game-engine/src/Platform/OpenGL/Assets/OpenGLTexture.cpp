@@ -25,6 +25,24 @@ namespace GE
 		return NULL;
 	}
 
+	/*
+	* Device bytes per texel of internal format. 3 channel formats are padded to 4 by drivers.
+	*/
+	static uint32_t GLBytesPerTexel(GLenum internalFormat)
+	{
+		switch (internalFormat)
+		{
+		case GL_R8:
+			return 1;
+		case GL_RGB8:
+		case GL_RGBA8:
+			return 4;
+		case GL_RGBA32F:
+			return 16;
+		}
+		return 4;
+	}
+
 	static GLenum GLDataFormatFromDataFormat(const Texture::DataFormat& format)
 	{
 		switch (format)
@@ -59,6 +77,16 @@ namespace GE
 			SetData(data);
 	}
 
+	OpenGLTexture2D::OpenGLTexture2D(UUID handle, const Config& textureConfig, ScopedBuffer&& data)
+		: OpenGLTexture2D(handle, textureConfig)
+	{
+		if (data)
+		{
+			Upload(data.GetView());
+			m_Config.TextureBuffer = data.Detach();
+		}
+	}
+
 	OpenGLTexture2D::~OpenGLTexture2D()
 	{
 		glDeleteTextures(1, &m_Config.RendererID);
@@ -71,7 +99,38 @@ namespace GE
 		return nullptr;
 	}
 
+	Asset::MemoryUsage OpenGLTexture2D::GetMemoryUsage() const
+	{
+		MemoryUsage usage = MemoryUsage();
+		usage.CPU = m_Config.TextureBuffer.GetSize();
+
+		uint64_t texels = (uint64_t)m_Config.Width * m_Config.Height;
+		usage.GPU = texels * GLBytesPerTexel(GLInternalFormatFromImageFormat(m_Config.InternalFormat));
+		// Full mip chain adds a third
+		if (m_Config.GenerateMips)
+			usage.GPU += usage.GPU / 3;
+		return usage;
+	}
+
+	bool OpenGLTexture2D::ReleaseCPUData()
+	{
+		if (!m_Config.TextureBuffer)
+			return false;
+
+		m_Config.TextureBuffer.Release();
+		return true;
+	}
+
 	void OpenGLTexture2D::SetData(Buffer data)
+	{
+		Upload(data);
+
+		if (m_Config.TextureBuffer)
+			m_Config.TextureBuffer.Release();
+		m_Config.TextureBuffer = Buffer(data.As<void>(), data.GetSize());
+	}
+
+	void OpenGLTexture2D::Upload(const Buffer& data)
 	{
 		GE_PROFILE_FUNCTION();
 
@@ -92,9 +151,20 @@ namespace GE
 		if (m_Config.GenerateMips)
 			glGenerateMipmap(GL_TEXTURE_2D);
 
-		if (m_Config.TextureBuffer)
-			m_Config.TextureBuffer.Release();
-		m_Config.TextureBuffer = Buffer(data.As<void>(), data.GetSize());
+		// Check alpha once, so Renderer can classify sprites without reading back texels
+		m_Opaque = true;
+		if (bpp == 4)
+		{
+			const uint8_t* texels = data.As<uint8_t>();
+			for (uint64_t i = 3; i < data.GetSize(); i += 4)
+			{
+				if (texels[i] != 0xFF)
+				{
+					m_Opaque = false;
+					break;
+				}
+			}
+		}
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
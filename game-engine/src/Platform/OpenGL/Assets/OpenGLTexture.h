@@ -10,23 +10,32 @@ namespace GE
 		bool operator==(const Texture& other) const override { return this->GetID() == ((Texture&)other).GetID(); };
 
 		OpenGLTexture2D(UUID handle, const Config& textureConfig, Buffer data = Buffer());
+		OpenGLTexture2D(UUID handle, const Config& textureConfig, ScopedBuffer&& data);
 		~OpenGLTexture2D() override;
 
 		// Asset overrides
 		Ref<Asset> GetCopy() override;
+		MemoryUsage GetMemoryUsage() const override;
+		bool ReleaseCPUData() override;
 
 		// Texture2D overrides
 		const Config& GetConfig() const override { return m_Config; }
 		const uint32_t& GetWidth() const override { return m_Config.Width; }
 		const uint32_t& GetHeight() const override { return m_Config.Height; }
 		const uint32_t& GetID() const override { return m_Config.RendererID; }
+		bool IsOpaque() const override { return m_Opaque; }
 
 		void Bind(uint32_t slot = 0) const override;
 		void Unbind() const override;
 	private:
 		void SetData(Buffer data) override;
+		/*
+		* Uploads data & checks opacity, doesn't keep it
+		*/
+		void Upload(const Buffer& data);
 
 	private:
 		Config m_Config;
+		bool m_Opaque = true;
 	};
 }
\ No newline at end of file
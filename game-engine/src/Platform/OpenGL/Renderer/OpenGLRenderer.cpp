@@ -2,6 +2,7 @@
 
 #include "OpenGLRenderer.h"
 
+#include "GE/Asset/Assets/Font/GlyphCache.h"
 #include "GE/Asset/Assets/Scene/Entity.h"
 #include "GE/Asset/Assets/Scene/Scene.h"
 
@@ -17,6 +18,91 @@ namespace GE
 	OpenGLRenderer::API OpenGLRenderer::Data::RenderAPI = OpenGLRenderer::API::OpenGL;
 	OpenGLRenderer::Data OpenGLRenderer::s_Data = OpenGLRenderer::Data();
 
+	/*
+	* Reallocates batch vertices to hold spawns, keeping vertices already written.
+	* spawns must be at least the number of spawns already written.
+	*
+	* @param capacity : batch capacity to update
+	* @param base : CPU vertices, reallocated
+	* @param ptr : next vertex to write, moved to new allocation
+	* @param vertexBuffer : GPU vertices, resized
+	* @param verticesPerSpawn : 4 for quads, 2 for lines
+	* @param spawns : new capacity, in spawns
+	*/
+	template<typename Vertex>
+	static void ResizeBatch(Renderer::BatchCapacity& capacity, Vertex*& base, Vertex*& ptr, Ref<VertexBuffer> vertexBuffer,
+		uint32_t verticesPerSpawn, uint32_t spawns)
+	{
+		GE_PROFILE_FUNCTION();
+
+		const size_t written = (size_t)(ptr - base);
+		Vertex* vertices = new Vertex[spawns * verticesPerSpawn];
+		if (written)
+			memcpy(vertices, base, written * sizeof(Vertex));
+		delete[] base;
+
+		base = vertices;
+		ptr = vertices + written;
+		vertexBuffer->Resize(spawns * verticesPerSpawn * sizeof(Vertex));
+		capacity.Spawns = spawns;
+	}
+
+	/*
+	* Returns new capacity for a full batch, or 0 if already at max.
+	*/
+	static uint32_t GetGrownCapacity(const Renderer::BatchCapacity& capacity, uint32_t maxSpawns)
+	{
+		if (capacity.Spawns >= maxSpawns)
+			return 0;
+		return std::min(capacity.Spawns * 2, maxSpawns);
+	}
+
+	/*
+	* Returns capacity for batch after this frame, or 0 to keep current capacity.
+	* Updates LowFrames.
+	*/
+	static uint32_t GetShrunkCapacity(Renderer::BatchCapacity& capacity, uint32_t minSpawns, uint32_t maxSpawns, uint32_t shrinkFrames)
+	{
+		if (capacity.Spawns <= minSpawns)
+		{
+			capacity.LowFrames = 0;
+			return 0;
+		}
+
+		// Above cap, from a lowered cap. Shrink as soon as usage allows
+		if (capacity.Spawns > maxSpawns && capacity.Peak <= maxSpawns)
+		{
+			capacity.LowFrames = 0;
+			return maxSpawns;
+		}
+
+		if (capacity.Peak >= capacity.Spawns / 4)
+		{
+			capacity.LowFrames = 0;
+			return 0;
+		}
+
+		if (++capacity.LowFrames < shrinkFrames)
+			return 0;
+
+		capacity.LowFrames = 0;
+		return std::max(capacity.Spawns / 2, minSpawns);
+	}
+
+	/*
+	* Shrinks batch after sustained low usage, see GetShrunkCapacity(), & resets its Peak.
+	*
+	* @param batch : QuadData, CircleData, LineData or TextData
+	* @param verticesPerSpawn : 4 for quads, 2 for lines
+	*/
+	template<typename Batch>
+	static void ShrinkBatch(Batch& batch, uint32_t verticesPerSpawn, uint32_t minSpawns, uint32_t maxSpawns, uint32_t shrinkFrames)
+	{
+		if (uint32_t spawns = GetShrunkCapacity(batch.Capacity, minSpawns, maxSpawns, shrinkFrames))
+			ResizeBatch(batch.Capacity, batch.VertexBufferBase, batch.VertexBufferPtr, batch.VertexBuffer, verticesPerSpawn, spawns);
+		batch.Capacity.Peak = 0;
+	}
+
 	OpenGLRenderer::OpenGLRenderer()
 	{
 		GE_PROFILE_FUNCTION();
@@ -32,8 +118,10 @@ namespace GE
 
 	void OpenGLRenderer::CreateData()
 	{
-		//Creates Index Buffer - Can be used for both Quad & Circle
-		Ref<IndexBuffer> indexBuffer = IndexBuffer::Create(s_Data.MaxIndices);
+		//Creates Index Buffer - Can be used for Quad, Circle & Text
+		s_Data.IndexCapacity = s_Data.MinSpawns;
+		s_Data.SharedIndexBuffer = IndexBuffer::Create(s_Data.IndexCapacity * 6);
+		Ref<IndexBuffer> indexBuffer = s_Data.SharedIndexBuffer;
 
 		// Quad/Sprite Rendering Setup
 		{
@@ -43,7 +131,8 @@ namespace GE
 			//Creates Vertex Array
 			s_Data.quadData.VertexArray = VertexArray::Create();
 
-			s_Data.quadData.VertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
+			s_Data.quadData.Capacity.Spawns = s_Data.MinSpawns;
+			s_Data.quadData.VertexBuffer = VertexBuffer::Create(s_Data.MinSpawns * 4 * sizeof(QuadVertex));
 			//Sets up Layout using Vertex Buffer
 			VertexBuffer::Layout layout =
 			{
@@ -61,7 +150,7 @@ namespace GE
 
 			//Add Index Buffer to Vertex Array
 			s_Data.quadData.VertexArray->AddIndexBuffer(indexBuffer);
-			s_Data.quadData.VertexBufferBase = new QuadVertex[s_Data.MaxVertices];
+			s_Data.quadData.VertexBufferBase = new QuadVertex[s_Data.MinSpawns * 4];
 
 			// Texture Creation
 			uint32_t textureData = 0xFFFFFFFF;
@@ -75,6 +164,8 @@ namespace GE
 
 			s_Data.quadData.Shader = Shader::Create("assets/shaders/Renderer2D_Sprite.glsl");
 			s_Data.quadData.Shader->SetIntArray("u_Textures", samplers, s_Data.spriteData.MaxTextureSlots);
+			s_Data.quadData.OpaqueShader = Shader::Create("assets/shaders/Renderer2D_SpriteOpaque.glsl");
+			s_Data.quadData.OpaqueShader->SetIntArray("u_Textures", samplers, s_Data.spriteData.MaxTextureSlots);
 
 			s_Data.spriteData.TextureSlots[0] = s_Data.spriteData.EmptyTexture;
 
@@ -131,7 +222,8 @@ namespace GE
 			//Creates Vertex Array
 			s_Data.circleData.VertexArray = VertexArray::Create();
 
-			s_Data.circleData.VertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(CircleVertex));
+			s_Data.circleData.Capacity.Spawns = s_Data.MinSpawns;
+			s_Data.circleData.VertexBuffer = VertexBuffer::Create(s_Data.MinSpawns * 4 * sizeof(CircleVertex));
 			//Sets up Layout using Vertex Buffer
 			VertexBuffer::Layout layout =
 			{
@@ -149,7 +241,7 @@ namespace GE
 			s_Data.circleData.VertexArray->AddVertexBuffer(s_Data.circleData.VertexBuffer);
 			//Add Index Buffer to Vertex Array
 			s_Data.circleData.VertexArray->AddIndexBuffer(indexBuffer);
-			s_Data.circleData.VertexBufferBase = new CircleVertex[s_Data.MaxVertices];
+			s_Data.circleData.VertexBufferBase = new CircleVertex[s_Data.MinSpawns * 4];
 
 			s_Data.circleData.Shader = Shader::Create("assets/shaders/Renderer2D_Circle.glsl");
 		}
@@ -161,7 +253,8 @@ namespace GE
 			//Creates Vertex Array
 			s_Data.lineData.VertexArray = VertexArray::Create();
 
-			s_Data.lineData.VertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(LineVertex));
+			s_Data.lineData.Capacity.Spawns = s_Data.MinSpawns;
+			s_Data.lineData.VertexBuffer = VertexBuffer::Create(s_Data.MinSpawns * 2 * sizeof(LineVertex));
 			//Sets up Layout using Vertex Buffer
 			VertexBuffer::Layout layout =
 			{
@@ -174,7 +267,7 @@ namespace GE
 			//Add Vertex Buffer to Vertex Array
 			s_Data.lineData.VertexArray->AddVertexBuffer(s_Data.lineData.VertexBuffer);
 
-			s_Data.lineData.VertexBufferBase = new LineVertex[s_Data.MaxVertices];
+			s_Data.lineData.VertexBufferBase = new LineVertex[s_Data.MinSpawns * 2];
 
 			s_Data.lineData.Shader = Shader::Create("assets/shaders/Renderer2D_Line.glsl");
 		}
@@ -186,7 +279,8 @@ namespace GE
 			//Creates Vertex Array
 			s_Data.textData.VertexArray = VertexArray::Create();
 
-			s_Data.textData.VertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(TextVertex));
+			s_Data.textData.Capacity.Spawns = s_Data.MinSpawns;
+			s_Data.textData.VertexBuffer = VertexBuffer::Create(s_Data.MinSpawns * 4 * sizeof(TextVertex));
 			//Sets up Layout using Vertex Buffer
 			VertexBuffer::Layout layout =
 			{
@@ -194,6 +288,7 @@ namespace GE
 				{ GE::Math::Type::Float4,	"a_TextColor"	 },
 				{ GE::Math::Type::Float4,	"a_BGColor"		 },
 				{ GE::Math::Type::Float2,	"a_TextureCoord" },
+				{ GE::Math::Type::Int,	"a_AtlasIndex"	 },
 				{ GE::Math::Type::Int,	"a_EntityID"	 }
 			};
 			s_Data.textData.VertexBuffer->SetLayout(layout);
@@ -203,10 +298,17 @@ namespace GE
 
 			//Add Index Buffer to Vertex Array
 			s_Data.textData.VertexArray->AddIndexBuffer(indexBuffer);
-			s_Data.textData.VertexBufferBase = new TextVertex[s_Data.MaxVertices];
+			s_Data.textData.VertexBufferBase = new TextVertex[s_Data.MinSpawns * 4];
 
 			// Shader Creation
 			s_Data.textData.Shader = Shader::Create("assets/shaders/Renderer2D_Text.glsl");
+
+			int32_t samplers[s_Data.textData.MaxAtlasSlots];
+			for (uint32_t i = 0; i < s_Data.textData.MaxAtlasSlots; i++)
+			{
+				samplers[i] = i;
+			}
+			s_Data.textData.Shader->SetIntArray("u_TextAtlases", samplers, s_Data.textData.MaxAtlasSlots);
 		}
 	}
 
@@ -236,7 +338,9 @@ namespace GE
 		GE_PROFILE_FUNCTION();
 
 		const glm::mat4 viewProjection = camera->GetViewProjection();
+		s_Data.quadData.ViewProjection = viewProjection;
 		s_Data.quadData.Shader->SetMat4("u_ViewProjection", viewProjection);
+		s_Data.quadData.OpaqueShader->SetMat4("u_ViewProjection", viewProjection);
 		s_Data.circleData.Shader->SetMat4("u_ViewProjection", viewProjection);
 		s_Data.lineData.Shader->SetMat4("u_ViewProjection", viewProjection);
 		s_Data.textData.Shader->SetMat4("u_ViewProjection", viewProjection);
@@ -245,7 +349,6 @@ namespace GE
 		ResetCircleData();
 		ResetLineData();
 		ResetTextData();
-
 	}
 
 	void OpenGLRenderer::End()
@@ -257,20 +360,84 @@ namespace GE
 
 	void OpenGLRenderer::Flush()
 	{
-		if (s_Data.quadData.IndexCount)
+		s_Data.quadData.Capacity.Peak = std::max(s_Data.quadData.Capacity.Peak, s_Data.quadData.IndexCount / 6);
+		s_Data.circleData.Capacity.Peak = std::max(s_Data.circleData.Capacity.Peak, s_Data.circleData.IndexCount / 6);
+		s_Data.lineData.Capacity.Peak = std::max(s_Data.lineData.Capacity.Peak, s_Data.lineData.IndexCount / 2);
+		s_Data.textData.Capacity.Peak = std::max(s_Data.textData.Capacity.Peak, s_Data.textData.IndexCount / 6);
+
+		if (s_Data.quadData.IndexCount || !s_Data.quadData.StaticSpawns.empty())
 		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.quadData.VertexBufferPtr - (uint8_t*)s_Data.quadData.VertexBufferBase);
-			s_Data.quadData.VertexBuffer->SetData(s_Data.quadData.VertexBufferBase, dataSize);
+			// Counts after sorting, opaque spawns may move into translucent pass
+			SortQuadData();
+			const uint32_t opaqueCount = (uint32_t)s_Data.quadData.OpaqueSpawns.size();
+			const uint32_t translucentCount = (uint32_t)s_Data.quadData.TranslucentSpawns.size();
+			if (s_Data.quadData.IndexCount)
+				s_Data.quadData.VertexBuffer->SetData(s_Data.quadData.SortedVertices.data(), (opaqueCount + translucentCount) * 4 * sizeof(QuadVertex));
 
 			// Bind Textures
 			for (uint32_t i = 0; i < s_Data.spriteData.TextureSlotIndex; i++)
 				s_Data.spriteData.TextureSlots[i]->Bind(i);
 
-			// Draw Quad Indices
+			// Depth only orders quads within this Flush.
+			// Previous Layers, static batches & mid-frame Flushes stay underneath in submission order
+			glClear(GL_DEPTH_BUFFER_BIT);
+			// LEQUAL, so equal depths keep submission order like blending did
+			glEnable(GL_DEPTH_TEST);
+			glDepthFunc(GL_LEQUAL);
+
+			// Draw Opaque Quad Indices, front-to-back writing depth
+			if (opaqueCount)
+			{
+				glDepthMask(GL_TRUE);
+				glDisable(GL_BLEND);
+				s_Data.quadData.OpaqueShader->Bind();
+				DrawIndices(s_Data.quadData.VertexArray, opaqueCount * 6);
+				s_Data.quadData.OpaqueShader->Unbind();
+				glEnable(GL_BLEND);
+				s_Data.Stats.DrawCalls++;
+			}
+
+			// Draw Translucent Quad Indices, back-to-front tested against opaque depth
+			// Static batches are drawn in between, at their depth
+			glDepthMask(GL_FALSE);
 			s_Data.quadData.Shader->Bind();
-			DrawIndices(s_Data.quadData.VertexArray, s_Data.quadData.IndexCount);
+			uint32_t drawnCount = 0;
+			for (const QuadData::StaticSpawn& staticSpawn : s_Data.quadData.StaticSpawns)
+			{
+				uint32_t behindCount = drawnCount;
+				while (behindCount < translucentCount && s_Data.quadData.TranslucentSpawns[behindCount].Depth > staticSpawn.Depth)
+					behindCount++;
+				if (behindCount > drawnCount)
+				{
+					DrawIndices(s_Data.quadData.VertexArray, (behindCount - drawnCount) * 6, (opaqueCount + drawnCount) * 6);
+					s_Data.Stats.DrawCalls++;
+					drawnCount = behindCount;
+				}
+
+				// LESS, so opaque spawns of equal depth stay over batch
+				glDepthFunc(GL_LESS);
+				s_Data.spriteData.EmptyTexture->Bind(0);
+				if (staticSpawn.Batch->Texture)
+					staticSpawn.Batch->Texture->Bind(1);
+				DrawIndices(staticSpawn.Batch->VertexArray, staticSpawn.Batch->SpawnCount * 6);
+				glDepthFunc(GL_LEQUAL);
+				s_Data.Stats.DrawCalls++;
+				s_Data.Stats.StaticSpawnCount += staticSpawn.Batch->SpawnCount;
+
+				// Restore slots batch replaced
+				for (uint32_t i = 0; i < 2 && i < s_Data.spriteData.TextureSlotIndex; i++)
+					s_Data.spriteData.TextureSlots[i]->Bind(i);
+			}
+			if (translucentCount > drawnCount)
+			{
+				DrawIndices(s_Data.quadData.VertexArray, (translucentCount - drawnCount) * 6, (opaqueCount + drawnCount) * 6);
+				s_Data.Stats.DrawCalls++;
+			}
 			s_Data.quadData.Shader->Unbind();
-			s_Data.Stats.DrawCalls++;
+
+			// Other batches are drawn in submission order, as before
+			glDepthMask(GL_TRUE);
+			glDisable(GL_DEPTH_TEST);
 		}
 
 		if (s_Data.circleData.IndexCount)
@@ -305,8 +472,9 @@ namespace GE
 			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.textData.VertexBufferPtr - (uint8_t*)s_Data.textData.VertexBufferBase);
 			s_Data.textData.VertexBuffer->SetData(s_Data.textData.VertexBufferBase, dataSize);
 
-			// Bind Text Texture
-			s_Data.textData.AtlasTexture->Bind();
+			// Bind Text Atlases
+			for (uint32_t i = 0; i < s_Data.textData.AtlasSlotIndex; i++)
+				s_Data.textData.AtlasSlots[i]->Bind(i);
 
 			// Draw Text Indices
 			s_Data.textData.Shader->Bind();
@@ -355,69 +523,43 @@ namespace GE
 	{
 		glm::vec2 ret = glm::vec2(1.0f);
 
-		Ref<Font> font = Project::GetAsset<Font>(fontHandle);
-		if (!font || !font->GetAtlasTexture() || !font->GetMSDFData())
+		Ref<Font> font = Project::GetAssetAsync<Font>(fontHandle);
+		if (!font || !font->GetAtlasTexture() || font->GetGlyphTable().IsEmpty())
 			return ret;
 
-		Ref<Texture2D> atlasTexture = font->GetAtlasTexture();
-		Ref<Font::MSDFData> msdfData = font->GetMSDFData();
+		const Font::GlyphTable& glyphTable = font->GetGlyphTable();
 
-		const auto& metrics = msdfData->FontGeometry.getMetrics();
-		double fsScale = scalar / (metrics.ascenderY - metrics.descenderY);
+		const Font::Metrics& metrics = glyphTable.FontMetrics;
+		double fsScale = scalar / (metrics.AscenderY - metrics.DescenderY);
 		double x = 0.0 + offset.x;
 		double y = 0.0 + offset.y;
 
-		float texelWidth = 1.0f / (float)atlasTexture->GetWidth();
-		float texelHeight = 1.0f / (float)atlasTexture->GetHeight();
-
-		for (size_t i = 0; i < text.size(); i++)
+		size_t i = 0;
+		while (i < text.size())
 		{
-			char character = text[i];
+			uint32_t character = GetNextCodepoint(text, i);
 			if (character == '\r')
 				continue;
 
 			if (character == '\n' || character == '\0')
 			{
 				x = 0.0;
-				y += fsScale * metrics.lineHeight + lineHeightOffset;
+				y += fsScale * metrics.LineHeight + lineHeightOffset;
 				continue;
 			}
-			if (auto glyph = msdfData->FontGeometry.getGlyph(character))
-			{
-				if (!glyph)
-				{
-					if (character == '\t')
-						glyph = msdfData->FontGeometry.getGlyph(' ');
-					if (!glyph)
-						glyph = msdfData->FontGeometry.getGlyph('?');
-				}
-
-				double al, ab, ar, at;
-				glyph->getQuadAtlasBounds(al, ab, ar, at);
-				glm::vec2 texCoordMin((float)al, (float)ab);
-				glm::vec2 texCoordMax((float)ar, (float)at);
-
-				double pl, pb, pr, pt;
-				glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-				glm::vec2 quadMin((float)pl, (float)pb);
-				glm::vec2 quadMax((float)pr, (float)pt);
 
-				quadMin *= fsScale;
-				quadMax *= fsScale;
-				quadMin += glm::vec2(x, y);
-				quadMax += glm::vec2(x, y);
-
-				texCoordMin *= glm::vec2(texelWidth, texelHeight);
-				texCoordMax *= glm::vec2(texelWidth, texelHeight);
+			Ref<Texture2D> glyphTexture = nullptr;
+			const Font::Glyph* glyph = GetTextGlyph(font, character, glyphTexture);
+			if (!glyph)
+				continue;
 
-				if (i < text.size() - 1)
-				{
-					double advance = glyph->getAdvance();
-					char nextCharacter = text[i + 1];
-					msdfData->FontGeometry.getAdvance(advance, character, nextCharacter);
+			if (i < text.size())
+			{
+				size_t next = i;
+				uint32_t nextCharacter = GetNextCodepoint(text, next);
+				double advance = glyphTable.GetAdvance(*glyph, nextCharacter);
 
-					x += fsScale * advance + kerningOffset;
-				}
+				x += fsScale * advance + kerningOffset;
 			}
 		}
 
@@ -430,10 +572,10 @@ namespace GE
 		return ret;
 	}
 
-	void OpenGLRenderer::DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount)
+	void OpenGLRenderer::DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount, uint32_t firstIndex)
 	{
 		vertexArray->Bind();
-		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (const void*)(firstIndex * sizeof(uint32_t)));
 		vertexArray->Unbind();
 
 	}
@@ -453,7 +595,66 @@ namespace GE
 
 	void OpenGLRenderer::ClearStats()
 	{
+		UpdateCapacities();
+
 		memset(&s_Data.Stats, 0, sizeof(Renderer::Statistics));
+		s_Data.Stats.QuadCapacity = s_Data.quadData.Capacity.Spawns;
+		s_Data.Stats.CircleCapacity = s_Data.circleData.Capacity.Spawns;
+		s_Data.Stats.LineCapacity = s_Data.lineData.Capacity.Spawns;
+		s_Data.Stats.TextCapacity = s_Data.textData.Capacity.Spawns;
+	}
+
+	void OpenGLRenderer::AddEntityStats(uint32_t drawn, uint32_t culled)
+	{
+		s_Data.Stats.DrawnCount += drawn;
+		s_Data.Stats.CulledCount += culled;
+	}
+#pragma endregion
+
+#pragma region Batch Capacity
+	void OpenGLRenderer::SetMaxSpawns(uint32_t spawns)
+	{
+		s_Data.MaxSpawns = std::max(spawns, s_Data.MinSpawns);
+	}
+
+	template<typename Batch>
+	void OpenGLRenderer::ReserveData(Batch& batch, uint32_t verticesPerSpawn, uint32_t indicesPerSpawn, bool indexed)
+	{
+		if (batch.IndexCount / indicesPerSpawn < batch.Capacity.Spawns)
+			return;
+
+		if (uint32_t spawns = GetGrownCapacity(batch.Capacity, s_Data.MaxSpawns))
+		{
+			ResizeBatch(batch.Capacity, batch.VertexBufferBase, batch.VertexBufferPtr, batch.VertexBuffer, verticesPerSpawn, spawns);
+			if (indexed && spawns > s_Data.IndexCapacity)
+			{
+				s_Data.IndexCapacity = spawns;
+				s_Data.SharedIndexBuffer->Resize(spawns * 6);
+			}
+			return;
+		}
+
+		s_Data.Stats.CapacityFlushes++;
+		Flush();
+	}
+
+	void OpenGLRenderer::UpdateCapacities()
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Stats are cleared between frames, batches are empty
+		ShrinkBatch(s_Data.quadData, 4, s_Data.MinSpawns, s_Data.MaxSpawns, s_Data.ShrinkFrames);
+		ShrinkBatch(s_Data.circleData, 4, s_Data.MinSpawns, s_Data.MaxSpawns, s_Data.ShrinkFrames);
+		ShrinkBatch(s_Data.lineData, 2, s_Data.MinSpawns, s_Data.MaxSpawns, s_Data.ShrinkFrames);
+		ShrinkBatch(s_Data.textData, 4, s_Data.MinSpawns, s_Data.MaxSpawns, s_Data.ShrinkFrames);
+
+		// Shared by indexed batches, only needs to fit the largest
+		uint32_t indexCapacity = std::max({ s_Data.quadData.Capacity.Spawns, s_Data.circleData.Capacity.Spawns, s_Data.textData.Capacity.Spawns });
+		if (indexCapacity < s_Data.IndexCapacity)
+		{
+			s_Data.IndexCapacity = indexCapacity;
+			s_Data.SharedIndexBuffer->Resize(indexCapacity * 6);
+		}
 	}
 #pragma endregion
 
@@ -468,9 +669,25 @@ namespace GE
 			return;
 		}
 		QuadData::Vertices& vertices = s_Data.quadData.PivotPoints.at(pivot);
+		glm::vec2 ndcMin = glm::vec2(FLT_MAX);
+		glm::vec2 ndcMax = glm::vec2(-FLT_MAX);
+		float depth = 0.0f;
+		bool inFront = true;
 		for (int i = 0; i < 4; i++)
 		{
-			s_Data.quadData.VertexBufferPtr->Position = transform * vertices[i];
+			const glm::vec4 position = transform * vertices[i];
+			const glm::vec4 clip = s_Data.quadData.ViewProjection * position;
+			if (clip.w > 0.0f)
+			{
+				const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+				ndcMin = glm::min(ndcMin, glm::vec2(ndc));
+				ndcMax = glm::max(ndcMax, glm::vec2(ndc));
+				depth += ndc.z * 0.25f;
+			}
+			else
+				inFront = false;
+
+			s_Data.quadData.VertexBufferPtr->Position = position;
 			s_Data.quadData.VertexBufferPtr->Color = color;
 			s_Data.quadData.VertexBufferPtr->TextureCoord = textureCoords[i];
 			s_Data.quadData.VertexBufferPtr->TextureIndex = textureIndex;
@@ -479,15 +696,98 @@ namespace GE
 			s_Data.quadData.VertexBufferPtr++;
 		}
 	
+		// Opaque if neither color nor texture can blend
+		const Ref<Texture2D>& texture = s_Data.spriteData.TextureSlots[textureIndex];
+		const QuadData::Spawn spawn = { depth, s_Data.quadData.IndexCount / 6 };
+		if (color.a >= 1.0f && texture && texture->IsOpaque())
+		{
+			s_Data.quadData.OpaqueSpawns.push_back(spawn);
+			s_Data.Stats.OpaqueCount++;
+		}
+		else
+		{
+			s_Data.quadData.TranslucentSpawns.push_back(spawn);
+			s_Data.Stats.TranslucentCount++;
+		}
+
+		// Fraction of viewport covered, from clipped NDC bounds. NDC spans 2x2
+		if (inFront)
+		{
+			const glm::vec2 size = glm::min(ndcMax, glm::vec2(1.0f)) - glm::max(ndcMin, glm::vec2(-1.0f));
+			if (size.x > 0.0f && size.y > 0.0f)
+				s_Data.Stats.Overdraw += size.x * size.y * 0.25f;
+		}
+
 		// Update Index & Spawn Count
 		s_Data.quadData.IndexCount += 6;
 		s_Data.Stats.SpawnCount++;
 	}
 
+	void OpenGLRenderer::SortQuadData()
+	{
+		GE_PROFILE_FUNCTION();
+
+		// Static batches are submitted first per Open/Close, so stable keeps them under spawns of equal depth
+		std::stable_sort(s_Data.quadData.StaticSpawns.begin(), s_Data.quadData.StaticSpawns.end(),
+			[](const QuadData::StaticSpawn& a, const QuadData::StaticSpawn& b) { return a.Depth > b.Depth; });
+
+		// Smaller NDC depth is closer. Translucent back-to-front, equal depths in submission order
+		auto backToFront = [](const QuadData::Spawn& a, const QuadData::Spawn& b)
+			{ return a.Depth > b.Depth || (a.Depth == b.Depth && a.Index < b.Index); };
+		std::vector<QuadData::Spawn>& opaqueSpawns = s_Data.quadData.OpaqueSpawns;
+		std::vector<QuadData::Spawn>& translucentSpawns = s_Data.quadData.TranslucentSpawns;
+		std::sort(translucentSpawns.begin(), translucentSpawns.end(), backToFront);
+
+		// Opaque spawns submitted after a translucent spawn of equal depth would be drawn under it.
+		// Move them into translucent pass, so they're drawn over it in submission order
+		const size_t translucentCount = translucentSpawns.size();
+		if (translucentCount)
+		{
+			size_t opaqueCount = 0;
+			for (const QuadData::Spawn& spawn : opaqueSpawns)
+			{
+				// First translucent spawn at equal depth has the lowest Index
+				auto it = std::lower_bound(translucentSpawns.begin(), translucentSpawns.begin() + translucentCount, spawn.Depth,
+					[](const QuadData::Spawn& a, float depth) { return a.Depth > depth; });
+				if (it != translucentSpawns.begin() + translucentCount && it->Depth == spawn.Depth && it->Index < spawn.Index)
+					translucentSpawns.push_back(spawn);
+				else
+					opaqueSpawns[opaqueCount++] = spawn;
+			}
+			opaqueSpawns.resize(opaqueCount);
+
+			if (translucentSpawns.size() != translucentCount)
+				std::sort(translucentSpawns.begin(), translucentSpawns.end(), backToFront);
+		}
+
+		// Stable, so equal depths keep submission order
+		std::stable_sort(opaqueSpawns.begin(), opaqueSpawns.end(),
+			[](const QuadData::Spawn& a, const QuadData::Spawn& b) { return a.Depth < b.Depth; });
+
+		const size_t vertexCount = (s_Data.quadData.OpaqueSpawns.size() + s_Data.quadData.TranslucentSpawns.size()) * 4;
+		if (s_Data.quadData.SortedVertices.size() < vertexCount)
+			s_Data.quadData.SortedVertices.resize(vertexCount);
+
+		QuadVertex* sorted = s_Data.quadData.SortedVertices.data();
+		for (const QuadData::Spawn& spawn : s_Data.quadData.OpaqueSpawns)
+		{
+			memcpy(sorted, s_Data.quadData.VertexBufferBase + spawn.Index * 4, 4 * sizeof(QuadVertex));
+			sorted += 4;
+		}
+		for (const QuadData::Spawn& spawn : s_Data.quadData.TranslucentSpawns)
+		{
+			memcpy(sorted, s_Data.quadData.VertexBufferBase + spawn.Index * 4, 4 * sizeof(QuadVertex));
+			sorted += 4;
+		}
+	}
+
 	void OpenGLRenderer::ResetQuadData()
 	{
 		s_Data.quadData.IndexCount = 0;
 		s_Data.quadData.VertexBufferPtr = s_Data.quadData.VertexBufferBase;
+		s_Data.quadData.OpaqueSpawns.clear();
+		s_Data.quadData.TranslucentSpawns.clear();
+		s_Data.quadData.StaticSpawns.clear();
 
 		s_Data.spriteData.TextureSlotIndex = 1;
 	}
@@ -496,8 +796,7 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
-		if (s_Data.quadData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		ReserveData(s_Data.quadData, 4, 6, true);
 
 		const glm::vec2 textureCoords[] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
 		const uint32_t textureIndex = 0; // White Texture
@@ -509,8 +808,7 @@ namespace GE
 	void OpenGLRenderer::DrawQuadTexture(const glm::mat4& transform, const Pivot& pivot, Ref<Texture2D> texture, const float& tilingFactor,
 		const glm::vec4& color, const uint32_t& entityID)
 	{
-		if (s_Data.quadData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		ReserveData(s_Data.quadData, 4, 6, true);
 
 		const glm::vec2 textureCoords[] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
 		uint32_t textureIndex = 0;
@@ -543,8 +841,7 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
-		if (s_Data.quadData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		ReserveData(s_Data.quadData, 4, 6, true);
 
 		const glm::vec2* textureCoords = subTexture->GetTextureCoords();
 
@@ -580,11 +877,10 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
-		if (src.AssetHandle)
-		{
-			Ref<Texture2D> texture = Project::GetAsset<Texture2D>(src.AssetHandle);
+		// Untextured placeholder while texture loads
+		Ref<Texture2D> texture = src.AssetHandle ? Project::GetAssetAsync<Texture2D>(src.AssetHandle) : nullptr;
+		if (texture)
 			DrawQuadTexture(transform, pivot, texture, src.TilingFactor, src.Color, entityID);
-		}
 		else
 			DrawQuadColor(transform, pivot, src.Color, entityID);
 
@@ -592,6 +888,78 @@ namespace GE
 
 #pragma endregion
 
+#pragma region Static
+	void OpenGLRenderer::AddStaticSprite(Ref<StaticBatch> batch, const glm::mat4& transform, const Pivot& pivot,
+		const SpriteRendererComponent& src, const uint32_t& entityID)
+	{
+		if (!batch || batch->IsBaked())
+		{
+			GE_CORE_WARN("OpenGLRenderer::AddStaticSprite() Failed - StaticBatch is null or already baked");
+			return;
+		}
+
+		if (s_Data.quadData.PivotPoints.find(pivot) == s_Data.quadData.PivotPoints.end())
+		{
+			GE_CORE_ERROR("OpenGLRenderer::AddStaticSprite() Failed - Unknown Pivot");
+			return;
+		}
+		QuadData::Vertices& vertices = s_Data.quadData.PivotPoints.at(pivot);
+		const glm::vec2 textureCoords[] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
+		// Slot 0 is white texture, batch texture is bound to slot 1
+		const int textureIndex = batch->Texture ? 1 : 0;
+		for (int i = 0; i < 4; i++)
+		{
+			QuadVertex vertex = QuadVertex();
+			vertex.Position = transform * vertices[i];
+			vertex.Color = src.Color;
+			vertex.TextureCoord = textureCoords[i];
+			vertex.TextureIndex = textureIndex;
+			vertex.TilingFactor = src.TilingFactor;
+			vertex.EntityID = (int)entityID;
+			batch->Vertices.push_back(vertex);
+
+			batch->Bounds.first = glm::min(batch->Bounds.first, glm::vec2(vertex.Position));
+			batch->Bounds.second = glm::max(batch->Bounds.second, glm::vec2(vertex.Position));
+		}
+		batch->SpawnCount++;
+	}
+
+	void OpenGLRenderer::UploadStaticBatch(Ref<StaticBatch> batch)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!batch || batch->IsBaked() || batch->Vertices.empty())
+			return;
+
+		Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create((uint32_t)(batch->Vertices.size() * sizeof(QuadVertex)));
+		vertexBuffer->SetLayout(s_Data.quadData.VertexBuffer->GetLayout());
+		vertexBuffer->SetData(batch->Vertices.data(), (uint32_t)(batch->Vertices.size() * sizeof(QuadVertex)));
+
+		batch->VertexArray = VertexArray::Create();
+		batch->VertexArray->AddVertexBuffer(vertexBuffer);
+		batch->VertexArray->AddIndexBuffer(IndexBuffer::Create(batch->SpawnCount * 6));
+
+		batch->Vertices.clear();
+		batch->Vertices.shrink_to_fit();
+
+		s_Data.Stats.StaticBakes++;
+	}
+
+	void OpenGLRenderer::DrawStaticBatch(Ref<StaticBatch> batch)
+	{
+		GE_PROFILE_FUNCTION();
+
+		if (!batch || !batch->IsBaked())
+			return;
+
+		// Queued & drawn at Flush, depth sorted between translucent spawns
+		const glm::vec2 center = (batch->Bounds.first + batch->Bounds.second) * 0.5f;
+		const glm::vec4 clip = s_Data.quadData.ViewProjection * glm::vec4(center, batch->Z, 1.0f);
+		const float depth = clip.w > 0.0f ? clip.z / clip.w : 1.0f;
+		s_Data.quadData.StaticSpawns.push_back({ depth, batch });
+	}
+#pragma endregion
+
 #pragma region Circle
 	void OpenGLRenderer::SetCircleData(const glm::mat4& transform, const Pivot& pivot, const float& radius, const float& thickness, const float& fade,
 		const glm::vec4& color, const uint32_t& entityID) 
@@ -661,8 +1029,7 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
-		if (s_Data.circleData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		ReserveData(s_Data.circleData, 4, 6, true);
 
 		SetCircleData(transform, pivot, radius, thickness, fade, color, entityID);
 	}
@@ -703,8 +1070,7 @@ namespace GE
 	{
 		GE_PROFILE_FUNCTION();
 
-		if (s_Data.lineData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		ReserveData(s_Data.lineData, 2, 2, false);
 
 		SetLineData(initialPosition, finalPosition, color, entityID);
 	}
@@ -733,10 +1099,14 @@ namespace GE
 		const glm::vec2& minQuadPlane, const glm::vec2& maxQuadPlane, Ref<Font> font,
 		const glm::vec4& textColor, const glm::vec4& bgColor, const uint32_t& entityID)
 	{
+		// Reserved per glyph, strings can be longer than the space left in batch
+		ReserveData(s_Data.textData, 4, 6, true);
+
 		s_Data.textData.VertexBufferPtr->Position = transform * glm::vec4(minQuadPlane, 0.0f, 1.0f);
 		s_Data.textData.VertexBufferPtr->TextColor = textColor;
 		s_Data.textData.VertexBufferPtr->BGColor = bgColor;
 		s_Data.textData.VertexBufferPtr->TextureCoord = minTextureCoord;
+		s_Data.textData.VertexBufferPtr->AtlasIndex = s_Data.textData.AtlasIndex;
 		s_Data.textData.VertexBufferPtr->EntityID = (uint64_t)entityID;
 		s_Data.textData.VertexBufferPtr++;
 
@@ -744,6 +1114,7 @@ namespace GE
 		s_Data.textData.VertexBufferPtr->TextColor = textColor;
 		s_Data.textData.VertexBufferPtr->BGColor = bgColor;
 		s_Data.textData.VertexBufferPtr->TextureCoord = { minTextureCoord.x, maxTextureCoord.y };
+		s_Data.textData.VertexBufferPtr->AtlasIndex = s_Data.textData.AtlasIndex;
 		s_Data.textData.VertexBufferPtr->EntityID = (uint64_t)entityID;
 		s_Data.textData.VertexBufferPtr++;
 
@@ -751,6 +1122,7 @@ namespace GE
 		s_Data.textData.VertexBufferPtr->TextColor = textColor;
 		s_Data.textData.VertexBufferPtr->BGColor = bgColor;
 		s_Data.textData.VertexBufferPtr->TextureCoord = maxTextureCoord;
+		s_Data.textData.VertexBufferPtr->AtlasIndex = s_Data.textData.AtlasIndex;
 		s_Data.textData.VertexBufferPtr->EntityID = (uint64_t)entityID;
 		s_Data.textData.VertexBufferPtr++;
 
@@ -758,6 +1130,7 @@ namespace GE
 		s_Data.textData.VertexBufferPtr->TextColor = textColor;
 		s_Data.textData.VertexBufferPtr->BGColor = bgColor;
 		s_Data.textData.VertexBufferPtr->TextureCoord = { maxTextureCoord.x, minTextureCoord.y };
+		s_Data.textData.VertexBufferPtr->AtlasIndex = s_Data.textData.AtlasIndex;
 		s_Data.textData.VertexBufferPtr->EntityID = (uint64_t)entityID;
 		s_Data.textData.VertexBufferPtr++;
 
@@ -769,64 +1142,80 @@ namespace GE
 	{
 		s_Data.textData.IndexCount = 0;
 		s_Data.textData.VertexBufferPtr = s_Data.textData.VertexBufferBase;
+		// Current atlas stays in slot 0, a full batch flushes between SetTextAtlas() & SetTextData()
+		if (s_Data.textData.AtlasIndex < s_Data.textData.AtlasSlotIndex)
+		{
+			s_Data.textData.AtlasSlots[0] = s_Data.textData.AtlasSlots[s_Data.textData.AtlasIndex];
+			s_Data.textData.AtlasSlotIndex = 1;
+		}
+		else
+			s_Data.textData.AtlasSlotIndex = 0;
+		s_Data.textData.AtlasIndex = 0;
 	}
 
 	void OpenGLRenderer::DrawString(const glm::mat4& transform, const std::string& text, Ref<Font> font,
 		const glm::vec4& textColor, const glm::vec4& bgColor, const float& kerningOffset, const float& lineHeightOffset,
 		const float& scalar, const glm::vec2& offset, const uint32_t& entityID)
 	{
-		if (!font || !font->GetMSDFData() || !font->GetAtlasTexture())
+		if (!font || font->GetGlyphTable().IsEmpty() || !font->GetAtlasTexture())
 			return;
 
-		if (s_Data.textData.IndexCount >= s_Data.MaxIndices)
-			Flush();
+		// Places glyphs generated since last draw. Flushes first, evicted cells may be in batch
+		if (GlyphCache* glyphCache = font->GetGlyphCache())
+		{
+			if (glyphCache->HasCompleted())
+			{
+				if (s_Data.textData.IndexCount)
+				{
+					Ref<Texture2D> page = glyphCache->GetPage();
+					const auto slotsEnd = s_Data.textData.AtlasSlots.begin() + s_Data.textData.AtlasSlotIndex;
+					if (std::find(s_Data.textData.AtlasSlots.begin(), slotsEnd, page) != slotsEnd)
+						Flush();
+				}
 
-		Ref<Texture2D> atlas = font->GetAtlasTexture();
-		s_Data.textData.AtlasTexture = atlas;
-		float texelWidth = 1.0f / (float)s_Data.textData.AtlasTexture->GetWidth();
-		float texelHeight = 1.0f / (float)s_Data.textData.AtlasTexture->GetHeight();
+				uint64_t evictions = glyphCache->GetStats().Evictions;
+				glyphCache->Update();
+				s_Data.Stats.GlyphCacheEvictions += (uint32_t)(glyphCache->GetStats().Evictions - evictions);
+			}
+		}
 
-		Ref<Font::MSDFData> msdfData = font->GetMSDFData();
-		const auto& metrics = msdfData->FontGeometry.getMetrics();
-		double fsScale = scalar / (metrics.ascenderY - metrics.descenderY);
+		const Font::GlyphTable& glyphTable = font->GetGlyphTable();
+		const Font::Metrics& metrics = glyphTable.FontMetrics;
+		double fsScale = scalar / (metrics.AscenderY - metrics.DescenderY);
 		double x = 0.0 + offset.x;
 		double y = 0.0 + offset.y;
 
-		for (size_t i = 0; i < text.size(); i++)
+		size_t i = 0;
+		while (i < text.size())
 		{
-			char character = text[i];
+			uint32_t character = GetNextCodepoint(text, i);
 			if (character == '\r')
 				continue;
 
 			if (character == '\n' || character == '\0')
 			{
 				x = 0;
-				y -= fsScale * metrics.lineHeight + lineHeightOffset;
+				y -= fsScale * metrics.LineHeight + lineHeightOffset;
 				continue;
 			}
-			auto glyph = msdfData->FontGeometry.getGlyph(character);
+
+			Ref<Texture2D> glyphTexture = nullptr;
+			const Font::Glyph* glyph = GetTextGlyph(font, character, glyphTexture);
 			if (!glyph)
 			{
-				if (character == '\t')
-					glyph = msdfData->FontGeometry.getGlyph(' ');
-				if (!glyph)
-					glyph = msdfData->FontGeometry.getGlyph('?');
-				if (!glyph)
-				{
-					GE_CORE_ERROR("Could not get Text Glyph.");
-					return;
-				}
+				GE_CORE_ERROR("Could not get Text Glyph.");
+				return;
 			}
+			SetTextAtlas(glyphTexture);
+
+			float texelWidth = 1.0f / (float)glyphTexture->GetWidth();
+			float texelHeight = 1.0f / (float)glyphTexture->GetHeight();
 
-			double al, ab, ar, at;
-			glyph->getQuadAtlasBounds(al, ab, ar, at);
-			glm::vec2 texCoordMin((float)al, (float)ab);
-			glm::vec2 texCoordMax((float)ar, (float)at);
+			glm::vec2 texCoordMin(glyph->AtlasBounds.x, glyph->AtlasBounds.y);
+			glm::vec2 texCoordMax(glyph->AtlasBounds.z, glyph->AtlasBounds.w);
 
-			double pl, pb, pr, pt;
-			glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-			glm::vec2 quadMin((float)pl, (float)pb);
-			glm::vec2 quadMax((float)pr, (float)pt);
+			glm::vec2 quadMin(glyph->PlaneBounds.x, glyph->PlaneBounds.y);
+			glm::vec2 quadMax(glyph->PlaneBounds.z, glyph->PlaneBounds.w);
 
 			quadMin *= fsScale;
 			quadMax *= fsScale;
@@ -838,20 +1227,106 @@ namespace GE
 
 			SetTextData(transform, texCoordMin, texCoordMax, quadMin, quadMax, font, textColor, bgColor, entityID);
 
-			if (i < text.size() - 1)
+			if (i < text.size())
 			{
-				double advance = glyph->getAdvance();
-				char nextCharacter = text[i + 1];
-				msdfData->FontGeometry.getAdvance(advance, character, nextCharacter);
+				size_t next = i;
+				uint32_t nextCharacter = GetNextCodepoint(text, next);
+				double advance = glyphTable.GetAdvance(*glyph, nextCharacter);
 
 				x += fsScale * advance + kerningOffset;
 			}
 		}
 	}
 
+	uint32_t OpenGLRenderer::GetNextCodepoint(const std::string& text, size_t& index)
+	{
+		uint8_t lead = (uint8_t)text[index++];
+		uint32_t length = 0;
+		uint32_t codepoint = lead;
+		if (lead >= 0xF0)
+		{
+			length = 3;
+			codepoint = lead & 0x07;
+		}
+		else if (lead >= 0xE0)
+		{
+			length = 2;
+			codepoint = lead & 0x0F;
+		}
+		else if (lead >= 0xC0)
+		{
+			length = 1;
+			codepoint = lead & 0x1F;
+		}
+		else if (lead >= 0x80)
+			return '?'; // Stray continuation byte
+
+		for (uint32_t i = 0; i < length; i++)
+		{
+			if (index >= text.size() || ((uint8_t)text[index] & 0xC0) != 0x80)
+				return '?'; // Truncated sequence
+			codepoint = (codepoint << 6) | ((uint8_t)text[index++] & 0x3F);
+		}
+		return codepoint;
+	}
+
+	const Font::Glyph* OpenGLRenderer::GetTextGlyph(Ref<Font> font, uint32_t codepoint, Ref<Texture2D>& outTexture)
+	{
+		const Font::GlyphTable& glyphTable = font->GetGlyphTable();
+		if (const Font::Glyph* glyph = glyphTable.GetGlyph(codepoint))
+		{
+			outTexture = font->GetAtlasTexture();
+			return glyph;
+		}
+
+		if (GlyphCache* glyphCache = font->GetGlyphCache())
+		{
+			if (const Font::Glyph* glyph = glyphCache->Request(codepoint))
+			{
+				s_Data.Stats.GlyphCacheHits++;
+				outTexture = glyphCache->GetPage();
+				return glyph;
+			}
+			s_Data.Stats.GlyphCacheMisses++;
+		}
+
+		// Fallback until generated, or if font doesn't have codepoint
+		const Font::Glyph* glyph = nullptr;
+		if (codepoint == '\t')
+			glyph = glyphTable.GetGlyph(' ');
+		if (!glyph)
+			glyph = glyphTable.GetGlyph('?');
+		outTexture = font->GetAtlasTexture();
+		return glyph;
+	}
+
+	void OpenGLRenderer::SetTextAtlas(Ref<Texture2D> atlasTexture)
+	{
+		if (s_Data.textData.AtlasIndex < s_Data.textData.AtlasSlotIndex && s_Data.textData.AtlasSlots[s_Data.textData.AtlasIndex] == atlasTexture)
+			return;
+
+		for (uint32_t i = 0; i < s_Data.textData.AtlasSlotIndex; i++)
+		{
+			if (s_Data.textData.AtlasSlots[i] == atlasTexture)
+			{
+				s_Data.textData.AtlasIndex = i;
+				return;
+			}
+		}
+
+		// Flush all batches to keep draw order, text is drawn after quads
+		if (s_Data.textData.AtlasSlotIndex >= s_Data.textData.MaxAtlasSlots)
+			Flush();
+
+		s_Data.textData.AtlasIndex = s_Data.textData.AtlasSlotIndex;
+		s_Data.textData.AtlasSlots[s_Data.textData.AtlasSlotIndex] = atlasTexture;
+		s_Data.textData.AtlasSlotIndex++;
+	}
+
 	void OpenGLRenderer::DrawString(const glm::mat4& transform, const TextRendererComponent& trc, const uint32_t& entityID)
 	{
-		Ref<Font> font = Project::GetAsset<Font>(trc.AssetHandle);
+		// Skipped while font loads
+		Ref<Font> font = Project::GetAssetAsync<Font>(trc.AssetHandle);
 		if (font)
 		{
 			DrawString(transform, trc.Text, font, trc.TextColor, trc.BGColor,
@@ -906,7 +1381,7 @@ namespace GE
 	}
 	void OpenGLRenderer::DrawButton(const glm::mat4& transform, const Pivot& pivot, const GUIButtonComponent& guiBC, const GUIState& state, const uint32_t& entityID)
 	{
-		if (Ref<Texture2D> bgTexture = Project::GetAsset<Texture2D>(guiBC.BackgroundTextureHandle))
+		if (Ref<Texture2D> bgTexture = Project::GetAssetAsync<Texture2D>(guiBC.BackgroundTextureHandle))
 			DrawQuadTexture(transform, pivot, bgTexture, 1.0f, guiBC.BackgroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiBC.BackgroundColor, entityID);
@@ -917,27 +1392,27 @@ namespace GE
 		{
 		case GUIState::Disabled:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiBC.DisabledTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiBC.DisabledTextureHandle);
 			currentColor = guiBC.DisabledColor;
 		}
 		break;
 		case GUIState::Enabled:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiBC.EnabledTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiBC.EnabledTextureHandle);
 			currentColor = guiBC.EnabledColor;
 		}
 		break;
 		case GUIState::Hovered:
 		case GUIState::Focused:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiBC.HoveredTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiBC.HoveredTextureHandle);
 			currentColor = guiBC.HoveredColor;
 		}
 		break;
 		case GUIState::Active:
 		case GUIState::Selected:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiBC.SelectedTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiBC.SelectedTextureHandle);
 			currentColor = guiBC.SelectedColor;
 		}
 		break;
@@ -951,7 +1426,7 @@ namespace GE
 		else
 			DrawQuadColor(transform, pivot, currentColor, entityID);
 
-		if (Ref<Font> font = Project::GetAsset<Font>(guiBC.FontAssetHandle))
+		if (Ref<Font> font = Project::GetAssetAsync<Font>(guiBC.FontAssetHandle))
 		{
 			glm::vec3 offset = GetFontOffset(pivot, guiBC.TextSize);
 			glm::mat4 fontTransform = glm::translate(transform, offset);
@@ -959,7 +1434,7 @@ namespace GE
 			DrawString(fontTransform, guiBC.Text, font, guiBC.TextColor, guiBC.BGColor,
 				guiBC.KerningOffset, guiBC.LineHeightOffset, guiBC.TextScalar, guiBC.TextStartingOffset, entityID);
 		}
-		if (Ref<Texture2D> fgTexture = Project::GetAsset<Texture2D>(guiBC.ForegroundTextureHandle))
+		if (Ref<Texture2D> fgTexture = Project::GetAssetAsync<Texture2D>(guiBC.ForegroundTextureHandle))
 			DrawQuadTexture(transform, pivot, fgTexture, 1.0f, guiBC.ForegroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiBC.ForegroundColor, entityID);
@@ -969,12 +1444,12 @@ namespace GE
 	void OpenGLRenderer::DrawInputField(const glm::mat4& transform, const Pivot& pivot, const GUIInputFieldComponent& guiIFC, const GUIState& state, const uint32_t& entityID)
 	{
 		glm::mat4 bgTransform = glm::scale(transform, glm::vec3(glm::vec2(guiIFC.TextSize), 1.0f));
-		if (Ref<Texture2D> texture2D = Project::GetAsset<Texture2D>(guiIFC.BackgroundTextureHandle))
+		if (Ref<Texture2D> texture2D = Project::GetAssetAsync<Texture2D>(guiIFC.BackgroundTextureHandle))
 			DrawQuadTexture(bgTransform, pivot, texture2D, 1.0f, guiIFC.BackgroundColor, entityID);
 		else
 			DrawQuadColor(bgTransform, pivot, guiIFC.BackgroundColor, entityID);
 
-		if (Ref<Font> font = Project::GetAsset<Font>(guiIFC.FontAssetHandle))
+		if (Ref<Font> font = Project::GetAssetAsync<Font>(guiIFC.FontAssetHandle))
 		{
 			glm::vec3 offset = GetFontOffset(pivot, guiIFC.TextSize);
 			glm::mat4 fontTransform = glm::translate(transform, offset);
@@ -1365,7 +1840,7 @@ namespace GE
 	void OpenGLRenderer::DrawSlider(const glm::mat4& transform, const Pivot& pivot, const GUISliderComponent& guiSC, const GUIState& state, const uint32_t& entityID)
 	{
 		// Background
-		if (Ref<Texture2D> texture2D = Project::GetAsset<Texture2D>(guiSC.BackgroundTextureHandle))
+		if (Ref<Texture2D> texture2D = Project::GetAssetAsync<Texture2D>(guiSC.BackgroundTextureHandle))
 			DrawQuadTexture(transform, pivot, texture2D, 1.0f, guiSC.BackgroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiSC.BackgroundColor, entityID);
@@ -1384,27 +1859,27 @@ namespace GE
 			{
 			case GUIState::Disabled:
 			{
-				currentTexture = Project::GetAsset<Texture2D>(guiSC.DisabledTextureHandle);
+				currentTexture = Project::GetAssetAsync<Texture2D>(guiSC.DisabledTextureHandle);
 				currentColor = guiSC.DisabledColor;
 			}
 			break;
 			case GUIState::Enabled:
 			{
-				currentTexture = Project::GetAsset<Texture2D>(guiSC.EnabledTextureHandle);
+				currentTexture = Project::GetAssetAsync<Texture2D>(guiSC.EnabledTextureHandle);
 				currentColor = guiSC.EnabledColor;
 			}
 			break;
 			case GUIState::Hovered:
 			case GUIState::Focused:
 			{
-				currentTexture = Project::GetAsset<Texture2D>(guiSC.HoveredTextureHandle);
+				currentTexture = Project::GetAssetAsync<Texture2D>(guiSC.HoveredTextureHandle);
 				currentColor = guiSC.HoveredColor;
 			}
 			break;
 			case GUIState::Active:
 			case GUIState::Selected:
 			{
-				currentTexture = Project::GetAsset<Texture2D>(guiSC.SelectedTextureHandle);
+				currentTexture = Project::GetAssetAsync<Texture2D>(guiSC.SelectedTextureHandle);
 				currentColor = guiSC.SelectedColor;
 			}
 			break;
@@ -1420,7 +1895,7 @@ namespace GE
 		}
 
 		// Foreground
-		if (Ref<Texture2D> texture2D = Project::GetAsset<Texture2D>(guiSC.ForegroundTextureHandle))
+		if (Ref<Texture2D> texture2D = Project::GetAssetAsync<Texture2D>(guiSC.ForegroundTextureHandle))
 			DrawQuadTexture(transform, pivot, texture2D, 1.0f, guiSC.ForegroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiSC.ForegroundColor, entityID);
@@ -1430,7 +1905,7 @@ namespace GE
 	void OpenGLRenderer::DrawCheckbox(const glm::mat4& transform, const Pivot& pivot, const GUICheckboxComponent& guiCB, const GUIState& state, const uint32_t& entityID)
 	{
 		// Background
-		if (Ref<Texture2D> bgTexture = Project::GetAsset<Texture2D>(guiCB.BackgroundTextureHandle))
+		if (Ref<Texture2D> bgTexture = Project::GetAssetAsync<Texture2D>(guiCB.BackgroundTextureHandle))
 			DrawQuadTexture(transform, pivot, bgTexture, 1.0f, guiCB.BackgroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiCB.BackgroundColor, entityID);
@@ -1441,27 +1916,27 @@ namespace GE
 		{
 		case GUIState::Disabled:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiCB.DisabledTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiCB.DisabledTextureHandle);
 			currentColor = guiCB.DisabledColor;
 		}
 		break;
 		case GUIState::Enabled:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiCB.EnabledTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiCB.EnabledTextureHandle);
 			currentColor = guiCB.EnabledColor;
 		}
 		break;
 		case GUIState::Hovered:
 		case GUIState::Focused:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiCB.HoveredTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiCB.HoveredTextureHandle);
 			currentColor = guiCB.HoveredColor;
 		}
 		break;
 		case GUIState::Active:
 		case GUIState::Selected:
 		{
-			currentTexture = Project::GetAsset<Texture2D>(guiCB.SelectedTextureHandle);
+			currentTexture = Project::GetAssetAsync<Texture2D>(guiCB.SelectedTextureHandle);
 			currentColor = guiCB.SelectedColor;
 		}
 		break;
@@ -1476,7 +1951,7 @@ namespace GE
 			DrawQuadColor(transform, pivot, currentColor, entityID);
 
 		// Foreground
-		if (Ref<Texture2D> fgTexture = Project::GetAsset<Texture2D>(guiCB.ForegroundTextureHandle))
+		if (Ref<Texture2D> fgTexture = Project::GetAssetAsync<Texture2D>(guiCB.ForegroundTextureHandle))
 			DrawQuadTexture(transform, pivot, fgTexture, 1.0f, guiCB.ForegroundColor, entityID);
 		else
 			DrawQuadColor(transform, pivot, guiCB.ForegroundColor, entityID);
@@ -20,6 +20,8 @@ namespace GE
 
 		const Statistics& GetStats() override;
 		void ClearStats() override;
+		void AddEntityStats(uint32_t drawn, uint32_t culled) override;
+		void SetMaxSpawns(uint32_t spawns) override;
 
 		// Clears Color, Depth & Stencil GLBuffers
 		void ClearBuffers() override;
@@ -36,7 +38,7 @@ namespace GE
 		void SetLineWidth(float thickness) override;
 
 		void DrawLines(Ref<VertexArray> vertexArray, uint32_t vertexCount) override;
-		void DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount) override;
+		void DrawIndices(Ref<VertexArray> vertexArray, uint32_t indexCount, uint32_t firstIndex = 0) override;
 
 		// Sprite/Quad
 		void DrawQuadColor(const glm::mat4& transform, const Pivot& pivot, const glm::vec4& color, const uint32_t& entityID) override;
@@ -46,6 +48,11 @@ namespace GE
 			const glm::vec4& tintColor, const uint32_t& entityID = -1) override;
 		void DrawSprite(const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src, const uint32_t& entityID) override;
 
+		// Static
+		void AddStaticSprite(Ref<StaticBatch> batch, const glm::mat4& transform, const Pivot& pivot, const SpriteRendererComponent& src, const uint32_t& entityID) override;
+		void UploadStaticBatch(Ref<StaticBatch> batch) override;
+		void DrawStaticBatch(Ref<StaticBatch> batch) override;
+
 		// Circle
 		void DrawCircle(const glm::mat4& transform, const Pivot& pivot, const float& radius, const float& thickness, const float& fade,
 			const glm::vec4& color, const uint32_t& entityID) override;
@@ -70,10 +77,33 @@ namespace GE
 		void DrawCheckbox(const glm::mat4& transform, const Pivot& pivot, const GUICheckboxComponent& guiCB, const GUIState& state, const uint32_t& entityID) override;
 
 	private:
+		/*
+		* Makes room for one more spawn in batch.
+		* Grows batch when full, or flushes when already at Data::MaxSpawns.
+		*
+		* @param batch : QuadData, CircleData, LineData or TextData
+		* @param verticesPerSpawn : 4 for quads, 2 for lines
+		* @param indicesPerSpawn : counted by batch's IndexCount, 6 for quads, 2 for lines
+		* @param indexed : batch draws with SharedIndexBuffer, grown to fit
+		*/
+		template<typename Batch>
+		void ReserveData(Batch& batch, uint32_t verticesPerSpawn, uint32_t indicesPerSpawn, bool indexed);
+		/*
+		* Shrinks batches after sustained low usage & resets their peaks.
+		* Called once per frame.
+		*/
+		void UpdateCapacities();
+
 		// Sprite/Quad
 		void SetQuadData(const glm::mat4& transform, const Pivot& pivot, const uint32_t& textureIndex, const glm::vec2 textureCoords[4],
 			const float& tilingFactor, const glm::vec4& color, const uint32_t& entityID) override;
 		void ResetQuadData() override;
+		/*
+		* Orders spawns into SortedVertices, opaque front-to-back then translucent back-to-front.
+		* Opaque spawns submitted after a translucent spawn of equal depth are drawn with translucent spawns.
+		* Static batches are ordered back-to-front, drawn between translucent spawns at Flush.
+		*/
+		void SortQuadData();
 
 		// Circle
 		void SetCircleData(const glm::mat4& transform, const Pivot& pivot, const float& radius, const float& thickness, const float& fade,
@@ -89,6 +119,19 @@ namespace GE
 			const glm::vec2& minQuadPlane, const glm::vec2& maxQuadPlane, Ref<Font> font,
 			const glm::vec4& texColor, const glm::vec4& bgColor, const uint32_t& entityID) override;
 		void ResetTextData() override;
+		/*
+		* Decodes UTF-8 codepoint at index & moves index past it. Invalid sequences return '?'.
+		*/
+		static uint32_t GetNextCodepoint(const std::string& text, size_t& index);
+		/*
+		* Returns glyph from Font GlyphTable, then GlyphCache, then fallback glyph.
+		* Sets outTexture to atlas glyph is in.
+		*/
+		const Font::Glyph* GetTextGlyph(Ref<Font> font, uint32_t codepoint, Ref<Texture2D>& outTexture);
+		/*
+		* Selects atlas slot glyphs are added from. Flushes only when text batch has no free slot
+		*/
+		void SetTextAtlas(Ref<Texture2D> atlasTexture);
 
 	private:
 		static Data s_Data;
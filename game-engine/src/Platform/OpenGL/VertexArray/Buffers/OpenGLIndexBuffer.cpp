@@ -7,12 +7,27 @@
 namespace GE
 {
 	OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t count)
-		: m_Count(count)
 	{
 		GE_PROFILE_FUNCTION();
+		glCreateBuffers(1, &m_RendererID);
+		Resize(count);
+	}
+
+	OpenGLIndexBuffer::~OpenGLIndexBuffer()
+	{
+		glDeleteBuffers(1, &m_RendererID);
+		delete[] m_Indices;
+	}
+
+	void OpenGLIndexBuffer::Resize(uint32_t count)
+	{
+		GE_PROFILE_FUNCTION();
+
+		delete[] m_Indices;
+		m_Count = count;
 		m_Indices = new uint32_t[count];
 		uint32_t offset = 0;
-		for (uint32_t i = 0; i < count; i += 6)
+		for (uint32_t i = 0; i + 6 <= count; i += 6)
 		{
 			m_Indices[i + 0] = offset + 0;
 			m_Indices[i + 1] = offset + 1;
@@ -24,14 +39,8 @@ namespace GE
 
 			offset += 4;
 		}
-		glCreateBuffers(1, &m_RendererID);
-		this->Bind();
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_Count * sizeof(uint32_t), m_Indices, GL_STATIC_DRAW);
-	}
-
-	OpenGLIndexBuffer::~OpenGLIndexBuffer()
-	{
-		glDeleteBuffers(1, &m_RendererID);
+		// Named, binding GL_ELEMENT_ARRAY_BUFFER would attach it to whichever VertexArray is bound
+		glNamedBufferData(m_RendererID, m_Count * sizeof(uint32_t), m_Indices, GL_STATIC_DRAW);
 	}
 
 	void OpenGLIndexBuffer::Bind() const
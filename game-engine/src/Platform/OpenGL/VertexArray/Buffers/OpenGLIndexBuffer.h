@@ -11,6 +11,7 @@ namespace GE
 		~OpenGLIndexBuffer() override;
 
 		const uint32_t& GetCount() const { return m_Count; }
+		void Resize(uint32_t count) override;
 
 		// Binds buffer using OpenGL
 		void Bind() const override;
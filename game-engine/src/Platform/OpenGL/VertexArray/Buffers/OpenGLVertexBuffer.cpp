@@ -6,7 +6,7 @@
 
 namespace GE
 {
-	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) : m_Size(size)
 	{
 		GE_PROFILE_FUNCTION();
 
@@ -15,7 +15,7 @@ namespace GE
 		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 	}
 
-	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, float* vertices)
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, float* vertices) : m_Size(size)
 	{
 		GE_PROFILE_FUNCTION();
 
@@ -35,6 +35,14 @@ namespace GE
 		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
 	}
 
+	void OpenGLVertexBuffer::Resize(uint32_t size)
+	{
+		GE_PROFILE_FUNCTION();
+
+		m_Size = size;
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+	}
+
 	void OpenGLVertexBuffer::Bind() const
 	{
 		GE_PROFILE_FUNCTION();
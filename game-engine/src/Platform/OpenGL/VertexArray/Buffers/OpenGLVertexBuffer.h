@@ -16,11 +16,14 @@ namespace GE
 		inline void SetLayout(const Layout& layout) override { m_Layout = layout; }
 	
 		void SetData(const void* data, uint32_t size) override;
+		void Resize(uint32_t size) override;
+		const uint32_t& GetSize() const override { return m_Size; }
 
 		void Bind() const override;
 		void Unbind() const override;
 	private:
 		uint32_t m_RendererID;
+		uint32_t m_Size = 0;
 		Layout m_Layout;
 	};
 
@@ -0,0 +1,67 @@
+#include "GE/GEpch.h"
+
+#include "GE/Core/FileSystem/MappedFile.h"
+
+namespace GE
+{
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		GE_PROFILE_FUNCTION();
+
+		Close();
+
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			GE_CORE_ERROR("MappedFile::Open() Failed - Could not open file.\n\tFilePath : {0}", path.string().c_str());
+			return false;
+		}
+
+		LARGE_INTEGER size = {};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			GE_CORE_ERROR("MappedFile::Open() Failed - File is empty.\n\tFilePath : {0}", path.string().c_str());
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!mapping)
+		{
+			GE_CORE_ERROR("MappedFile::Open() Failed - Could not create mapping.\n\tFilePath : {0}", path.string().c_str());
+			CloseHandle(file);
+			return false;
+		}
+
+		const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data)
+		{
+			GE_CORE_ERROR("MappedFile::Open() Failed - Could not map view.\n\tFilePath : {0}", path.string().c_str());
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_Data = (const uint8_t*)data;
+		m_Size = (uint64_t)size.QuadPart;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_MappingHandle)
+			CloseHandle((HANDLE)m_MappingHandle);
+		if (m_FileHandle)
+			CloseHandle((HANDLE)m_FileHandle);
+
+		m_Data = nullptr;
+		m_Size = 0;
+		m_MappingHandle = nullptr;
+		m_FileHandle = nullptr;
+	}
+}
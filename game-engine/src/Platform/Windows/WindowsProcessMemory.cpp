@@ -0,0 +1,24 @@
+#include "GE/GEpch.h"
+
+#include "GE/Core/Memory/ProcessMemory.h"
+
+#include <psapi.h>
+
+namespace GE
+{
+	uint64_t ProcessMemory::GetResidentSize()
+	{
+		PROCESS_MEMORY_COUNTERS counters = {};
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return 0;
+		return (uint64_t)counters.WorkingSetSize;
+	}
+
+	uint64_t ProcessMemory::GetPeakResidentSize()
+	{
+		PROCESS_MEMORY_COUNTERS counters = {};
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			return 0;
+		return (uint64_t)counters.PeakWorkingSetSize;
+	}
+}
@@ -338,13 +338,16 @@ namespace GE
 	}
 	void WindowsWindow::SetCursorShape(const CursorShape& shape)
 	{
+		m_PendingCursor = PendingCursor();
 		if (m_Cursor = glfwCreateStandardCursor(GetGLFWCursorShape(shape)))
 			glfwSetCursor(m_Window, m_Cursor);
 	}
 
 	void WindowsWindow::SetCursorIcon(UUID textureHandle, uint32_t x, uint32_t y)
 	{
-		if (Ref<Texture2D> cursorIcon = Project::GetAsset<Texture2D>(textureHandle))
+		// Set again by OnUpdate() once loaded
+		m_PendingCursor = Project::IsAssetLoading(textureHandle) ? PendingCursor{ textureHandle, x, y } : PendingCursor();
+		if (Ref<Texture2D> cursorIcon = Project::GetAssetAsync<Texture2D>(textureHandle))
 		{
 			GLFWimage image = GLFWimage();
 			image.width = cursorIcon->GetWidth();
@@ -357,7 +360,9 @@ namespace GE
 
 	void WindowsWindow::SetIcon(UUID textureHandle)
 	{
-		if (Ref<Texture2D> textureAsset = Project::GetAsset<Texture2D>(textureHandle))
+		// Set again by OnUpdate() once loaded
+		m_PendingIconHandle = Project::IsAssetLoading(textureHandle) ? textureHandle : UUID(0);
+		if (Ref<Texture2D> textureAsset = Project::GetAssetAsync<Texture2D>(textureHandle))
 		{
 			if (textureAsset->GetConfig().TextureBuffer)
 			{
@@ -376,5 +381,10 @@ namespace GE
 
 		glfwPollEvents();
 		glfwSwapBuffers(m_Window);
+
+		if (m_PendingCursor.TextureHandle && !Project::IsAssetLoading(m_PendingCursor.TextureHandle))
+			SetCursorIcon(m_PendingCursor.TextureHandle, m_PendingCursor.X, m_PendingCursor.Y);
+		if (m_PendingIconHandle && !Project::IsAssetLoading(m_PendingIconHandle))
+			SetIcon(m_PendingIconHandle);
 	}
 }
@@ -48,6 +48,17 @@ namespace GE
 		GLFWmonitor* m_Monitor = nullptr;
 		GLFWwindow* m_Window = nullptr;
 		GLFWcursor* m_Cursor = nullptr;
+		/*
+		* Cursor & icon textures still loading when set, see Project::GetAssetAsync()
+		*/
+		struct PendingCursor
+		{
+			UUID TextureHandle = 0;
+			uint32_t X = 0;
+			uint32_t Y = 0;
+		};
+		PendingCursor m_PendingCursor = PendingCursor();
+		UUID m_PendingIconHandle = 0;
 
 		Input::CursorMode m_CursorMode = Input::CursorMode::Normal;
 	};
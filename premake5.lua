@@ -36,6 +36,7 @@ Library["WinSock"] = "Ws2_32.lib"
 Library["WinMM"] = "Winmm.lib"
 Library["WinVersion"] = "Version.lib"
 Library["BCrypt"] = "Bcrypt.lib"
+Library["PSAPI"] = "Psapi.lib"
 
 group "Dependencies"
 	include "game-engine/vender/box2d"
@@ -121,7 +122,8 @@ project "game-engine"
 			"%{Library.WinSock}",
 			"%{Library.WinMM}",
 			"%{Library.WinVersion}",
-			"%{Library.BCrypt}"
+			"%{Library.BCrypt}",
+			"%{Library.PSAPI}"
 		}
 
 	filter "configurations:Debug"
@@ -195,3 +197,71 @@ project "editor"
 		defines "GE_DIST"
 		runtime "Release"
 		optimize "On"
+
+project "ge-cook"
+	location "cook"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	-- Editor importers, without its entry point
+	files
+	{
+		"cook/src/**.h",
+		"cook/src/**.cpp",
+		"editor/src/**.h",
+		"editor/src/**.cpp"
+	}
+
+	removefiles
+	{
+		"editor/src/Application/EditorApplication.h",
+		"editor/src/Application/EditorApplication.cpp"
+	}
+
+	includedirs
+	{
+		"cook/src",
+		"editor/src",
+		"game-engine/src",
+		"game-engine/vender",
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.filewatch}",
+		"%{IncludeDir.GLAD}",
+		"%{IncludeDir.glfw}",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.ImGui}",
+		"%{IncludeDir.mono}",
+		"%{IncludeDir.msdf_atlas_gen}",
+		"%{IncludeDir.msdf_gen}",
+		"%{IncludeDir.OpenAL}",
+		"%{IncludeDir.spdlog}",
+		"%{IncludeDir.yaml_cpp}"
+	}
+
+	links
+	{
+		"game-engine"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines "GE_DEBUG"
+		runtime "Debug"
+		symbols "On"
+
+	filter "configurations:Release"
+		defines "GE_RELEASE"
+		runtime "Release"
+		optimize "On"
+
+	filter "configurations:Dist"
+		defines "GE_DIST"
+		runtime "Release"
+		optimize "On"